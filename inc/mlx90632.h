@@ -39,8 +39,13 @@
 
 /* Including CRC calculation functions */
 #include <errno.h>
+#include "mlx90632_config.h"
 #include "mlx90632_extended_meas.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* Solve errno not defined values */
 #ifndef ETIMEDOUT
 #define ETIMEDOUT 110 /**< From linux errno.h */
@@ -57,6 +62,9 @@
 #ifndef ENOKEY
 #define ENOKEY 126 /**< From linux errno.h */
 #endif
+#ifndef EAGAIN
+#define EAGAIN 11 /**< From linux errno.h */
+#endif
 
 
 /* BIT, GENMASK and ARRAY_SIZE macros are imported from kernel */
@@ -208,6 +216,27 @@ typedef enum mlx90632_meas_e {
 #define MLX90632_NEW_REG_VALUE(old_reg, new_value, h, l) \
         ((old_reg & (0xFFFF ^ GENMASK(h, l))) | (new_value << MLX90632_EE_REFRESH_RATE_SHIFT))
 
+/** Calibration parameters of the sensor as read from the EEPROM
+ *
+ * Values are stored exactly as they are in the EEPROM registers, so they can be passed directly to the
+ * calculation functions.
+ */
+typedef struct mlx90632_calib_s {
+    int32_t P_R; /**< Register value on @link MLX90632_EE_P_R @endlink */
+    int32_t P_G; /**< Register value on @link MLX90632_EE_P_G @endlink */
+    int32_t P_T; /**< Register value on @link MLX90632_EE_P_T @endlink */
+    int32_t P_O; /**< Register value on @link MLX90632_EE_P_O @endlink */
+    int32_t Ea; /**< Register value on @link MLX90632_EE_Ea @endlink */
+    int32_t Eb; /**< Register value on @link MLX90632_EE_Eb @endlink */
+    int32_t Fa; /**< Register value on @link MLX90632_EE_Fa @endlink */
+    int32_t Fb; /**< Register value on @link MLX90632_EE_Fb @endlink */
+    int32_t Ga; /**< Register value on @link MLX90632_EE_Ga @endlink */
+    int16_t Gb; /**< Register value on @link MLX90632_EE_Gb @endlink */
+    int16_t Ka; /**< Register value on @link MLX90632_EE_Ka @endlink */
+    int16_t Ha; /**< Register value on @link MLX90632_EE_Ha @endlink */
+    int16_t Hb; /**< Register value on @link MLX90632_EE_Hb @endlink */
+} mlx90632_calib_t;
+
 /** Read raw ambient and object temperature only when measurement data is ready
  *
  * Read raw ambient and object temperatures without waiting. This values still need
@@ -268,6 +297,7 @@ int32_t mlx90632_read_temp_raw_wo_wait(int32_t channel_position,
 int32_t mlx90632_read_temp_raw(int16_t *ambient_new_raw, int16_t *ambient_old_raw,
                                int16_t *object_new_raw, int16_t *object_old_raw);
 
+#if MLX90632_ENABLE_BURST
 /** Read raw ambient and object temperature in sleeping step mode
  *
  * Trigger and read raw ambient and object temperatures. This values still need
@@ -286,6 +316,7 @@ int32_t mlx90632_read_temp_raw(int16_t *ambient_new_raw, int16_t *ambient_old_ra
  */
 int32_t mlx90632_read_temp_raw_burst(int16_t *ambient_new_raw, int16_t *ambient_old_raw,
                                      int16_t *object_new_raw, int16_t *object_old_raw);
+#endif
 
 /** Calculation of raw ambient output
  *
@@ -364,6 +395,7 @@ double mlx90632_calc_temp_object(int32_t object, int32_t ambient,
                                  int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
                                  int16_t Ha, int16_t Hb);
 
+#if MLX90632_ENABLE_REFLECTED
 /** Calculation of object temperature when the environment temperature differs from the sensor temperature
  *
  * when the object has emissivity lower than 1 then it does not just emit InfraRed light, but also reflects it.
@@ -391,6 +423,7 @@ double mlx90632_calc_temp_object(int32_t object, int32_t ambient,
 double mlx90632_calc_temp_object_reflected(int32_t object, int32_t ambient, double reflected,
                                            int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
                                            int16_t Ha, int16_t Hb);
+#endif
 
 /** Initialize MLX90632 driver and confirm EEPROM version
  *
@@ -431,6 +464,19 @@ int32_t mlx90632_trigger_measurement(void);
  */
 int32_t mlx90632_wait_for_measurement(void);
 
+/** Check once whether measurement is complete for mlx90632
+ *
+ * Non-blocking counterpart of @link mlx90632_wait_for_measurement @endlink for callers which do their own
+ * scheduling: status register is read once and no sleep is done.
+ *
+ * @retval -EAGAIN Measurement data is not ready yet
+ * @retval <0 Something failed. Check errno.h for more information
+ * @retval >=0 Channel position where new (recently updated) measurement can be found
+ *
+ * @note This function is not blocking!
+ */
+int32_t mlx90632_poll_measurement(void);
+
 /** Trigger start measurement for mlx90632
  *
  * Trigger measurement cycle and wait for data to be ready. It does not read anything, just triggers and completes.
@@ -454,6 +500,7 @@ void mlx90632_set_emissivity(double value);
  */
 double mlx90632_get_emissivity(void);
 
+#if MLX90632_ENABLE_BURST
 /** Trigger burst measurement for mlx90632
  *
  * Trigger a full measurement cycle. It does not read anything, just triggers measurement.
@@ -496,6 +543,7 @@ int32_t mlx90632_wait_for_measurement_burst(void);
  * you might also need to take care of Watch Dog.
  */
 int32_t mlx90632_start_measurement_burst(void);
+#endif
 
 /** Trigger single measurement for mlx90632
  *
@@ -520,6 +568,7 @@ int32_t mlx90632_trigger_measurement_single(void);
  */
 int32_t mlx90632_get_measurement_time(uint16_t meas);
 
+#if MLX90632_ENABLE_BURST
 /** Reads the refresh rate and calculates the time needed for a whole measurment table from the EEPROM settings.
  *
  * The function is returning valid measurement time only for burst mode measurements.
@@ -529,6 +578,7 @@ int32_t mlx90632_get_measurement_time(uint16_t meas);
  * @retval <0 Something went wrong. Check errno.h for more details.
  */
 int32_t mlx90632_calculate_dataset_ready_time(void);
+#endif
 
 /** Trigger system reset for mlx90632
  *
@@ -542,6 +592,7 @@ int32_t mlx90632_calculate_dataset_ready_time(void);
  */
 int32_t mlx90632_addressed_reset(void);
 
+#if MLX90632_ENABLE_EEPROM_WRITE
 /** Sets the refresh rate of the sensor using the MLX90632_EE_MEAS_1 and MLX90632_EE_MEAS_2 registers
  *
  * @param[in] measRate refresh rate to set with #mlx90632_meas_e
@@ -549,6 +600,7 @@ int32_t mlx90632_addressed_reset(void);
  * @retval <0 Something went wrong. Consult errno.h for more details.
  */
 int32_t mlx90632_set_refresh_rate(mlx90632_meas_t measRate);
+#endif
 
 /** Gets the value in MLX90632_EE_MEAS_1 and converts it to the appropriate MLX90632_MEAS enum
  *
@@ -573,4 +625,8 @@ int32_t mlx90632_read_temp_object_raw(int32_t channel_position,
 
 #endif
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
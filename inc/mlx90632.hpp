@@ -0,0 +1,785 @@
+/**
+ * @file mlx90632.hpp
+ * @brief MLX90632 C++ driver templated on the bus and clock policies
+ * @internal
+ *
+ * @copyright (C) 2017 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API_cpp MLX90632 C++ layer
+ *
+ * @details
+ * @link mlx90632::Mlx90632 @endlink provides the operations of mlx90632.h and mlx90632_extended_meas.h, but reaches
+ * the sensor through static functions of its template parameters instead of the link-time global functions of
+ * mlx90632_depends.h. Register accesses are direct calls which the compiler can inline, and sensors on different
+ * buses are simply different instantiations, without function pointers or trampolines.
+ *
+ * Bus policy needs to provide (same semantics as @link mlx90632_i2c_read @endlink and
+ * @link mlx90632_i2c_write @endlink):
+ * @code
+ * static int32_t read(int16_t register_address, uint16_t *value);
+ * static int32_t write(int16_t register_address, uint16_t value);
+ * @endcode
+ * Clock policy needs to provide (same semantics as usleep and msleep of mlx90632_depends.h):
+ * @code
+ * static void usleep(int min_range, int max_range);
+ * static void msleep(int msecs);
+ * @endcode
+ *
+ * Calibration parameters are held by value in the object. Temperature calculations call the DSP functions of the C
+ * library, so the library still needs to be linked, but mlx90632_depends.h functions are not needed. Requires
+ * C++11. Errors are returned as negative errno values, like in the C API; no exceptions are thrown.
+ * @{
+ */
+#ifndef _MLX90632_CPP_LIB_
+#define _MLX90632_CPP_LIB_
+
+#include <cerrno>
+#include <cstdint>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+
+namespace mlx90632 {
+
+/** MLX90632 on the bus Bus, with sleeping done by Clock
+ *
+ * @tparam Bus Policy with static read and write functions of one sensor register
+ * @tparam Clock Policy with static usleep and msleep functions
+ */
+template <class Bus, class Clock>
+class Mlx90632 {
+public:
+    /** Create driver with calibration parameters
+     *
+     * @param[in] calib Calibration parameters of the sensor, for example from @link read_calibration @endlink
+     */
+    explicit Mlx90632(const mlx90632_calib_t &calib = mlx90632_calib_t()) : calib_(calib)
+    {
+    }
+
+    /** Calibration parameters used by the calculations */
+    const mlx90632_calib_t &calib() const
+    {
+        return calib_;
+    }
+
+    /** Replace calibration parameters used by the calculations
+     *
+     * @param[in] calib Calibration parameters of the sensor
+     */
+    void set_calib(const mlx90632_calib_t &calib)
+    {
+        calib_ = calib;
+    }
+
+    /** Read calibration parameters from sensor EEPROM into the object
+     *
+     * 32-bit parameters are stored as two registers, lower word first.
+     *
+     * @retval 0 Successfully read
+     * @retval <0 Something went wrong. Check errno.h for more details
+     */
+    int32_t read_calibration()
+    {
+        mlx90632_calib_t calib;
+        int32_t ret;
+
+        if ((ret = read32(MLX90632_EE_P_R, &calib.P_R)) < 0 ||
+            (ret = read32(MLX90632_EE_P_G, &calib.P_G)) < 0 ||
+            (ret = read32(MLX90632_EE_P_T, &calib.P_T)) < 0 ||
+            (ret = read32(MLX90632_EE_P_O, &calib.P_O)) < 0 ||
+            (ret = read32(MLX90632_EE_Ea, &calib.Ea)) < 0 ||
+            (ret = read32(MLX90632_EE_Eb, &calib.Eb)) < 0 ||
+            (ret = read32(MLX90632_EE_Fa, &calib.Fa)) < 0 ||
+            (ret = read32(MLX90632_EE_Fb, &calib.Fb)) < 0 ||
+            (ret = read32(MLX90632_EE_Ga, &calib.Ga)) < 0 ||
+            (ret = read16(MLX90632_EE_Gb, &calib.Gb)) < 0 ||
+            (ret = read16(MLX90632_EE_Ka, &calib.Ka)) < 0 ||
+            (ret = read16(MLX90632_EE_Ha, &calib.Ha)) < 0 ||
+            (ret = read16(MLX90632_EE_Hb, &calib.Hb)) < 0)
+            return ret;
+
+        calib_ = calib;
+        return 0;
+    }
+
+    /** @see mlx90632_init */
+    static int32_t init()
+    {
+        int32_t ret;
+        uint16_t eeprom_version, reg_status;
+
+        ret = Bus::read(MLX90632_EE_VERSION, &eeprom_version);
+        if (ret < 0)
+            return ret;
+
+        if ((eeprom_version & 0x00FF) != MLX90632_DSPv5)
+            return -EPROTONOSUPPORT;
+
+        ret = Bus::read(MLX90632_REG_STATUS, &reg_status);
+        if (ret < 0)
+            return ret;
+
+        ret = Bus::write(MLX90632_REG_STATUS, reg_status & ~(MLX90632_STAT_DATA_RDY));
+        if (ret < 0)
+            return ret;
+
+        if ((eeprom_version & 0x7F00) == MLX90632_XTD_RNG_KEY)
+            return ERANGE;
+
+        return 0;
+    }
+
+    /** @see mlx90632_trigger_measurement */
+    static int32_t trigger_measurement()
+    {
+        uint16_t reg_status;
+        int32_t ret = Bus::read(MLX90632_REG_STATUS, &reg_status);
+
+        if (ret < 0)
+            return ret;
+
+        return Bus::write(MLX90632_REG_STATUS, reg_status & (~MLX90632_STAT_DATA_RDY));
+    }
+
+    /** @see mlx90632_wait_for_measurement */
+    static int32_t wait_for_measurement()
+    {
+        int tries = MLX90632_MAX_NUMBER_MESUREMENT_READ_TRIES;
+        uint16_t reg_status = 0;
+        int32_t ret;
+
+        while (tries-- > 0)
+        {
+            ret = Bus::read(MLX90632_REG_STATUS, &reg_status);
+            if (ret < 0)
+                return ret;
+            if (reg_status & MLX90632_STAT_DATA_RDY)
+                break;
+            Clock::usleep(10000, 11000);
+        }
+
+        if (tries < 0)
+            return -ETIMEDOUT;
+
+        return (reg_status & MLX90632_STAT_CYCLE_POS) >> 2;
+    }
+
+    /** @see mlx90632_poll_measurement */
+    static int32_t poll_measurement()
+    {
+        uint16_t reg_status;
+        int32_t ret = Bus::read(MLX90632_REG_STATUS, &reg_status);
+
+        if (ret < 0)
+            return ret;
+
+        if (!(reg_status & MLX90632_STAT_DATA_RDY))
+            return -EAGAIN;
+
+        return (reg_status & MLX90632_STAT_CYCLE_POS) >> 2;
+    }
+
+    /** @see mlx90632_start_measurement */
+    static int32_t start_measurement()
+    {
+        int32_t ret = trigger_measurement();
+
+        if (ret < 0)
+            return ret;
+
+        return wait_for_measurement();
+    }
+
+    /** @see mlx90632_trigger_measurement_burst */
+    static int32_t trigger_measurement_burst()
+    {
+        uint16_t reg;
+        int32_t ret = Bus::read(MLX90632_REG_CTRL, &reg);
+
+        if (ret < 0)
+            return ret;
+
+        return Bus::write(MLX90632_REG_CTRL, reg | MLX90632_START_BURST_MEAS);
+    }
+
+    /** @see mlx90632_wait_for_measurement_burst */
+    static int32_t wait_for_measurement_burst()
+    {
+        int tries = MLX90632_MAX_NUMBER_MESUREMENT_READ_TRIES;
+        uint16_t reg_status;
+        int32_t ret;
+
+        while (tries-- > 0)
+        {
+            ret = Bus::read(MLX90632_REG_STATUS, &reg_status);
+            if (ret < 0)
+                return ret;
+            if ((reg_status & MLX90632_STAT_BUSY) == 0)
+                break;
+            Clock::usleep(10000, 11000);
+        }
+
+        if (tries < 0)
+            return -ETIMEDOUT;
+
+        return 0;
+    }
+
+    /** @see mlx90632_start_measurement_burst */
+    static int32_t start_measurement_burst()
+    {
+        int32_t ret = trigger_measurement_burst();
+
+        if (ret < 0)
+            return ret;
+
+        ret = calculate_dataset_ready_time();
+        if (ret < 0)
+            return ret;
+        Clock::msleep(ret);
+
+        return wait_for_measurement_burst();
+    }
+
+    /** @see mlx90632_trigger_measurement_single */
+    static int32_t trigger_measurement_single()
+    {
+        uint16_t reg;
+        int32_t ret = trigger_measurement();
+
+        if (ret < 0)
+            return ret;
+
+        ret = Bus::read(MLX90632_REG_CTRL, &reg);
+        if (ret < 0)
+            return ret;
+
+        return Bus::write(MLX90632_REG_CTRL, reg | MLX90632_START_SINGLE_MEAS);
+    }
+
+    /** @see mlx90632_read_temp_raw_wo_wait */
+    static int32_t read_temp_raw_wo_wait(int32_t channel_position,
+                                         int16_t *ambient_new_raw, int16_t *ambient_old_raw,
+                                         int16_t *object_new_raw, int16_t *object_old_raw)
+    {
+        int32_t ret = read_temp_ambient_raw(ambient_new_raw, ambient_old_raw);
+
+        if (ret < 0)
+            return ret;
+
+        return read_temp_object_raw(channel_position, object_new_raw, object_old_raw);
+    }
+
+    /** @see mlx90632_read_temp_raw */
+    static int32_t read_temp_raw(int16_t *ambient_new_raw, int16_t *ambient_old_raw,
+                                 int16_t *object_new_raw, int16_t *object_old_raw)
+    {
+        int32_t ret = start_measurement();
+
+        if (ret < 0)
+            return ret;
+
+        return read_temp_raw_wo_wait(ret, ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw);
+    }
+
+    /** @see mlx90632_read_temp_raw_burst */
+    static int32_t read_temp_raw_burst(int16_t *ambient_new_raw, int16_t *ambient_old_raw,
+                                       int16_t *object_new_raw, int16_t *object_old_raw)
+    {
+        int32_t ret = start_measurement_burst();
+
+        if (ret < 0)
+            return ret;
+
+        return read_temp_raw_wo_wait(2, ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw);
+    }
+
+    /** @see mlx90632_read_temp_raw_extended_wo_wait */
+    static int32_t read_temp_raw_extended_wo_wait(int16_t *ambient_new_raw, int16_t *ambient_old_raw,
+                                                  int16_t *object_new_raw)
+    {
+        static const int16_t object_regs[6] = {
+            MLX90632_RAM_1(17), MLX90632_RAM_2(17), MLX90632_RAM_1(18),
+            MLX90632_RAM_2(18), MLX90632_RAM_1(19), MLX90632_RAM_2(19),
+        };
+        int16_t raw[6];
+        int32_t read;
+        int32_t ret;
+        int i;
+
+        ret = read16(MLX90632_RAM_3(17), ambient_new_raw);
+        if (ret < 0)
+            return ret;
+
+        ret = read16(MLX90632_RAM_3(18), ambient_old_raw);
+        if (ret < 0)
+            return ret;
+
+        for (i = 0; i < 6; ++i)
+        {
+            ret = read16(object_regs[i], &raw[i]);
+            if (ret < 0)
+                return ret;
+        }
+
+        read = ((raw[0] - raw[1] - raw[2] + raw[3]) / 2) + raw[4] + raw[5];
+        if (read > 32767 || read < -32768)
+            return -EINVAL;
+
+        *object_new_raw = (int16_t)read;
+
+        return ret;
+    }
+
+    /** @see mlx90632_read_temp_raw_extended */
+    static int32_t read_temp_raw_extended(int16_t *ambient_new_raw, int16_t *ambient_old_raw,
+                                          int16_t *object_new_raw)
+    {
+        int32_t ret = 0;
+        int tries = 3;
+
+        while (tries-- > 0)
+        {
+            ret = start_measurement();
+            if (ret < 0)
+                return ret;
+
+            if (ret == 19)
+                break;
+        }
+
+        if (tries < 0)
+            return -ETIMEDOUT;
+
+        return read_temp_raw_extended_wo_wait(ambient_new_raw, ambient_old_raw, object_new_raw);
+    }
+
+    /** @see mlx90632_read_temp_raw_extended_burst */
+    static int32_t read_temp_raw_extended_burst(int16_t *ambient_new_raw, int16_t *ambient_old_raw,
+                                                int16_t *object_new_raw)
+    {
+        int32_t ret = start_measurement_burst();
+
+        if (ret < 0)
+            return ret;
+
+        return read_temp_raw_extended_wo_wait(ambient_new_raw, ambient_old_raw, object_new_raw);
+    }
+
+    /** @see mlx90632_get_measurement_time */
+    static int32_t get_measurement_time(uint16_t meas)
+    {
+        uint16_t reg;
+        int32_t ret = Bus::read(meas, &reg);
+
+        if (ret < 0)
+            return ret;
+
+        reg &= MLX90632_EE_REFRESH_RATE_MASK;
+        reg = reg >> 8;
+
+        return MLX90632_MEAS_MAX_TIME >> reg;
+    }
+
+    /** @see mlx90632_calculate_dataset_ready_time */
+    static int32_t calculate_dataset_ready_time()
+    {
+        static const uint16_t medical[] = { MLX90632_EE_MEDICAL_MEAS1, MLX90632_EE_MEDICAL_MEAS2 };
+        static const uint16_t extended[] = {
+            MLX90632_EE_EXTENDED_MEAS1, MLX90632_EE_EXTENDED_MEAS2, MLX90632_EE_EXTENDED_MEAS3,
+        };
+        const uint16_t *meas;
+        int32_t refresh_time = 0;
+        int32_t ret;
+        int count, i;
+
+        ret = get_meas_type();
+        if (ret < 0)
+            return ret;
+
+        if (ret == MLX90632_MTYP_MEDICAL_BURST)
+        {
+            meas = medical;
+            count = 2;
+        }
+        else if (ret == MLX90632_MTYP_EXTENDED_BURST)
+        {
+            meas = extended;
+            count = 3;
+        }
+        else
+        {
+            return -EINVAL;
+        }
+
+        for (i = 0; i < count; ++i)
+        {
+            ret = get_measurement_time(meas[i]);
+            if (ret < 0)
+                return ret;
+            refresh_time += ret;
+        }
+
+        return refresh_time;
+    }
+
+    /** @see mlx90632_addressed_reset */
+    static int32_t addressed_reset()
+    {
+        uint16_t reg_ctrl;
+        uint16_t reg_value;
+        int32_t ret = Bus::read(MLX90632_REG_CTRL, &reg_value);
+
+        if (ret < 0)
+            return ret;
+
+        reg_ctrl = reg_value & ~MLX90632_CFG_PWR_MASK;
+        reg_ctrl |= MLX90632_PWR_STATUS_STEP;
+        ret = Bus::write(MLX90632_REG_CTRL, reg_ctrl);
+        if (ret < 0)
+            return ret;
+
+        ret = Bus::write(0x3005, MLX90632_RESET_CMD);
+        if (ret < 0)
+            return ret;
+
+        Clock::usleep(150, 200);
+
+        return Bus::write(MLX90632_REG_CTRL, reg_value);
+    }
+
+    /** @see mlx90632_set_refresh_rate */
+    static int32_t set_refresh_rate(mlx90632_meas_t measRate)
+    {
+        int32_t ret = set_refresh_rate_register(MLX90632_EE_MEDICAL_MEAS1, measRate);
+
+        if (ret < 0)
+            return ret;
+
+        return set_refresh_rate_register(MLX90632_EE_MEDICAL_MEAS2, measRate);
+    }
+
+    /** @see mlx90632_get_refresh_rate */
+    static mlx90632_meas_t get_refresh_rate()
+    {
+        uint16_t meas1;
+
+        if (Bus::read(MLX90632_EE_MEDICAL_MEAS1, &meas1) < 0)
+            return MLX90632_MEAS_HZ_ERROR;
+
+        return (mlx90632_meas_t)MLX90632_REFRESH_RATE(meas1);
+    }
+
+    /** @see mlx90632_get_channel_position */
+    static int32_t get_channel_position()
+    {
+        uint16_t reg_status;
+        int32_t ret = Bus::read(MLX90632_REG_STATUS, &reg_status);
+
+        if (ret < 0)
+            return ret;
+
+        return (reg_status & MLX90632_STAT_CYCLE_POS) >> 2;
+    }
+
+    /** @see mlx90632_set_meas_type */
+    static int32_t set_meas_type(uint8_t type)
+    {
+        uint16_t reg_ctrl;
+        int32_t ret;
+
+        if ((type != MLX90632_MTYP_MEDICAL) && (type != MLX90632_MTYP_EXTENDED) &&
+            (type != MLX90632_MTYP_MEDICAL_BURST) && (type != MLX90632_MTYP_EXTENDED_BURST))
+            return -EINVAL;
+
+        ret = addressed_reset();
+        if (ret < 0)
+            return ret;
+
+        ret = Bus::read(MLX90632_REG_CTRL, &reg_ctrl);
+        if (ret < 0)
+            return ret;
+
+        reg_ctrl = reg_ctrl & (~MLX90632_CFG_MTYP_MASK & ~MLX90632_CFG_PWR_MASK);
+        reg_ctrl |= (MLX90632_MTYP_STATUS(MLX90632_MEASUREMENT_TYPE_STATUS(type)) | MLX90632_PWR_STATUS_HALT);
+
+        ret = Bus::write(MLX90632_REG_CTRL, reg_ctrl);
+        if (ret < 0)
+            return ret;
+
+        ret = Bus::read(MLX90632_REG_CTRL, &reg_ctrl);
+        if (ret < 0)
+            return ret;
+
+        reg_ctrl = reg_ctrl & ~MLX90632_CFG_PWR_MASK;
+        if (MLX90632_MEASUREMENT_BURST_STATUS(type))
+            reg_ctrl |= MLX90632_PWR_STATUS_SLEEP_STEP;
+        else
+            reg_ctrl |= MLX90632_PWR_STATUS_CONTINUOUS;
+
+        return Bus::write(MLX90632_REG_CTRL, reg_ctrl);
+    }
+
+    /** @see mlx90632_get_meas_type */
+    static int32_t get_meas_type()
+    {
+        uint16_t reg_ctrl;
+        uint16_t reg_temp;
+        int32_t ret = Bus::read(MLX90632_REG_CTRL, &reg_temp);
+
+        if (ret < 0)
+            return ret;
+
+        reg_ctrl = MLX90632_MTYP(reg_temp);
+
+        if ((reg_ctrl != MLX90632_MTYP_MEDICAL) && (reg_ctrl != MLX90632_MTYP_EXTENDED))
+            return -EINVAL;
+
+        reg_temp = MLX90632_CFG_PWR(reg_temp);
+
+        if (reg_temp == MLX90632_PWR_STATUS_SLEEP_STEP)
+            return MLX90632_BURST_MEASUREMENT_TYPE(reg_ctrl);
+
+        if (reg_temp != MLX90632_PWR_STATUS_CONTINUOUS)
+            return -EINVAL;
+
+        return reg_ctrl;
+    }
+
+    /** Ambient temperature from raw values with the held calibration
+     *
+     * @see mlx90632_calc_temp_ambient
+     */
+    double calc_temp_ambient(int16_t ambient_new_raw, int16_t ambient_old_raw) const
+    {
+        return mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw,
+                                          calib_.P_T, calib_.P_R, calib_.P_G, calib_.P_O, calib_.Gb);
+    }
+
+    /** Object temperature from raw values with the held calibration
+     *
+     * Emissivity is the one set with @link mlx90632_set_emissivity @endlink.
+     *
+     * @see mlx90632_calc_temp_object
+     */
+    double calc_temp_object(int16_t ambient_new_raw, int16_t ambient_old_raw,
+                            int16_t object_new_raw, int16_t object_old_raw) const
+    {
+        double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib_.Gb);
+        double pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                            ambient_new_raw, ambient_old_raw, calib_.Ka);
+
+        return mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient, calib_.Ea, calib_.Eb,
+                                         calib_.Ga, calib_.Fa, calib_.Fb, calib_.Ha, calib_.Hb);
+    }
+
+#if MLX90632_ENABLE_REFLECTED
+    /** Object temperature from raw values with the held calibration and reflected temperature compensation
+     *
+     * @see mlx90632_calc_temp_object_reflected
+     */
+    double calc_temp_object_reflected(int16_t ambient_new_raw, int16_t ambient_old_raw,
+                                      int16_t object_new_raw, int16_t object_old_raw, double reflected) const
+    {
+        double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib_.Gb);
+        double pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                            ambient_new_raw, ambient_old_raw, calib_.Ka);
+
+        return mlx90632_calc_temp_object_reflected((int32_t)pre_object, (int32_t)pre_ambient, reflected,
+                                                   calib_.Ea, calib_.Eb, calib_.Ga, calib_.Fa, calib_.Fb,
+                                                   calib_.Ha, calib_.Hb);
+    }
+#endif
+
+#if MLX90632_ENABLE_EXTENDED
+    /** Ambient temperature in extended range from raw values with the held calibration
+     *
+     * @see mlx90632_calc_temp_ambient_extended
+     */
+    double calc_temp_ambient_extended(int16_t ambient_new_raw, int16_t ambient_old_raw) const
+    {
+        return mlx90632_calc_temp_ambient_extended(ambient_new_raw, ambient_old_raw,
+                                                   calib_.P_T, calib_.P_R, calib_.P_G, calib_.P_O, calib_.Gb);
+    }
+
+    /** Object temperature in extended range from raw values with the held calibration
+     *
+     * @see mlx90632_calc_temp_object_extended
+     */
+    double calc_temp_object_extended(int16_t ambient_new_raw, int16_t ambient_old_raw,
+                                     int16_t object_new_raw, double reflected) const
+    {
+        double pre_ambient = mlx90632_preprocess_temp_ambient_extended(ambient_new_raw, ambient_old_raw,
+                                                                       calib_.Gb);
+        double pre_object = mlx90632_preprocess_temp_object_extended(object_new_raw, ambient_new_raw,
+                                                                     ambient_old_raw, calib_.Ka);
+
+        return mlx90632_calc_temp_object_extended((int32_t)pre_object, (int32_t)pre_ambient, reflected,
+                                                  calib_.Ea, calib_.Eb, calib_.Ga, calib_.Fa, calib_.Fb,
+                                                  calib_.Ha, calib_.Hb);
+    }
+#endif
+
+    /** Trigger and wait for a measurement, read it and calculate temperatures
+     *
+     * @param[out] ambient Ambient temperature in degrees Celsius
+     * @param[out] object Object temperature in degrees Celsius
+     *
+     * @retval 0 Temperatures are valid
+     * @retval <0 Something went wrong. Check errno.h for more details
+     */
+    int32_t measure(double &ambient, double &object) const
+    {
+        int16_t ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw;
+        int32_t ret = read_temp_raw(&ambient_new_raw, &ambient_old_raw, &object_new_raw, &object_old_raw);
+
+        if (ret < 0)
+            return ret;
+
+        ambient = calc_temp_ambient(ambient_new_raw, ambient_old_raw);
+        object = calc_temp_object(ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw);
+
+        return 0;
+    }
+
+private:
+    static int32_t read16(int16_t register_address, int16_t *value)
+    {
+        uint16_t read_tmp;
+        int32_t ret = Bus::read(register_address, &read_tmp);
+
+        if (ret < 0)
+            return ret;
+        *value = (int16_t)read_tmp;
+
+        return ret;
+    }
+
+    static int32_t read32(int16_t register_address, int32_t *value)
+    {
+        uint16_t lsw, msw;
+        int32_t ret = Bus::read(register_address, &lsw);
+
+        if (ret < 0)
+            return ret;
+
+        ret = Bus::read(register_address + 1, &msw);
+        if (ret < 0)
+            return ret;
+
+        *value = (int32_t)(((uint32_t)msw << 16) | lsw);
+
+        return ret;
+    }
+
+    static int32_t read_temp_ambient_raw(int16_t *ambient_new_raw, int16_t *ambient_old_raw)
+    {
+        int32_t ret = read16(MLX90632_RAM_3(1), ambient_new_raw);
+
+        if (ret < 0)
+            return ret;
+
+        return read16(MLX90632_RAM_3(2), ambient_old_raw);
+    }
+
+    static int32_t read_temp_object_raw(int32_t channel_position, int16_t *object_new_raw, int16_t *object_old_raw)
+    {
+        int16_t ram1, ram2;
+        int32_t ret;
+        int channel, channel_old;
+
+        switch (channel_position)
+        {
+            case 1:
+                channel = 1;
+                channel_old = 2;
+                break;
+
+            case 2:
+                channel = 2;
+                channel_old = 1;
+                break;
+
+            default:
+                return -EINVAL;
+        }
+
+        if ((ret = read16(MLX90632_RAM_2(channel), &ram2)) < 0 ||
+            (ret = read16(MLX90632_RAM_1(channel), &ram1)) < 0)
+            return ret;
+        *object_new_raw = (ram2 + ram1) / 2;
+
+        if ((ret = read16(MLX90632_RAM_2(channel_old), &ram2)) < 0 ||
+            (ret = read16(MLX90632_RAM_1(channel_old), &ram1)) < 0)
+            return ret;
+        *object_old_raw = (ram2 + ram1) / 2;
+
+        return ret;
+    }
+
+    static int32_t set_refresh_rate_register(uint16_t meas, mlx90632_meas_t measRate)
+    {
+        uint16_t reg;
+        uint16_t new_value;
+        int32_t ret = Bus::read(meas, &reg);
+
+        if (ret < 0)
+            return ret;
+
+        new_value = MLX90632_NEW_REG_VALUE(reg, measRate, MLX90632_EE_REFRESH_RATE_START,
+                                           MLX90632_EE_REFRESH_RATE_SHIFT);
+        if (reg == new_value)
+            return ret;
+
+        return write_eeprom(meas, new_value);
+    }
+
+    static int32_t wait_for_eeprom_not_busy()
+    {
+        uint16_t reg_status;
+        int32_t ret = Bus::read(MLX90632_REG_STATUS, &reg_status);
+
+        while (ret >= 0 && reg_status & MLX90632_STAT_EE_BUSY)
+            ret = Bus::read(MLX90632_REG_STATUS, &reg_status);
+
+        return ret;
+    }
+
+    static int32_t write_eeprom(uint16_t address, uint16_t data)
+    {
+        int32_t ret;
+
+        // erase, then write, each after unlocking with the key
+        if ((ret = Bus::write(0x3005, MLX90632_EEPROM_WRITE_KEY)) < 0 ||
+            (ret = Bus::write(address, 0x00)) < 0 ||
+            (ret = wait_for_eeprom_not_busy()) < 0 ||
+            (ret = Bus::write(0x3005, MLX90632_EEPROM_WRITE_KEY)) < 0 ||
+            (ret = Bus::write(address, data)) < 0)
+            return ret;
+
+        return wait_for_eeprom_not_busy();
+    }
+
+    mlx90632_calib_t calib_;
+};
+
+} // namespace mlx90632
+
+///@}
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * @file mlx90632_ambient_state.h
+ * @brief MLX90632 object temperature calculation with terms of ambient temperature cached
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Ambient temperature changes much slower than object temperature, but @link mlx90632_calc_temp_object @endlink
+ * calculates die temperature, its fourth power and the ambient part of the gain again for every object sample and
+ * in each of its iterations. Here the calculation is split in two: @link mlx90632_ambient_state_update @endlink
+ * calculates everything which depends only on ambient raw values, calibration and emissivity, and
+ * @link mlx90632_calc_temp_object_cached @endlink solves object temperature from it with only the terms which
+ * depend on object temperature left in the iterations. State is reused while ambient raw values and emissivity do
+ * not change.
+ *
+ * Results equal @link mlx90632_calc_temp_ambient @endlink and @link mlx90632_calc_temp_object @endlink with
+ * preprocessed values truncated to integer, up to rounding of the reordered calculations.
+ */
+#ifndef _MLX90632_AMBIENT_STATE_LIB_
+#define _MLX90632_AMBIENT_STATE_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Terms of object temperature calculation which depend only on ambient temperature */
+typedef struct mlx90632_ambient_state_s {
+    const mlx90632_calib_t *calib; /**< Calibration the state was calculated with */
+    double emissivity; /**< Emissivity the state was calculated with */
+    int16_t ambient_new_raw; /**< Ambient raw value the state was calculated from */
+    int16_t ambient_old_raw; /**< Ambient raw value the state was calculated from */
+    double ambient; /**< Ambient temperature in degrees Celsius */
+    int32_t pre_ambient; /**< Preprocessed ambient temperature */
+    double VR_IR; /**< Denominator of object preprocessing */
+    double TAdut4; /**< Fourth power of die temperature in Kelvin */
+    double Gb; /**< Gain terms which do not depend on object temperature */
+    double kGa; /**< Object temperature coefficient of the gain */
+    double Alpha; /**< Object gain including customer gain and emissivity */
+    double Hb_customer; /**< Customer offset in degrees Celsius */
+} mlx90632_ambient_state_t;
+
+/** Invalidate state, so that next update recalculates it
+ *
+ * Needed only when calibration parameters change in place, as changes of calibration pointer, ambient raw values
+ * and emissivity are detected by @link mlx90632_ambient_state_update @endlink.
+ *
+ * @param[out] state Pointer to the state
+ */
+void mlx90632_ambient_state_invalidate(mlx90632_ambient_state_t *state);
+
+/** Update state for new ambient raw values
+ *
+ * State is recalculated only when ambient raw values, calibration pointer or emissivity set with
+ * @link mlx90632_set_emissivity @endlink differ from the ones it was calculated with. Calibration is referenced
+ * by the state, so it needs to stay valid while the state is used.
+ *
+ * @param[in,out] state Pointer to the state, invalidated before first use
+ * @param[in] ambient_new_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] ambient_old_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] calib Pointer to calibration parameters
+ *
+ * @retval 0 State was reused
+ * @retval 1 State was recalculated
+ */
+int32_t mlx90632_ambient_state_update(mlx90632_ambient_state_t *state, int16_t ambient_new_raw,
+                                      int16_t ambient_old_raw, const mlx90632_calib_t *calib);
+
+/** Calculate object temperature with cached ambient terms
+ *
+ * @param[in] state Pointer to the state updated with ambient raw values of the same measurement
+ * @param[in] object_new_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ * @param[in] object_old_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ *
+ * @return Calculated object temperature in degrees Celsius
+ */
+double mlx90632_calc_temp_object_cached(const mlx90632_ambient_state_t *state, int16_t object_new_raw,
+                                        int16_t object_old_raw);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
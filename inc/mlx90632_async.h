@@ -0,0 +1,112 @@
+/**
+ * @file mlx90632_async.h
+ * @brief MLX90632 raw reads over asynchronous i2c transfers
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Counterparts of the raw read functions for interrupt or DMA driven i2c controllers. Instead of one blocking
+ * register read after the other, RAM words of the measurement are read in a single transfer handed to
+ * @link mlx90632_i2c_submit @endlink, and the function returns at once. When the backend completes the transfer the
+ * raw values are extracted into @link mlx90632_async_t @endlink and its done callback is called. CPU is free while
+ * the words are on the wire, so with two of them the temperature of the previous sample can be calculated while
+ * the next one is read.
+ *
+ * Done callback runs in the context in which the backend completes the transfer, which is usually an interrupt
+ * handler, so it should only hand the sample over. mlx90632.h and mlx90632_depends.h need to be included before this
+ * file.
+ */
+#ifndef _MLX90632_ASYNC_LIB_
+#define _MLX90632_ASYNC_LIB_
+
+#include "mlx90632_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_ASYNC_WORDS 8 /**< RAM words read by the largest asynchronous read, extended measurements 17 to 19 */
+
+typedef struct mlx90632_async_s mlx90632_async_t;
+
+/** Callback called when an asynchronous read is finished
+ *
+ * @param[in] async Pointer to the read which is finished, raw values in it are valid when status is 0
+ * @param[in] status 0 for success, <0 for failure. Check errno.h for more details
+ */
+typedef void (*mlx90632_async_cb_t)(mlx90632_async_t *async, int32_t status);
+
+/** Asynchronous raw read in progress and its result */
+struct mlx90632_async_s {
+    mlx90632_i2c_xfer_t xfer; /**< Transfer handed to the backend, must stay the first member */
+    uint16_t ram[MLX90632_ASYNC_WORDS]; /**< Buffer of the transfer */
+    int32_t channel_position; /**< Channel position of the new medical measurement, 19 for extended range */
+    int16_t ambient_new_raw; /**< New raw ambient temperature */
+    int16_t ambient_old_raw; /**< Old raw ambient temperature */
+    int16_t object_new_raw; /**< New raw object temperature */
+    int16_t object_old_raw; /**< Old raw object temperature, 0 for extended range */
+    mlx90632_async_cb_t done; /**< Called once the raw values are extracted or the transfer failed */
+    void *context; /**< Pointer for the caller, not used by the library */
+};
+
+/** Start reading raw ambient and object temperature when measurement data is ready
+ *
+ * Asynchronous counterpart of @link mlx90632_read_temp_raw_wo_wait @endlink. All six RAM words of both medical
+ * measurements are read in one transfer, raw values are the same as of the blocking function.
+ *
+ * @param[out] async Pointer to read state, owned by the library until done is called
+ * @param[in] channel_position Channel position where new (recently updated) measurement can be found
+ * @param[in] done Callback called when the read is finished
+ * @param[in] context Pointer stored in async for the callback
+ *
+ * @retval 0 Transfer was submitted, done will be called
+ * @retval -EINVAL Channel position is not 1 or 2
+ * @retval <0 Transfer was not submitted and done will not be called. Check errno.h for more details
+ *
+ * @note This function is not blocking!
+ */
+int32_t mlx90632_read_temp_raw_wo_wait_async(mlx90632_async_t *async, int32_t channel_position,
+                                             mlx90632_async_cb_t done, void *context);
+
+#if MLX90632_ENABLE_EXTENDED
+/** Start reading raw ambient and object temperature for extended range when measurement data is ready
+ *
+ * Asynchronous counterpart of @link mlx90632_read_temp_raw_extended_wo_wait @endlink. All eight RAM words of
+ * extended measurements 17 to 19 are read in one transfer. Raw object value which does not fit in 16 bits
+ * completes the read with -EINVAL, like the blocking function.
+ *
+ * @param[out] async Pointer to read state, owned by the library until done is called
+ * @param[in] done Callback called when the read is finished
+ * @param[in] context Pointer stored in async for the callback
+ *
+ * @retval 0 Transfer was submitted, done will be called
+ * @retval <0 Transfer was not submitted and done will not be called. Check errno.h for more details
+ *
+ * @note This function is not blocking!
+ */
+int32_t mlx90632_read_temp_raw_extended_wo_wait_async(mlx90632_async_t *async, mlx90632_async_cb_t done,
+                                                      void *context);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
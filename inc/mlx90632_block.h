@@ -0,0 +1,78 @@
+/**
+ * @file mlx90632_block.h
+ * @brief MLX90632 raw reads of status register and medical RAM in one block read
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Functions in this file require @link mlx90632_i2c_read_block @endlink and @link mlx90632_get_time_us @endlink to
+ * be implemented. They are in their own object, so applications which use only @link mlx90632_sample.h @endlink do
+ * not need a block read. mlx90632_sample.h needs to be included before this file.
+ */
+#ifndef _MLX90632_BLOCK_LIB_
+#define _MLX90632_BLOCK_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Read status register and all medical RAM in one transaction, keep the sample only when data is ready
+ *
+ * Replaces the status poll and six RAM reads of continuous medical mode with one block read of
+ * @link MLX90632_REG_STATUS @endlink through @link MLX90632_RAM_3 @endlink (2), which relies on the sensor
+ * incrementing register address from status register into RAM within one read. When data ready is not set the block
+ * is discarded, so the read is speculative and is meant to be issued at the expected data ready time. When it is set,
+ * data ready is cleared with a write of the status register and the sample is filled as by
+ * @link mlx90632_read_temp_raw_wo_wait @endlink with the channel position of the status register.
+ *
+ * @param[out] sample Pointer to sample which is filled
+ *
+ * @retval 0 Successfully read both temperatures
+ * @retval -EAGAIN Data is not ready yet, sample is unchanged
+ * @retval -EINVAL Sensor is not in medical measurement mode, channel position is not 1 or 2
+ * @retval <0 Something went wrong. Check errno.h for more details
+ *
+ * @note This function is not blocking!
+ */
+int32_t mlx90632_read_temp_raw_block_sample(mlx90632_sample_t *sample);
+
+/** Capture consecutive measurement cycles in medical continuous mode with one block read per sample
+ *
+ * Same as @link mlx90632_capture @endlink, but every sample is read with
+ * @link mlx90632_read_temp_raw_block_sample @endlink. Each read is scheduled slightly less than one measurement
+ * after the previous one, so it mostly finds the data ready and the sample costs one block read and one status write.
+ * A read which comes too early is retried with a short interval, which also realigns the schedule to the sensor.
+ *
+ * @param[out] buf Pointer to array of at least n samples which is filled
+ * @param[in] n Number of samples to capture
+ * @param[out] stats Pointer to where capture statistics are written
+ *
+ * @retval 0 Successfully captured n samples
+ * @retval <0 Something went wrong. Check errno.h for more details. Samples captured so far are in buf
+ *
+ * @note This function is using usleep so it is blocking for about n measurement cycles!
+ */
+int32_t mlx90632_capture_block(mlx90632_sample_t *buf, uint32_t n, mlx90632_capture_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
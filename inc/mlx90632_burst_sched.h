@@ -0,0 +1,108 @@
+/**
+ * @file mlx90632_burst_sched.h
+ * @brief MLX90632 duty-cycled burst measurement scheduler
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * In sleeping step mode (see @link mlx90632_set_meas_type @endlink with burst measurement types) the sensor
+ * sleeps between the bursts, so the lowest energy per sample is reached when the host sleeps as well. The
+ * scheduler below never blocks: each call does the work which is due and returns the time at which it wants to
+ * be called again, so the host can enter its own low-power state in between.
+ *
+ * Functions in this file require @link mlx90632_get_time_us @endlink to be implemented.
+ */
+#ifndef _MLX90632_BURST_SCHED_LIB_
+#define _MLX90632_BURST_SCHED_LIB_
+
+#include "mlx90632_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_BURST_SCHED_POLL_TIME 1000 /**< Retry interval in us when sensor is still busy at ready time. Retries
+                                             * stop one dataset time after ready time */
+
+/** State of the duty-cycled burst scheduler */
+typedef struct mlx90632_burst_sched_s {
+    uint64_t period_us; /**< Time between two burst triggers in microseconds */
+    uint64_t next_trigger_us; /**< Time at which next burst is triggered */
+    uint64_t ready_us; /**< Time at which triggered burst is expected to be complete */
+    uint32_t dataset_time_us; /**< Time needed to refresh the whole measurement table in microseconds */
+    uint32_t bus_time_us; /**< Time spent in register accesses for the sample in progress */
+    uint32_t cpu_time_us; /**< CPU active time accumulated for the sample in progress */
+    uint32_t last_bus_time_us; /**< Bus active time needed for the last completed sample */
+    uint32_t last_cpu_time_us; /**< CPU active time needed for the last completed sample */
+    uint16_t reg_ctrl; /**< Cached control register value without SOB bit */
+    uint8_t meas_type; /**< @link MLX90632_MTYP_MEDICAL_BURST @endlink or @link MLX90632_MTYP_EXTENDED_BURST @endlink */
+    uint8_t pending; /**< Burst was triggered and its data was not read yet */
+} mlx90632_burst_sched_t;
+
+#if MLX90632_ENABLE_BURST
+/** Initialize the burst scheduler
+ *
+ * Reads measurement type, dataset ready time and control register once, so that later triggers and reads need
+ * no configuration accesses. First burst is due immediately.
+ *
+ * @param[out] sched Pointer to scheduler state to initialize
+ * @param[in] period_ms Time between two samples in milliseconds. It must not be shorter than dataset ready time
+ *
+ * @retval 0 Successfully initialized scheduler
+ * @retval -EINVAL Sensor is not in burst measurement type or period is too short
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_burst_sched_init(mlx90632_burst_sched_t *sched, uint32_t period_ms);
+
+/** Run the burst scheduler
+ *
+ * Does the work which is due at the time of the call and returns immediately. A burst is triggered with a single
+ * control register write when the period has elapsed. Once its dataset ready time has passed the status register
+ * is read once and, if sensor is not busy anymore, raw values are read. If sensor is still busy one dataset time
+ * after ready time, the burst is dropped and the next one is triggered at its usual time. Sensor returns to sleep by
+ * itself after the burst. Bus and CPU active time needed for the sample are available in @link mlx90632_burst_sched_s::last_bus_time_us
+ * @endlink and @link mlx90632_burst_sched_s::last_cpu_time_us @endlink once it is completed.
+ *
+ * @param[in,out] sched Pointer to scheduler state
+ * @param[out] ambient_new_raw Pointer to where new raw ambient temperature is written
+ * @param[out] ambient_old_raw Pointer to where old raw ambient temperature is written
+ * @param[out] object_new_raw Pointer to where new raw object temperature is written
+ * @param[out] object_old_raw Pointer to where old raw object temperature is written. It is not written for
+ *                            @link MLX90632_MTYP_EXTENDED_BURST @endlink
+ * @param[out] wakeup_us Pointer to where time of the next call is written, in @link mlx90632_get_time_us @endlink time
+ *
+ * @retval 1 New raw values were written
+ * @retval 0 Nothing to read yet, call again at wakeup_us
+ * @retval -ETIMEDOUT Sensor was still busy one dataset time after the burst should have been complete
+ * @retval <0 Something went wrong. Check errno.h for more details
+ *
+ * @note This function is not blocking!
+ */
+int32_t mlx90632_burst_sched_run(mlx90632_burst_sched_t *sched,
+                                 int16_t *ambient_new_raw, int16_t *ambient_old_raw,
+                                 int16_t *object_new_raw, int16_t *object_old_raw,
+                                 uint64_t *wakeup_us);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * @file mlx90632_config.h
+ * @brief MLX90632 driver library build configuration
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Every feature is enabled by default. Products which do not use a feature can strip it from the library by
+ * defining its macro to 0 for the library and application build, for example with
+ * `-DMLX90632_ENABLE_EXTENDED=0`. Functions of a disabled feature are not declared, so a call to them is a compile
+ * error instead of a surprise at link time. Medical continuous and single measurements are always available.
+ *
+ * `make size` reports footprint of the library for the most common configurations.
+ * @{
+ */
+#ifndef _MLX90632_CONFIG_LIB_
+#define _MLX90632_CONFIG_LIB_
+
+#ifndef MLX90632_ENABLE_EXTENDED
+#define MLX90632_ENABLE_EXTENDED 1 /**< Extended range measurement reads and calculations */
+#endif
+
+#ifndef MLX90632_ENABLE_BURST
+#define MLX90632_ENABLE_BURST 1 /**< Sleeping step (burst) measurements and burst scheduler */
+#endif
+
+#ifndef MLX90632_ENABLE_EEPROM_WRITE
+#define MLX90632_ENABLE_EEPROM_WRITE 1 /**< EEPROM write support, used to change refresh rate */
+#endif
+
+#ifndef MLX90632_ENABLE_REFLECTED
+#define MLX90632_ENABLE_REFLECTED 1 /**< Object temperature with reflected temperature compensation (medical range) */
+#endif
+
+///@}
+
+#endif
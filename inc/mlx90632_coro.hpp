@@ -0,0 +1,538 @@
+/**
+ * @file mlx90632_coro.hpp
+ * @brief MLX90632 C++20 coroutine layer for asynchronous acquisition
+ * @internal
+ *
+ * @copyright (C) 2017 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API_cpp MLX90632 C++ layer
+ * @brief Optional header-only C++ wrappers over the C API
+ *
+ * @details
+ * `co_await sensor.read()` triggers a measurement with @link mlx90632_trigger_measurement @endlink, suspends until
+ * the expected data ready time, checks it with @link mlx90632_poll_measurement @endlink and returns a
+ * @link mlx90632::Sample @endlink. Waiting is done by @link mlx90632::Executor @endlink, so no thread is blocked in
+ * usleep and a small pool of threads can drive many sensors.
+ *
+ * The C library reaches the sensor through the global functions of mlx90632_depends.h. Register accesses of all
+ * sensors which share those functions (one i2c bus) are serialized by one @link mlx90632::AsyncMutex @endlink, which
+ * suspends the waiting coroutine instead of blocking its thread. When the functions operate on a per-thread
+ * selected device (like the Linux i2c-dev backend), the select callback of the sensor is called after the bus is
+ * locked and sensors on different buses use different mutexes.
+ *
+ * Requires C++20 and linking with the C library. Errors are reported in @link mlx90632::Sample::status @endlink as
+ * negative errno values, like in the C API; no exceptions are thrown.
+ * @{
+ */
+#ifndef _MLX90632_CORO_LIB_
+#define _MLX90632_CORO_LIB_
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "mlx90632.h"
+
+#define MLX90632_CORO_RETRY_TIME 500 /**< Time in us after which data ready is checked again */
+
+namespace mlx90632 {
+
+using Clock = std::chrono::steady_clock;
+
+/** Thread pool which resumes coroutines as soon as possible or at a given time */
+class Executor {
+public:
+    /** Start the worker threads
+     *
+     * @param[in] threads Number of worker threads
+     */
+    explicit Executor(unsigned threads = 1)
+    {
+        for (unsigned i = 0; i < threads; ++i)
+            workers_.emplace_back([this] { run(); });
+    }
+
+    /** Stop the worker threads and destroy coroutines which did not complete
+     *
+     * Scheduled coroutines are not resumed anymore. Coroutines started with @link mlx90632::spawn @endlink are
+     * destroyed, which also destroys the tasks they await, so their frames and locals are released.
+     */
+    ~Executor()
+    {
+        std::vector<void *> roots;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto &worker : workers_)
+            worker.join();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            roots.assign(roots_.begin(), roots_.end());
+            roots_.clear();
+        }
+        // Scheduled handles may be tasks owned by a spawned coroutine, so only the outermost frame is destroyed
+        for (void *root : roots)
+            std::coroutine_handle<>::from_address(root).destroy();
+    }
+
+    Executor(const Executor &) = delete;
+    Executor &operator=(const Executor &) = delete;
+
+    /** Resume coroutine on a worker thread at given time */
+    void schedule_at(Clock::time_point time, std::coroutine_handle<> handle)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push(Entry{ time, seq_++, handle });
+        }
+        cv_.notify_one();
+    }
+
+    /** Resume coroutine on a worker thread as soon as possible */
+    void post(std::coroutine_handle<> handle)
+    {
+        schedule_at(Clock::time_point::min(), handle);
+    }
+
+    /** Awaitable which resumes the awaiting coroutine at given time */
+    auto sleep_until(Clock::time_point time)
+    {
+        struct Awaiter {
+            Executor &executor;
+            Clock::time_point time;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { executor.schedule_at(time, handle); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{ *this, time };
+    }
+
+    /** Awaitable which resumes the awaiting coroutine after given time */
+    template <typename Rep, typename Period>
+    auto sleep_for(std::chrono::duration<Rep, Period> duration)
+    {
+        return sleep_until(Clock::now() + duration);
+    }
+
+    /** Awaitable which moves the awaiting coroutine to a worker thread */
+    auto schedule()
+    {
+        return sleep_until(Clock::time_point::min());
+    }
+
+private:
+    friend struct Detached;
+
+    /** Remember coroutine started by spawn until it completes */
+    void attach(std::coroutine_handle<> handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        roots_.insert(handle.address());
+    }
+
+    void detach(std::coroutine_handle<> handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        roots_.erase(handle.address());
+    }
+
+    struct Entry {
+        Clock::time_point time;
+        uint64_t seq;
+        std::coroutine_handle<> handle;
+        bool operator>(const Entry &other) const
+        {
+            return time != other.time ? time > other.time : seq > other.seq;
+        }
+    };
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        while (!stop_)
+        {
+            if (queue_.empty())
+            {
+                cv_.wait(lock);
+                continue;
+            }
+
+            Entry entry = queue_.top();
+            if (entry.time > Clock::now())
+            {
+                cv_.wait_until(lock, entry.time);
+                continue;
+            }
+
+            queue_.pop();
+            lock.unlock();
+            entry.handle.resume();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > queue_;
+    uint64_t seq_ = 0;
+    bool stop_ = false;
+    std::unordered_set<void *> roots_;
+    std::vector<std::thread> workers_;
+};
+
+/** Lazily started coroutine which produces a value of type T when awaited */
+template <typename T>
+class Task {
+public:
+    struct promise_type {
+        T value{};
+        std::coroutine_handle<> continuation;
+
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept
+        {
+            struct Final {
+                bool await_ready() const noexcept { return false; }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+                {
+                    if (handle.promise().continuation)
+                        return handle.promise().continuation;
+                    return std::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+            return Final{};
+        }
+        void return_value(T result) { value = std::move(result); }
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+    ~Task()
+    {
+        if (handle_)
+            handle_.destroy();
+    }
+
+    auto operator co_await() && noexcept
+    {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+            {
+                handle.promise().continuation = continuation;
+                return handle;
+            }
+            T await_resume() { return std::move(handle.promise().value); }
+        };
+        return Awaiter{ handle_ };
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/** Coroutine which runs to completion on its own, see @link mlx90632::spawn @endlink */
+struct Detached {
+    struct promise_type {
+        Executor *executor = nullptr;
+
+        promise_type() = default;
+        /** Coroutine whose first parameter is an executor is destroyed with it when it did not complete */
+        template <typename... Args>
+        explicit promise_type(Executor &owner, Args &...) : executor(&owner) {}
+        ~promise_type()
+        {
+            if (executor)
+                executor->detach(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        Detached get_return_object()
+        {
+            if (executor)
+                executor->attach(std::coroutine_handle<promise_type>::from_promise(*this));
+            return {};
+        }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+/** Run task on executor and pass its result to done
+ *
+ * @param[in] executor Executor on which the task starts
+ * @param[in] task Task to run
+ * @param[in] done Function called with the result of the task
+ */
+template <typename T, typename F>
+Detached spawn(Executor &executor, Task<T> task, F done)
+{
+    co_await executor.schedule();
+    done(co_await std::move(task));
+}
+
+/** Mutex which suspends the coroutine waiting for it instead of blocking the thread */
+class AsyncMutex {
+public:
+    /** Create unlocked mutex
+     *
+     * @param[in] executor Executor on which the next waiter is resumed when mutex is unlocked
+     */
+    explicit AsyncMutex(Executor &executor) : executor_(executor) {}
+
+    AsyncMutex(const AsyncMutex &) = delete;
+    AsyncMutex &operator=(const AsyncMutex &) = delete;
+
+    /** Owner of a locked mutex, which unlocks it when destroyed */
+    class Guard {
+    public:
+        explicit Guard(AsyncMutex *mutex) : mutex_(mutex) {}
+        Guard(Guard &&other) noexcept : mutex_(std::exchange(other.mutex_, nullptr)) {}
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+        ~Guard() { unlock(); }
+
+        /** Unlock the mutex before the guard is destroyed */
+        void unlock()
+        {
+            if (mutex_)
+                std::exchange(mutex_, nullptr)->unlock();
+        }
+
+    private:
+        AsyncMutex *mutex_;
+    };
+
+    /** Awaitable which resumes with a @link Guard @endlink once the mutex is locked */
+    auto lock()
+    {
+        struct Awaiter {
+            AsyncMutex &mutex;
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                std::lock_guard<std::mutex> lock(mutex.mutex_);
+                if (!mutex.locked_)
+                {
+                    mutex.locked_ = true;
+                    return false;
+                }
+                mutex.waiters_.push_back(handle);
+                return true;
+            }
+            Guard await_resume() { return Guard(&mutex); }
+        };
+        return Awaiter{ *this };
+    }
+
+private:
+    void unlock()
+    {
+        std::coroutine_handle<> next;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (waiters_.empty())
+            {
+                locked_ = false;
+                return;
+            }
+            // Ownership passes directly to the next waiter
+            next = waiters_.front();
+            waiters_.pop_front();
+        }
+        executor_.post(next);
+    }
+
+    Executor &executor_;
+    std::mutex mutex_;
+    bool locked_ = false;
+    std::deque<std::coroutine_handle<> > waiters_;
+};
+
+/** Result of one measurement */
+struct Sample {
+    int32_t status; /**< 0 when temperatures are valid, <0 error from errno.h otherwise */
+    double ambient; /**< Ambient temperature in degrees Celsius */
+    double object; /**< Object temperature in degrees Celsius */
+    Clock::time_point time; /**< Time at which the measurement was seen complete */
+};
+
+/** Sensor in continuous medical mode read from coroutines */
+class Sensor {
+public:
+    /** Create sensor
+     *
+     * @param[in] executor Executor on which the sensor waits
+     * @param[in] bus Mutex of the bus the sensor is connected to
+     * @param[in] calib Calibration parameters of the sensor
+     * @param[in] select Function called after the bus is locked, before the sensor is accessed
+     */
+    Sensor(Executor &executor, AsyncMutex &bus, const mlx90632_calib_t &calib, std::function<void()> select = {})
+        : executor_(executor), bus_(bus), calib_(calib), select_(std::move(select))
+    {
+    }
+
+    /** Trigger a measurement and complete it asynchronously
+     *
+     * The first read also reads the measurement times of both medical measurements.
+     *
+     * @return Sample with calculated temperatures or error status
+     */
+    Task<Sample> read()
+    {
+        Sample sample{ 0, 0.0, 0.0, Clock::now() };
+        int16_t ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw;
+        int32_t ret;
+
+        uint32_t wait_us;
+        int tries;
+
+        // Measurement times and cycle position are shared by all reads of the sensor, so only used under the lock
+        {
+            auto guard = co_await bus_.lock();
+            select();
+
+            ret = init();
+            if (ret >= 0)
+                ret = mlx90632_trigger_measurement();
+            if (ret < 0)
+            {
+                sample.status = ret;
+                co_return sample;
+            }
+            wait_us = next_measurement_time();
+            tries = (int)((period_us_[0] + period_us_[1]) / MLX90632_CORO_RETRY_TIME) + 1;
+        }
+
+        co_await executor_.sleep_for(std::chrono::microseconds(wait_us));
+
+        for (;;)
+        {
+            auto guard = co_await bus_.lock();
+            select();
+
+            ret = mlx90632_poll_measurement();
+            if (ret >= 0)
+            {
+                sample.time = Clock::now();
+                cycle_pos_ = (uint8_t)ret;
+                ret = mlx90632_read_temp_raw_wo_wait(ret, &ambient_new_raw, &ambient_old_raw,
+                                                     &object_new_raw, &object_old_raw);
+                break;
+            }
+            if ((ret != -EAGAIN) || (--tries == 0))
+                break;
+
+            guard.unlock();
+            co_await executor_.sleep_for(std::chrono::microseconds(MLX90632_CORO_RETRY_TIME));
+        }
+
+        if (ret == -EAGAIN)
+            ret = -ETIMEDOUT;
+        if (ret < 0)
+        {
+            sample.status = ret;
+            co_return sample;
+        }
+
+        // Calculation needs no bus access, so it runs after the bus is released
+        sample.ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw,
+                                                    calib_.P_T, calib_.P_R, calib_.P_G, calib_.P_O, calib_.Gb);
+        double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib_.Gb);
+        double pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                            ambient_new_raw, ambient_old_raw, calib_.Ka);
+        sample.object = mlx90632_calc_temp_object(pre_object, pre_ambient, calib_.Ea, calib_.Eb, calib_.Ga,
+                                                  calib_.Fa, calib_.Fb, calib_.Ha, calib_.Hb);
+        co_return sample;
+    }
+
+private:
+    void select()
+    {
+        if (select_)
+            select_();
+    }
+
+    /** Read measurement times once, bus must be locked */
+    int32_t init()
+    {
+        int32_t ret;
+
+        if (period_us_[0] != 0)
+            return 0;
+
+        ret = mlx90632_get_measurement_time(MLX90632_EE_MEDICAL_MEAS1);
+        if (ret < 0)
+            return ret;
+        uint32_t meas1 = (uint32_t)ret * 1000;
+
+        ret = mlx90632_get_measurement_time(MLX90632_EE_MEDICAL_MEAS2);
+        if (ret < 0)
+            return ret;
+
+        period_us_[1] = (uint32_t)ret * 1000;
+        period_us_[0] = meas1;
+        return 0;
+    }
+
+    /** Duration of the measurement following the last one, the longer one when it is not known, bus must be locked */
+    uint32_t next_measurement_time() const
+    {
+        if (cycle_pos_ == 1)
+            return period_us_[1];
+        if (cycle_pos_ == 2)
+            return period_us_[0];
+        return std::max(period_us_[0], period_us_[1]);
+    }
+
+    Executor &executor_;
+    AsyncMutex &bus_;
+    mlx90632_calib_t calib_;
+    std::function<void()> select_;
+    // Measurement times and cycle position are guarded by bus_
+    uint32_t period_us_[2] = { 0, 0 };
+    uint8_t cycle_pos_ = 0;
+};
+
+} // namespace mlx90632
+
+///@}
+#endif
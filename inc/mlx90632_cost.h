@@ -0,0 +1,167 @@
+/**
+ * @file mlx90632_cost.h
+ * @brief MLX90632 bus cost model of the acquisition functions
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Cost model predicts how many sensors fit on one bus before it is deployed. It knows the register accesses which
+ * each acquisition function does per sample, when called in a loop, and the measurement time of every
+ * measurement of the sensor table as reported by @link mlx90632_get_measurement_time @endlink. From the bus clock
+ * and a per transaction overhead it predicts bus time, samples per second and latency of every sensor and the bus
+ * utilisation of all of them together.
+ *
+ * Functions which wait poll the status register every @link MLX90632_COST_POLL_US @endlink until the sensor, which
+ * measures continuously, completes its next measurement, so their number of status reads follows from the
+ * measurement time. Burst and single functions sleep for the measurement time and read the status register once.
+ * Sensors on the same bus are assumed to run independently of each other, so their transactions only compete for
+ * the bus.
+ *
+ * Transactions are counted as in @link MLX90632_COST_READ_BITS @endlink and @link MLX90632_COST_WRITE_BITS
+ * @endlink. The MLX90632 has two slave addresses, so more than two sensors on one bus need a multiplexer, whose
+ * channel switches are not part of the model.
+ */
+#ifndef _MLX90632_COST_LIB_
+#define _MLX90632_COST_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_COST_READ_BITS 57 /**< Register read: start, address, register, repeated start, address, two bytes and stop */
+#define MLX90632_COST_WRITE_BITS 47 /**< Register write: start, address, register, two bytes and stop */
+#define MLX90632_COST_POLL_US 10000 /**< Sleep between status reads of @link mlx90632_wait_for_measurement @endlink */
+#define MLX90632_COST_MAX_MEAS 3 /**< Measurements in the largest measurement table */
+
+/** Acquisition functions known to the cost model */
+typedef enum mlx90632_cost_api_e {
+    MLX90632_COST_RAW = 0, /**< @link mlx90632_read_temp_raw @endlink in continuous medical mode */
+    MLX90632_COST_RAW_BURST = 1, /**< @link mlx90632_read_temp_raw_burst @endlink in medical burst mode */
+    MLX90632_COST_RAW_EXTENDED = 2, /**< @link mlx90632_read_temp_raw_extended @endlink in continuous extended mode */
+    MLX90632_COST_RAW_EXTENDED_BURST = 3, /**< @link mlx90632_read_temp_raw_extended_burst @endlink in extended burst mode */
+    MLX90632_COST_SINGLE = 4, /**< @link mlx90632_single_measurement @endlink after warm-up */
+    MLX90632_COST_APIS = 5, /**< Number of acquisition functions */
+} mlx90632_cost_api_t;
+
+/** Duration of bus transactions */
+typedef struct mlx90632_cost_bus_s {
+    uint32_t read_us; /**< Register read including overhead, in microseconds */
+    uint32_t write_us; /**< Register write including overhead, in microseconds */
+    uint32_t poll_us; /**< Sleep between two status reads while waiting for a measurement, in microseconds */
+} mlx90632_cost_bus_t;
+
+/** Sensor on the bus */
+typedef struct mlx90632_cost_sensor_s {
+    mlx90632_cost_api_t api; /**< Acquisition function called in a loop for this sensor */
+    uint8_t meas_count; /**< Measurements in the measurement table of the function */
+    uint16_t meas_time_ms[MLX90632_COST_MAX_MEAS]; /**< Time of every measurement of the table in milliseconds */
+} mlx90632_cost_sensor_t;
+
+/** Predicted cost of one sensor */
+typedef struct mlx90632_cost_s {
+    double reads; /**< Register reads per sample, including status reads while waiting */
+    double writes; /**< Register writes per sample */
+    double bus_us; /**< Bus time per sample in microseconds */
+    double samples_per_s; /**< Samples per second, lowered when the bus is saturated */
+    double latency_us; /**< Mean time from end of measurement to last raw value read in microseconds */
+} mlx90632_cost_t;
+
+/** Predicted cost of all sensors on the bus */
+typedef struct mlx90632_cost_plan_s {
+    double utilisation; /**< Share of time the bus is busy, above 1 the bus cannot keep up with the sensors */
+    double samples_per_s; /**< Samples per second of all sensors together */
+    double latency_us; /**< Mean latency of the sensor with the highest latency in microseconds */
+    uint8_t feasible; /**< Set when utilisation does not exceed 1 */
+} mlx90632_cost_plan_t;
+
+/** Calculate transaction durations of a bus
+ *
+ * Poll interval is set to @link MLX90632_COST_POLL_US @endlink. Overhead is added to every transaction and is
+ * counted as bus time, since the driver does not start the next transaction before the previous one returned.
+ *
+ * @param[out] bus Pointer to bus to initialize
+ * @param[in] clock_hz Clock frequency of the bus in Hz
+ * @param[in] overhead_us Time of host and driver added to every transaction in microseconds
+ *
+ * @retval 0 Bus was initialized
+ * @retval -EINVAL Clock frequency is 0
+ */
+int32_t mlx90632_cost_bus_init(mlx90632_cost_bus_t *bus, uint32_t clock_hz, uint32_t overhead_us);
+
+/** Describe a sensor which measures every measurement of the table at the same refresh rate
+ *
+ * @param[out] sensor Pointer to sensor to initialize
+ * @param[in] api Acquisition function called for the sensor
+ * @param[in] rate Refresh rate of every measurement of the table
+ *
+ * @retval 0 Sensor was initialized
+ * @retval -EINVAL Unknown acquisition function or refresh rate
+ */
+int32_t mlx90632_cost_sensor_init(mlx90632_cost_sensor_t *sensor, mlx90632_cost_api_t api, mlx90632_meas_t rate);
+
+/** Describe the connected sensor from its EEPROM
+ *
+ * Measurement time of every measurement of the table used by the acquisition function is read with
+ * @link mlx90632_get_measurement_time @endlink.
+ *
+ * @param[out] sensor Pointer to sensor to initialize
+ * @param[in] api Acquisition function called for the sensor
+ *
+ * @retval 0 Sensor was initialized
+ * @retval -EINVAL Unknown acquisition function
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_cost_sensor_read(mlx90632_cost_sensor_t *sensor, mlx90632_cost_api_t api);
+
+/** Predict cost of one sensor alone on the bus
+ *
+ * @param[in] bus Pointer to bus
+ * @param[in] sensor Pointer to sensor
+ * @param[out] cost Pointer to where predicted cost is written
+ *
+ * @retval 0 Cost was predicted
+ * @retval -EINVAL Unknown acquisition function or measurement table does not match it
+ */
+int32_t mlx90632_cost_predict(const mlx90632_cost_bus_t *bus, const mlx90632_cost_sensor_t *sensor,
+                              mlx90632_cost_t *cost);
+
+/** Predict cost of sensors sharing the bus
+ *
+ * Latency of every sensor grows with the utilisation of the bus by the other sensors, as each of its transactions
+ * after the end of measurement may wait for a transaction in progress. When the bus is saturated samples per
+ * second of all sensors are lowered by the utilisation.
+ *
+ * @param[in] bus Pointer to bus
+ * @param[in] sensors Array of sensors on the bus
+ * @param[in] count Number of sensors
+ * @param[out] costs Array of count elements where predicted cost of every sensor is written
+ * @param[out] plan Pointer to where predicted cost of the bus is written
+ *
+ * @retval 0 Cost was predicted
+ * @retval -EINVAL No sensors, or a sensor is not valid
+ */
+int32_t mlx90632_cost_plan(const mlx90632_cost_bus_t *bus, const mlx90632_cost_sensor_t *sensors, uint32_t count,
+                           mlx90632_cost_t *costs, mlx90632_cost_plan_t *plan);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
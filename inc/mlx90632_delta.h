@@ -0,0 +1,112 @@
+/**
+ * @file mlx90632_delta.h
+ * @brief MLX90632 delta and varint encoding of temperature streams
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Temperatures change slowly compared to the sample rate, so a stream of samples compresses well when every
+ * sample is stored as the difference to the previous one. Ambient and object temperature from
+ * @link mlx90632_calc_temp_ambient @endlink and @link mlx90632_calc_temp_object @endlink are rounded to
+ * millidegrees Celsius and their differences are zig-zag encoded, so that small negative and positive differences
+ * are both small numbers, and written as varints of 7 bits per byte. Timestamp is stored as the change of the
+ * sampling interval, which is 0 or a few microseconds of jitter for a sensor sampled at a fixed rate. A sample of a
+ * slowly changing temperature takes 3 to 5 bytes instead of 24.
+ *
+ * Stream can be split into blocks with @link mlx90632_delta_block @endlink, which stores an absolute timestamp
+ * base and restarts prediction, so that each block can be decoded on its own, for example after a lost uplink
+ * packet. Without blocks the first sample is stored as difference to zero.
+ *
+ * Record of a sample starts with varint of (zig-zag(interval change) << 1), a block with varint 1 followed by
+ * varint of the timestamp base; varints are little endian groups of 7 bits with the top bit set on all but the last
+ * byte. Encoding uses only integer operations besides rounding of the temperatures.
+ */
+#ifndef _MLX90632_DELTA_LIB_
+#define _MLX90632_DELTA_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_DELTA_RECORD_MAX 20 /**< Maximum size of one encoded record in bytes */
+
+/** State of an encoder or decoder of a stream */
+typedef struct mlx90632_delta_s {
+    uint8_t *buf; /**< Buffer of the encoded stream */
+    uint32_t size; /**< Size of the buffer when encoding, length of the stream when decoding */
+    uint32_t pos; /**< Number of bytes written or read */
+    uint64_t timestamp_us; /**< Timestamp of the previous sample in microseconds */
+    int64_t interval_us; /**< Time between the previous two samples in microseconds */
+    int32_t ambient; /**< Ambient temperature of the previous sample in millidegrees Celsius */
+    int32_t object; /**< Object temperature of the previous sample in millidegrees Celsius */
+} mlx90632_delta_t;
+
+/** Initialize encoder or decoder of a stream
+ *
+ * @param[out] delta Pointer to the state to initialize
+ * @param[in] buf Buffer where stream is written to or read from
+ * @param[in] size Size of the buffer when encoding, length of the stream when decoding
+ */
+void mlx90632_delta_init(mlx90632_delta_t *delta, uint8_t *buf, uint32_t size);
+
+/** Start a block which can be decoded on its own
+ *
+ * @param[in,out] delta Pointer to the encoder
+ * @param[in] timestamp_us Timestamp base of the block in microseconds, usually timestamp of its first sample
+ *
+ * @retval 0 Block started
+ * @retval -ENOBUFS Block header does not fit in the buffer, nothing was written
+ */
+int32_t mlx90632_delta_block(mlx90632_delta_t *delta, uint64_t timestamp_us);
+
+/** Encode one sample
+ *
+ * @param[in,out] delta Pointer to the encoder
+ * @param[in] timestamp_us Timestamp of the sample in microseconds
+ * @param[in] ambient Ambient temperature in degrees Celsius from @link mlx90632_calc_temp_ambient @endlink
+ * @param[in] object Object temperature in degrees Celsius from @link mlx90632_calc_temp_object @endlink
+ *
+ * @retval 0 Sample encoded
+ * @retval -EINVAL Temperature is not a number or does not fit in 32-bit millidegrees
+ * @retval -ENOBUFS Sample does not fit in the buffer, nothing was written
+ */
+int32_t mlx90632_delta_put(mlx90632_delta_t *delta, uint64_t timestamp_us, double ambient, double object);
+
+/** Decode next sample
+ *
+ * Block headers are consumed on the way.
+ *
+ * @param[in,out] delta Pointer to the decoder
+ * @param[out] timestamp_us Pointer to where timestamp of the sample in microseconds is written
+ * @param[out] ambient Pointer to where ambient temperature in degrees Celsius is written
+ * @param[out] object Pointer to where object temperature in degrees Celsius is written
+ *
+ * @retval 0 Sample decoded
+ * @retval -ENODATA End of the stream
+ * @retval -EBADMSG Stream is truncated or corrupted
+ */
+int32_t mlx90632_delta_get(mlx90632_delta_t *delta, uint64_t *timestamp_us, double *ambient, double *object);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
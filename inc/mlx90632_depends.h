@@ -33,6 +33,9 @@
 #ifndef _MLX90632_DEPENDS_LIB_
 #define _MLX90632_DEPENDS_LIB_
 
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /** Read the register_address value from the mlx90632
  *
@@ -62,6 +65,47 @@ extern int32_t mlx90632_i2c_read(int16_t register_address, uint16_t *value);
  */
 extern int32_t mlx90632_i2c_write(int16_t register_address, uint16_t value);
 
+/** Read consecutive registers starting at register_address from the mlx90632
+ *
+ * Same as @link mlx90632_i2c_read @endlink, but reads words 16-bit registers in one i2c transaction, with register
+ * address auto-incremented by the sensor.
+ *
+ * @note Needs to be implemented externally only when functions which read register blocks are used
+ * @param[in] register_address Address of the first register to be read from
+ * @param[out] *value pointer to array of at least words elements where read data can be written
+ * @param[in] words Number of 16-bit registers to read
+
+ * @retval 0 for success
+ * @retval <0 for failure
+ */
+extern int32_t mlx90632_i2c_read_block(int16_t register_address, uint16_t *value, uint16_t words);
+
+/** Descriptor of an asynchronous i2c transfer, see @link mlx90632_i2c_submit @endlink */
+typedef struct mlx90632_i2c_xfer_s {
+    int16_t register_address; /**< Address of the first register */
+    uint16_t *value; /**< Words to write, or buffer of at least words elements where read data is written */
+    uint16_t words; /**< Number of 16-bit registers, with register address auto-incremented by the sensor */
+    uint8_t write; /**< 1 to write value to the registers, 0 to read them */
+    int32_t status; /**< Result written by the backend before complete is called, 0 for success and <0 for failure */
+    void (*complete)(struct mlx90632_i2c_xfer_s *xfer); /**< Called by the backend once the transfer is finished */
+} mlx90632_i2c_xfer_t;
+
+/** Start an i2c transfer on the mlx90632 and return without waiting for it
+ *
+ * Asynchronous counterpart of @link mlx90632_i2c_read_block @endlink and @link mlx90632_i2c_write @endlink for
+ * interrupt or DMA driven i2c controllers. Backend starts the transfer described by xfer and returns. When the
+ * transfer is finished it writes the result to status and calls complete, usually from its interrupt handler.
+ * Backends which finish the transfer at once may call complete before returning. The descriptor and its buffer are
+ * owned by the backend until then. Writes are one word.
+ *
+ * @note Needs to be implemented externally only when asynchronous functions of mlx90632_async.h are used
+ * @param[in,out] xfer Pointer to transfer descriptor
+ *
+ * @retval 0 Transfer was started and complete will be called
+ * @retval <0 Transfer was not started and complete will not be called
+ */
+extern int32_t mlx90632_i2c_submit(mlx90632_i2c_xfer_t *xfer);
+
 /** Blocking function for sleeping in microseconds
  *
  * Range of microseconds which are allowed for the thread to sleep. This is to avoid constant pinging of sensor if the
@@ -83,5 +127,20 @@ extern void usleep(int min_range, int max_range);
  */
 extern void msleep(int msecs);
 
+/** Monotonic time source in microseconds
+ *
+ * Used by functions which report latency or timestamp their samples. Value must never go backwards, so it should
+ * not be derived from wall clock time.
+ *
+ * @note Needs to be implemented externally only when functions which report timing or timestamp samples are used
+ * @return Current value of the monotonic clock in microseconds
+ */
+extern uint64_t mlx90632_get_time_us(void);
+
 ///@}
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
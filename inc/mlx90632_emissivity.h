@@ -0,0 +1,165 @@
+/**
+ * @file mlx90632_emissivity.h
+ * @brief MLX90632 object temperature under several emissivities
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Material identification evaluates one sample under several candidate emissivities. Doing it with
+ * @link mlx90632_set_emissivity @endlink and @link mlx90632_calc_temp_object @endlink per candidate repeats
+ * preprocessing and every ambient term, and changes the emissivity used by the rest of the application.
+ * @link mlx90632_calc_temp_object_emissivities @endlink calculates emissivity independent terms once and iterates
+ * all candidates together, with candidates in the inner loop so that the compiler can vectorize it. Square roots
+ * are vectorized only when errno is not required to be set, for example with gcc -fno-math-errno. Global
+ * emissivity is not used nor changed.
+ *
+ * Emissivity of a site can be estimated from samples paired with temperature of a reference thermometer. With the
+ * reference temperature known, the DSPv5 equation is linear in emissivity:
+ * S + Ta4 = emissivity * Tobj4 + (1 - emissivity) * Tr4, where S is the object signal divided by the object gain,
+ * Ta4, Tobj4 and Tr4 are fourth powers of die, reference and reflected temperature in Kelvin. Every sample adds to
+ * a few sums with @link mlx90632_emissivity_fit_add @endlink and emissivity is solved from them in closed form by
+ * weighted least squares, with weights which make residuals equal to error in degrees Celsius. Without reflected
+ * temperature, as in @link mlx90632_calc_temp_object @endlink, the sensor die is the environment. With reflected
+ * temperature, it can be given or fitted together with emissivity.
+ *
+ * Sums of fits of parts of a dataset can be merged with @link mlx90632_emissivity_fit_merge @endlink, so large
+ * datasets can be split between threads.
+ */
+#ifndef _MLX90632_EMISSIVITY_LIB_
+#define _MLX90632_EMISSIVITY_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Calculate object temperature of one sample for each of the candidate emissivities
+ *
+ * Results are the same as of @link mlx90632_calc_temp_object @endlink with preprocessed values truncated to integer
+ * and each emissivity set with @link mlx90632_set_emissivity @endlink, up to rounding of the reordered
+ * calculations.
+ *
+ * @param[in] calib Pointer to calibration parameters
+ * @param[in] ambient_new_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] ambient_old_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] object_new_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ * @param[in] object_old_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ * @param[in] emissivity Pointer to array of count candidate emissivities
+ * @param[out] object Pointer to array of count object temperatures in degrees Celsius, one per candidate
+ * @param[in] count Number of candidates
+ *
+ * @retval 0 Temperatures were calculated
+ * @retval -EINVAL Emissivity of a candidate is not positive
+ */
+int32_t mlx90632_calc_temp_object_emissivities(const mlx90632_calib_t *calib,
+                                               int16_t ambient_new_raw, int16_t ambient_old_raw,
+                                               int16_t object_new_raw, int16_t object_old_raw,
+                                               const double *emissivity, double *object, uint16_t count);
+
+/** Sums of emissivity fit */
+typedef struct mlx90632_emissivity_fit_s {
+    uint32_t samples; /**< Number of added samples */
+    double sw; /**< Sum of weights */
+    double su; /**< Weighted sum of reference temperature terms */
+    double sz; /**< Weighted sum of signal terms */
+    double suu; /**< Weighted sum of squared reference temperature terms */
+    double suz; /**< Weighted sum of products of reference temperature and signal terms */
+    double sxx; /**< Weighted sum of squared reference temperature terms relative to die */
+    double sxy; /**< Weighted sum of products of reference temperature terms relative to die and signal */
+} mlx90632_emissivity_fit_t;
+
+/** Clear sums of emissivity fit
+ *
+ * @param[out] fit Pointer to the fit
+ */
+void mlx90632_emissivity_fit_init(mlx90632_emissivity_fit_t *fit);
+
+/** Add sample with reference temperature to emissivity fit
+ *
+ * @param[in,out] fit Pointer to the fit
+ * @param[in] calib Pointer to calibration parameters
+ * @param[in] ambient_new_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] ambient_old_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] object_new_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ * @param[in] object_old_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ * @param[in] reference Object temperature measured by reference thermometer in degrees Celsius
+ *
+ * @retval 0 Sample was added
+ * @retval -EINVAL Reference temperature is not above absolute zero
+ */
+int32_t mlx90632_emissivity_fit_add(mlx90632_emissivity_fit_t *fit, const mlx90632_calib_t *calib,
+                                    int16_t ambient_new_raw, int16_t ambient_old_raw,
+                                    int16_t object_new_raw, int16_t object_old_raw, double reference);
+
+/** Merge sums of another fit into fit
+ *
+ * @param[in,out] fit Pointer to the fit
+ * @param[in] other Pointer to the fit of another part of the dataset
+ */
+void mlx90632_emissivity_fit_merge(mlx90632_emissivity_fit_t *fit, const mlx90632_emissivity_fit_t *other);
+
+/** Solve emissivity with sensor die as the environment
+ *
+ * Model of @link mlx90632_calc_temp_object @endlink.
+ *
+ * @param[in] fit Pointer to the fit
+ * @param[out] emissivity Estimated emissivity
+ *
+ * @retval 0 Emissivity was estimated
+ * @retval -EINVAL Samples do not determine emissivity, for example reference was at die temperature
+ */
+int32_t mlx90632_emissivity_fit_solve(const mlx90632_emissivity_fit_t *fit, double *emissivity);
+
+/** Solve emissivity with known reflected temperature
+ *
+ * Model of @link mlx90632_calc_temp_object_reflected @endlink.
+ *
+ * @param[in] fit Pointer to the fit
+ * @param[in] reflected Temperature of the environment in degrees Celsius
+ * @param[out] emissivity Estimated emissivity
+ *
+ * @retval 0 Emissivity was estimated
+ * @retval -EINVAL Samples do not determine emissivity, for example reference was at reflected temperature
+ */
+int32_t mlx90632_emissivity_fit_solve_with_reflected(const mlx90632_emissivity_fit_t *fit, double reflected,
+                                                     double *emissivity);
+
+/** Solve emissivity together with reflected temperature
+ *
+ * Model of @link mlx90632_calc_temp_object_reflected @endlink. Samples need to span different reference
+ * temperatures.
+ *
+ * @param[in] fit Pointer to the fit
+ * @param[out] emissivity Estimated emissivity
+ * @param[out] reflected Estimated temperature of the environment in degrees Celsius
+ *
+ * @retval 0 Emissivity and reflected temperature were estimated
+ * @retval -EINVAL Samples do not determine both, for example all had the same reference temperature or emissivity
+ *                 is 1, where reflected temperature has no effect
+ * @retval -ERANGE Estimated reflected temperature is below absolute zero
+ */
+int32_t mlx90632_emissivity_fit_solve_reflected(const mlx90632_emissivity_fit_t *fit, double *emissivity,
+                                                double *reflected);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * @file mlx90632_epoll.h
+ * @brief MLX90632 timerfd and epoll integration for Linux hosts
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API_linux MLX90632 Linux host backend
+ *
+ * @details
+ * Lets one thread service many sensors in continuous medical mode without usleep or status polling loops. Every
+ * sensor owns a timerfd which is armed at the expected data ready time of its next measurement and registered in
+ * an epoll instance of the application. When the timer expires the status register is read once; if data is ready
+ * the raw values are read, temperatures are calculated and passed to the callback, otherwise the timer is armed a
+ * short retry time later.
+ *
+ * Expected data ready time follows the measurement time of the channel which is measured next. It is moved
+ * @link MLX90632_EPOLL_ADVANCE @endlink earlier on every cycle, so that the sensor oscillator drifting against the
+ * host clock shows up as an occasional retry which resynchronizes the schedule, instead of reads which slowly lag
+ * until a cycle is missed.
+ *
+ * Sensors are accessed through @link mlx90632_i2c_dev_t @endlink, so this layer is built with `make linux`.
+ * mlx90632.h and mlx90632_i2c_dev.h need to be included before this file.
+ * @{
+ */
+#ifndef _MLX90632_EPOLL_LIB_
+#define _MLX90632_EPOLL_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_EPOLL_RETRY_TIME 500 /**< Time in us after which status is read again when data was not ready */
+#define MLX90632_EPOLL_ADVANCE 100 /**< Time in us by which expected data ready time is moved earlier each cycle */
+#define MLX90632_EPOLL_MAX_EVENTS 16 /**< Number of events handled by one @link mlx90632_epoll_run @endlink call */
+
+typedef struct mlx90632_epoll_sensor_s mlx90632_epoll_sensor_t;
+
+/** Function called from @link mlx90632_epoll_dispatch @endlink with the result of a measurement
+ *
+ * @param[in] sensor Sensor on which the measurement was done
+ * @param[in] status 0 when temperatures are valid, <0 error from errno.h otherwise
+ * @param[in] ambient Ambient temperature in degrees Celsius
+ * @param[in] object Object temperature in degrees Celsius
+ */
+typedef void (*mlx90632_epoll_cb_t)(mlx90632_epoll_sensor_t *sensor, int32_t status, double ambient, double object);
+
+/** State of one sensor serviced from epoll */
+struct mlx90632_epoll_sensor_s {
+    mlx90632_i2c_dev_t *dev; /**< Device on which the sensor is connected */
+    const mlx90632_calib_t *calib; /**< Calibration parameters of the sensor */
+    mlx90632_epoll_cb_t callback; /**< Function which receives the temperatures */
+    void *user; /**< Pointer for use by the application */
+    int timer_fd; /**< Timer armed at the next expected data ready time */
+    uint64_t deadline_us; /**< Expected data ready time of the next measurement, CLOCK_MONOTONIC */
+    uint32_t period_us[2]; /**< Measurement time of channel 1 and channel 2 in microseconds */
+    uint32_t retries; /**< Status reads without data ready since the last measurement */
+    uint32_t late; /**< Number of times data was not ready at the expected time */
+    uint8_t cycle_pos; /**< Channel position of the last measurement */
+};
+
+/** Start servicing a sensor from epoll
+ *
+ * Reads measurement times of both medical measurements, clears data ready and registers the armed timer of the
+ * sensor in the epoll instance, with the sensor as event data pointer. Sensor must be in continuous medical mode.
+ *
+ * @param[in] epoll_fd File descriptor of the epoll instance
+ * @param[out] sensor Pointer to sensor state which must stay valid until it is removed
+ * @param[in] dev Device on which the sensor is connected
+ * @param[in] calib Calibration parameters of the sensor, must stay valid until it is removed
+ * @param[in] callback Function which receives the temperatures
+ * @param[in] user Pointer for use by the application
+ *
+ * @retval 0 Sensor added
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_epoll_add(int epoll_fd, mlx90632_epoll_sensor_t *sensor, mlx90632_i2c_dev_t *dev,
+                           const mlx90632_calib_t *calib, mlx90632_epoll_cb_t callback, void *user);
+
+/** Stop servicing a sensor and close its timer
+ *
+ * @param[in] epoll_fd File descriptor of the epoll instance
+ * @param[in,out] sensor Pointer to sensor state
+ */
+void mlx90632_epoll_remove(int epoll_fd, mlx90632_epoll_sensor_t *sensor);
+
+/** Handle expiry of the sensor timer
+ *
+ * Reads status register once. When data is ready it is cleared, raw values are read, temperatures are calculated
+ * and passed to the callback and the timer is armed at the expected data ready time of the next measurement.
+ * Otherwise timer is armed @link MLX90632_EPOLL_RETRY_TIME @endlink later, and after two measurement cycles
+ * without data the callback receives -ETIMEDOUT.
+ *
+ * @param[in,out] sensor Pointer to sensor state
+ *
+ * @retval 1 Callback was called with new temperatures
+ * @retval 0 Data was not ready yet
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_epoll_dispatch(mlx90632_epoll_sensor_t *sensor);
+
+/** Wait for sensor timers and dispatch them
+ *
+ * Convenience loop body for applications whose epoll instance contains only sensors. Applications which register
+ * other file descriptors call @link mlx90632_epoll_dispatch @endlink for events whose data pointer is a sensor.
+ *
+ * @param[in] epoll_fd File descriptor of the epoll instance
+ * @param[in] timeout_ms Maximum time to wait in milliseconds, -1 to wait forever
+ *
+ * @retval >=0 Number of sensors which were dispatched
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_epoll_run(int epoll_fd, int timeout_ms);
+
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
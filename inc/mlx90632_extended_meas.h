@@ -24,6 +24,13 @@
 #ifndef _MLX90632_EXTENDED_MEAS_LIB_
 #define _MLX90632_EXTENDED_MEAS_LIB_
 
+#include "mlx90632_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if MLX90632_ENABLE_EXTENDED
 /** Read raw ambient and object temperature for extended range only when measurement data is ready
  *
  * Read raw ambient and object temperatures without waiting. This values still need
@@ -71,7 +78,9 @@ int32_t mlx90632_read_temp_raw_extended_wo_wait(int16_t *ambient_new_raw, int16_
  * @retval <0 Something went wrong. Check errno.h for more details
  */
 int32_t mlx90632_read_temp_raw_extended(int16_t *ambient_new_raw, int16_t *ambient_old_raw, int16_t *object_new_raw);
+#endif
 
+#if MLX90632_ENABLE_EXTENDED && MLX90632_ENABLE_BURST
 /** Read raw ambient and object temperature for extended range sleeping step mode
  *
  * Trigger and read raw ambient and object temperatures. This values still need
@@ -88,7 +97,9 @@ int32_t mlx90632_read_temp_raw_extended(int16_t *ambient_new_raw, int16_t *ambie
  * @retval <0 Something went wrong. Check errno.h for more details
  */
 int32_t mlx90632_read_temp_raw_extended_burst(int16_t *ambient_new_raw, int16_t *ambient_old_raw, int16_t *object_new_raw);
+#endif
 
+#if MLX90632_ENABLE_EXTENDED
 /** Calculation of raw ambient output for the extended range
  *
  * Preprocessing of the raw ambient value
@@ -152,6 +163,7 @@ double mlx90632_calc_temp_ambient_extended(int16_t ambient_new_raw, int16_t ambi
 double mlx90632_calc_temp_object_extended(int32_t object, int32_t ambient, double reflected,
                                           int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
                                           int16_t Ha, int16_t Hb);
+#endif
 
 /** Switch the measurement type of the MLX90632
  *
@@ -176,10 +188,14 @@ int32_t mlx90632_set_meas_type(uint8_t type);
  */
 int32_t mlx90632_get_meas_type(void);
 
-#ifdef TEST
+#if defined(TEST) && MLX90632_ENABLE_EXTENDED
 int32_t mlx90632_read_temp_ambient_raw_extended(int16_t *ambient_new_raw, int16_t *ambient_old_raw);
 int32_t mlx90632_read_temp_object_raw_extended(int16_t *object_new_raw);
 
 #endif
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
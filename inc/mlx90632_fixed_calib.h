@@ -0,0 +1,187 @@
+/**
+ * @file mlx90632_fixed_calib.h
+ * @brief MLX90632 temperature calculations with calibration parameters known at compile time
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API_fixed MLX90632 Fixed calibration calculations
+ * @brief DSPv5 calculations specialized for calibration parameters baked into firmware
+ *
+ * @details
+ * Products which read sensor EEPROM once at the factory can define the calibration parameters as macros before
+ * including this header:
+ * @code
+ * #define MLX90632_FIXED_P_R 0x00587f5b
+ * #define MLX90632_FIXED_P_G 0x04a10289
+ * ...
+ * #define MLX90632_FIXED_Hb 0
+ * #include "mlx90632.h"
+ * #include "mlx90632_fixed_calib.h"
+ * @endcode
+ * All of MLX90632_FIXED_P_R, _P_G, _P_T, _P_O, _Ea, _Eb, _Fa, _Fb, _Ga, _Gb, _Ka, _Ha and _Hb are required.
+ * MLX90632_FIXED_EMISSIVITY is optional and defaults to 1.0.
+ *
+ * The functions are static inline and every term derived only from calibration (scaling of the parameters, the
+ * ambient offset and slope, the gain of the object equation) is a constant expression, so the compiler emits it as an
+ * immediate and divisions by parameters become multiplications by precomputed reciprocals. Terms which depend only
+ * on ambient temperature are calculated once per object temperature instead of in every iteration. Results match
+ * the runtime-calibration functions of mlx90632.h to a few units in the last place of a double, since reciprocals
+ * are rounded once at compile time.
+ *
+ * Header is meant to be included in one translation unit per calibration. It does not need mlx90632_depends.h
+ * functions, but needs to be linked with libm for sqrt.
+ * @{
+ */
+#ifndef _MLX90632_FIXED_CALIB_LIB_
+#define _MLX90632_FIXED_CALIB_LIB_
+
+#include <math.h>
+
+#if !defined(MLX90632_FIXED_P_R) || !defined(MLX90632_FIXED_P_G) || !defined(MLX90632_FIXED_P_T) || \
+    !defined(MLX90632_FIXED_P_O) || !defined(MLX90632_FIXED_Ea) || !defined(MLX90632_FIXED_Eb) || \
+    !defined(MLX90632_FIXED_Fa) || !defined(MLX90632_FIXED_Fb) || !defined(MLX90632_FIXED_Ga) || \
+    !defined(MLX90632_FIXED_Gb) || !defined(MLX90632_FIXED_Ka) || !defined(MLX90632_FIXED_Ha) || \
+    !defined(MLX90632_FIXED_Hb)
+#error "All MLX90632_FIXED_ calibration parameters need to be defined before including mlx90632_fixed_calib.h"
+#endif
+
+#ifndef MLX90632_FIXED_EMISSIVITY
+#define MLX90632_FIXED_EMISSIVITY 1.0 /**< Emissivity of the measured object */
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Terms derived from calibration parameters only, see mlx90632.c for the meaning of each */
+#define MLX90632_FIXED_kGb ((double)(int16_t)(MLX90632_FIXED_Gb) / 1024.0) /**< Ambient Beta */
+#define MLX90632_FIXED_kKa ((double)(int16_t)(MLX90632_FIXED_Ka) / 1024.0) /**< IR Beta */
+#define MLX90632_FIXED_Asub ((double)(int32_t)(MLX90632_FIXED_P_T) / 17592186044416.0) /**< Ambient 2nd order */
+#define MLX90632_FIXED_Boff ((double)(int32_t)(MLX90632_FIXED_P_R) / 256.0) /**< Ambient reference */
+#define MLX90632_FIXED_Bgain (1048576.0 / (double)(int32_t)(MLX90632_FIXED_P_G)) /**< Ambient gain */
+#define MLX90632_FIXED_Cblock ((double)(int32_t)(MLX90632_FIXED_P_O) / 256.0) /**< Ambient offset */
+#define MLX90632_FIXED_kEb ((double)(int32_t)(MLX90632_FIXED_Eb) / 256.0) /**< Ambient sensor offset */
+#define MLX90632_FIXED_kEa_inv (65536.0 / (double)(int32_t)(MLX90632_FIXED_Ea)) /**< Ambient sensor slope */
+#define MLX90632_FIXED_kGa ((double)(int32_t)(MLX90632_FIXED_Ga) / 68719476736.0) /**< Object temperature TC */
+#define MLX90632_FIXED_kFb ((double)(int32_t)(MLX90632_FIXED_Fb) / 68719476736.0) /**< Ambient temperature TC */
+#define MLX90632_FIXED_Hb_customer ((double)(int16_t)(MLX90632_FIXED_Hb) / 1024.0) /**< Customer offset */
+/** Object gain including customer gain and emissivity */
+#define MLX90632_FIXED_Alpha \
+    ((MLX90632_FIXED_EMISSIVITY) * (double)(int32_t)(MLX90632_FIXED_Fa) * \
+     ((double)(int16_t)(MLX90632_FIXED_Ha) / 16384.0) / 70368744177664.0)
+
+/** Preprocess ambient temperature with fixed Gb
+ *
+ * @see mlx90632_preprocess_temp_ambient
+ */
+static inline double mlx90632_fixed_preprocess_temp_ambient(int16_t ambient_new_raw, int16_t ambient_old_raw)
+{
+    double VR_Ta;
+
+    VR_Ta = ambient_old_raw + MLX90632_FIXED_kGb * (ambient_new_raw / (MLX90632_REF_3));
+    return ((ambient_new_raw / (MLX90632_REF_3)) / VR_Ta) * 524288.0;
+}
+
+/** Preprocess object temperature with fixed Ka
+ *
+ * @see mlx90632_preprocess_temp_object
+ */
+static inline double mlx90632_fixed_preprocess_temp_object(int16_t object_new_raw, int16_t object_old_raw,
+                                                           int16_t ambient_new_raw, int16_t ambient_old_raw)
+{
+    double VR_IR;
+
+    VR_IR = ambient_old_raw + MLX90632_FIXED_kKa * (ambient_new_raw / (MLX90632_REF_3));
+    return ((((object_new_raw + object_old_raw) / 2) / (MLX90632_REF_12)) / VR_IR) * 524288.0;
+}
+
+/** Calculate ambient temperature with fixed P_T, P_R, P_G, P_O and Gb
+ *
+ * @param[in] ambient_new_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] ambient_old_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ *
+ * @return Calculated ambient temperature degrees Celsius
+ *
+ * @see mlx90632_calc_temp_ambient
+ */
+static inline double mlx90632_fixed_calc_temp_ambient(int16_t ambient_new_raw, int16_t ambient_old_raw)
+{
+    double Bsub;
+
+    Bsub = mlx90632_fixed_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw) - MLX90632_FIXED_Boff;
+
+    return Bsub * MLX90632_FIXED_Bgain + MLX90632_FIXED_Asub * (Bsub * Bsub) + MLX90632_FIXED_Cblock;
+}
+
+/** Calculate object temperature with fixed Ea, Eb, Ga, Fa, Fb, Ha, Hb and emissivity
+ *
+ * @param[in] object object temperature from @link mlx90632_fixed_preprocess_temp_object @endlink
+ * @param[in] ambient ambient temperature from @link mlx90632_fixed_preprocess_temp_ambient @endlink
+ *
+ * @return Calculated object temperature in degrees Celsius
+ *
+ * @see mlx90632_calc_temp_object
+ */
+static inline double mlx90632_fixed_calc_temp_object(int32_t object, int32_t ambient)
+{
+    double TAdut, TAdut4, calcedGb;
+    double temp = 25.0;
+    int8_t i;
+
+    TAdut = (((double)ambient) - MLX90632_FIXED_kEb) * MLX90632_FIXED_kEa_inv + 25;
+    TAdut4 = (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15);
+    calcedGb = 1 + MLX90632_FIXED_kFb * (TAdut - 25);
+
+    for (i = 0; i < 5; ++i)
+    {
+        double calcedFa = object / (MLX90632_FIXED_Alpha * (calcedGb + MLX90632_FIXED_kGa * (temp - 25)));
+
+        temp = sqrt(sqrt(calcedFa + TAdut4)) - 273.15 - MLX90632_FIXED_Hb_customer;
+    }
+
+    return temp;
+}
+
+/** Calculate ambient and object temperature from raw values with fixed calibration
+ *
+ * @param[in] ambient_new_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] ambient_old_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] object_new_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ * @param[in] object_old_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ * @param[out] ambient Ambient temperature in degrees Celsius
+ * @param[out] object Object temperature in degrees Celsius
+ */
+static inline void mlx90632_fixed_calc_temp(int16_t ambient_new_raw, int16_t ambient_old_raw,
+                                            int16_t object_new_raw, int16_t object_old_raw,
+                                            double *ambient, double *object)
+{
+    double pre_ambient = mlx90632_fixed_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw);
+    double pre_object = mlx90632_fixed_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                              ambient_new_raw, ambient_old_raw);
+
+    *ambient = mlx90632_fixed_calc_temp_ambient(ambient_new_raw, ambient_old_raw);
+    *object = mlx90632_fixed_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient);
+}
+
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,225 @@
+/**
+ * @file mlx90632_frame.h
+ * @brief MLX90632 acquisition engine building synchronized frames of sensors on several i2c buses
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API_linux MLX90632 Linux host backend
+ *
+ * @details
+ * Engine runs one I/O worker thread per i2c bus and collects one raw sample of every sensor per cycle window into a
+ * frame. Window n starts at start time plus n periods on CLOCK_MONOTONIC for all buses, so sensors on different
+ * buses are read in the same window although their workers never wait for each other. Complete frames are handed
+ * to a compute thread, which calls the callback, so slow processing never delays the buses.
+ *
+ * In @link MLX90632_FRAME_CONTINUOUS @endlink mode every worker calls @link mlx90632_trigger_measurement
+ * @endlink for its sensors at the start of the window, polls them in turn with @link mlx90632_poll_measurement
+ * @endlink and reads each with @link mlx90632_read_temp_raw_wo_wait @endlink once its next measurement is ready.
+ * Sensors measure freely, so samples of a frame are up to one measurement time apart. In
+ * @link MLX90632_FRAME_BURST @endlink mode the worker starts the measurement of its sensors with
+ * @link mlx90632_trigger_measurement_burst @endlink at the start of the window, sleeps for the dataset time and
+ * reads them when they are not busy anymore, so samples are only apart by the time between the triggers.
+ *
+ * A sensor which has no sample by the end of the window, or fails, is marked in the frame with its status. A frame
+ * goes to the compute thread when all sensors contributed, or incomplete when a bus already works on a frame
+ * @link MLX90632_FRAME_SLOTS @endlink windows later. Engine reports bus utilisation, frame completion latency and
+ * skew between samples of a frame in @link mlx90632_frame_stats_t @endlink.
+ *
+ * Workers select their devices with @link mlx90632_i2c_dev_select @endlink, so each device must be on exactly one
+ * bus and must not be used by other threads while the engine runs. Medical measurement tables only. Built with
+ * `make linux`. mlx90632.h and mlx90632_i2c_dev.h need to be included before this file.
+ * @{
+ */
+#ifndef _MLX90632_FRAME_LIB_
+#define _MLX90632_FRAME_LIB_
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_FRAME_MAX_BUSES 8 /**< Buses, so worker threads, of one engine */
+#define MLX90632_FRAME_BUS_SENSORS 8 /**< Sensors on one bus */
+#define MLX90632_FRAME_MAX_SENSORS (MLX90632_FRAME_MAX_BUSES * MLX90632_FRAME_BUS_SENSORS) /**< Sensors in a frame */
+#define MLX90632_FRAME_SLOTS 4 /**< Frames assembled at the same time, older frames are handed over incomplete */
+#define MLX90632_FRAME_QUEUE 4 /**< Complete frames waiting for the compute thread */
+#define MLX90632_FRAME_POLL_TIME 1000 /**< Sleep between two status reads of a sensor in microseconds */
+
+/** How workers acquire samples */
+typedef enum mlx90632_frame_mode_e {
+    MLX90632_FRAME_CONTINUOUS = 0, /**< Sensors measure continuously in medical mode */
+    MLX90632_FRAME_BURST = 1, /**< Sensors are in medical burst mode and measure once per window */
+} mlx90632_frame_mode_t;
+
+/** Raw sample of one sensor in a frame */
+typedef struct mlx90632_frame_sample_s {
+    uint64_t timestamp_us; /**< End of measurement on CLOCK_MONOTONIC in microseconds */
+    int32_t status; /**< 0 for a valid sample, -ETIMEDOUT when sensor had no sample in the window, or the error */
+    int16_t ambient_new_raw; /**< New raw ambient temperature */
+    int16_t ambient_old_raw; /**< Old raw ambient temperature */
+    int16_t object_new_raw; /**< New raw object temperature */
+    int16_t object_old_raw; /**< Old raw object temperature */
+} mlx90632_frame_sample_t;
+
+/** Samples of all sensors from one window */
+typedef struct mlx90632_frame_s {
+    uint32_t seq; /**< Number of the window, 0 for the first one */
+    uint16_t count; /**< Number of sensors, in the order the buses and their devices were added */
+    uint16_t good; /**< Number of valid samples */
+    uint64_t start_us; /**< Start of the window on CLOCK_MONOTONIC in microseconds */
+    uint64_t complete_us; /**< Time the frame was handed to the compute thread */
+    uint32_t skew_us; /**< Time between the first and the last valid sample */
+    mlx90632_frame_sample_t sample[MLX90632_FRAME_MAX_SENSORS]; /**< Sample of every sensor */
+} mlx90632_frame_t;
+
+struct mlx90632_frame_engine_s;
+
+/** Function called by the compute thread for every frame, in window order
+ *
+ * @param[in] engine Pointer to the engine
+ * @param[in] frame Pointer to the frame, valid until the function returns
+ * @param[in] user User pointer given to @link mlx90632_frame_start @endlink
+ */
+typedef void (*mlx90632_frame_cb_t)(struct mlx90632_frame_engine_s *engine, const mlx90632_frame_t *frame,
+                                    void *user);
+
+/** I2c bus with its worker thread */
+typedef struct mlx90632_frame_bus_s {
+    struct mlx90632_frame_engine_s *engine; /**< Engine the bus belongs to */
+    mlx90632_i2c_dev_t *dev[MLX90632_FRAME_BUS_SENSORS]; /**< Devices on the bus */
+    uint16_t count; /**< Number of devices */
+    uint16_t first; /**< Index of the first device in the frame */
+    uint32_t dataset_us; /**< Longest dataset time of the devices in burst mode in microseconds */
+    uint64_t busy_us; /**< Time spent in register accesses in microseconds */
+    uint32_t windows; /**< Windows the worker acquired */
+    uint32_t missed; /**< Windows the worker skipped because it was late */
+    pthread_t thread; /**< Worker thread */
+} mlx90632_frame_bus_t;
+
+/** Statistics of a running or stopped engine */
+typedef struct mlx90632_frame_stats_s {
+    uint32_t frames; /**< Frames handed to the compute thread, including incomplete and dropped ones */
+    uint32_t incomplete; /**< Frames with at least one sample missing */
+    uint32_t overruns; /**< Frames dropped because compute thread did not keep up */
+    uint32_t late; /**< Samples which arrived after their frame was handed over */
+    double latency_mean_us; /**< Mean time from start of window to complete frame in microseconds */
+    uint64_t latency_max_us; /**< Longest time from start of window to complete frame in microseconds */
+    double skew_mean_us; /**< Mean skew between valid samples of a frame in microseconds */
+    uint32_t skew_max_us; /**< Largest skew between valid samples of a frame in microseconds */
+    uint16_t buses; /**< Number of buses */
+    double utilisation[MLX90632_FRAME_MAX_BUSES]; /**< Share of time each bus was busy with register accesses */
+    uint32_t missed[MLX90632_FRAME_MAX_BUSES]; /**< Windows each bus skipped */
+} mlx90632_frame_stats_t;
+
+/** Frame assembled from the contributions of the buses */
+typedef struct mlx90632_frame_slot_s {
+    uint8_t state; /**< Slot is unused, assembling or handed over */
+    uint16_t pending; /**< Sensors which did not contribute yet */
+    mlx90632_frame_t frame; /**< Frame being assembled */
+} mlx90632_frame_slot_t;
+
+/** Acquisition engine */
+typedef struct mlx90632_frame_engine_s {
+    mlx90632_frame_bus_t bus[MLX90632_FRAME_MAX_BUSES]; /**< Buses */
+    uint16_t buses; /**< Number of buses */
+    uint16_t count; /**< Number of sensors on all buses */
+    mlx90632_frame_mode_t mode; /**< Acquisition mode */
+    uint32_t period_us; /**< Length of a window in microseconds */
+    uint64_t start_us; /**< Start of the first window on CLOCK_MONOTONIC in microseconds */
+    uint64_t stop_us; /**< Time the engine was stopped, 0 while it runs */
+    mlx90632_frame_cb_t callback; /**< Function called for every frame */
+    void *user; /**< User pointer passed to the callback */
+    int running; /**< Set while worker and compute threads run, accessed with __atomic builtins */
+    pthread_t compute; /**< Compute thread */
+    pthread_mutex_t lock; /**< Protects slots, queue and statistics */
+    pthread_cond_t ready; /**< Signalled when a frame is queued or engine stops */
+    mlx90632_frame_slot_t slot[MLX90632_FRAME_SLOTS]; /**< Frames being assembled */
+    mlx90632_frame_t queue[MLX90632_FRAME_QUEUE]; /**< Frames waiting for the compute thread */
+    uint16_t queue_head; /**< Index of the oldest queued frame */
+    uint16_t queue_count; /**< Number of queued frames */
+    mlx90632_frame_stats_t stats; /**< Frame statistics, bus statistics are filled in by @link mlx90632_frame_get_stats @endlink */
+    uint64_t latency_sum_us; /**< Sum of latencies of all frames */
+    uint64_t skew_sum_us; /**< Sum of skews of all frames */
+} mlx90632_frame_engine_t;
+
+/** Initialize engine without buses
+ *
+ * @param[out] engine Pointer to engine to initialize
+ */
+void mlx90632_frame_init(mlx90632_frame_engine_t *engine);
+
+/** Add bus with its devices to a stopped engine
+ *
+ * Devices get the next indexes of the frame in the given order.
+ *
+ * @param[in,out] engine Pointer to engine
+ * @param[in] devs Array of devices on the same i2c bus
+ * @param[in] count Number of devices
+ *
+ * @retval 0 Bus was added
+ * @retval -EINVAL No devices
+ * @retval -ENOBUFS Too many buses or too many devices on the bus
+ * @retval -EBUSY Engine is running
+ */
+int32_t mlx90632_frame_add_bus(mlx90632_frame_engine_t *engine, mlx90632_i2c_dev_t *const *devs, uint16_t count);
+
+/** Check the devices and start worker and compute threads
+ *
+ * Measurement type of every device is read and must match the mode. Period must be longer than the measurement
+ * time, or the dataset time in burst mode, of every device, otherwise not every sensor can deliver a sample in
+ * every window. First window starts when the function returns.
+ *
+ * @param[in,out] engine Pointer to engine
+ * @param[in] mode Acquisition mode
+ * @param[in] period_us Length of a window in microseconds
+ * @param[in] callback Function called for every frame
+ * @param[in] user User pointer passed to the callback
+ *
+ * @retval 0 Engine was started
+ * @retval -EINVAL No buses, measurement type of a device does not match the mode or period is too short
+ * @retval -EBUSY Engine is already running
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_frame_start(mlx90632_frame_engine_t *engine, mlx90632_frame_mode_t mode, uint32_t period_us,
+                             mlx90632_frame_cb_t callback, void *user);
+
+/** Stop the engine and wait for its threads
+ *
+ * Workers finish the window they are in, so this takes up to one period. Frames still waiting for buses which
+ * stopped in an earlier window are handed over as incomplete in window order, and together with the frames still
+ * queued are passed to the callback before the compute thread exits. Must not be called from the callback.
+ *
+ * @param[in,out] engine Pointer to engine
+ */
+void mlx90632_frame_stop(mlx90632_frame_engine_t *engine);
+
+/** Read statistics of the engine
+ *
+ * @param[in,out] engine Pointer to engine
+ * @param[out] stats Pointer to where statistics are written
+ */
+void mlx90632_frame_get_stats(mlx90632_frame_engine_t *engine, mlx90632_frame_stats_t *stats);
+
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @file mlx90632_i2c_dev.h
+ * @brief MLX90632 Linux i2c-dev backend
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API_linux MLX90632 Linux host backend
+ * @brief Optional implementation of the i2c functions from mlx90632_depends.h on top of /dev/i2c-N
+ *
+ * @details
+ * Every register access is a single I2C_RDWR ioctl: a read is the 16-bit register address write followed by a
+ * repeated start and the data read, so there is no window in which another master could move the address pointer.
+ * Consecutive registers (like the RAM table) are read with one message and scattered registers are batched in one
+ * ioctl, up to I2C_RDWR_IOCTL_MAX_MSGS messages.
+ *
+ * The ioctl goes through @link mlx90632_i2c_dev_s::transfer @endlink, which can be replaced with a fake for
+ * testing or benchmarking without hardware, and each call is counted in @link mlx90632_i2c_dev_s::transfers
+ * @endlink. The kernel i2c-stub module can be used the same way with the default transfer function.
+ *
+ * Sources of this backend are in src/linux/ and are built with `make linux`. They are not part of the MCU library.
+ * @{
+ */
+#ifndef _MLX90632_I2C_DEV_LIB_
+#define _MLX90632_I2C_DEV_LIB_
+
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_I2C_DEV_ADDR 0x3A /**< Default 7-bit slave address of MLX90632 */
+#define MLX90632_I2C_DEV_MAX_READS (I2C_RDWR_IOCTL_MAX_MSGS / 2) /**< Register reads which fit in one ioctl */
+
+/** Function which executes one combined transfer
+ *
+ * @param[in] fd File descriptor of the i2c adapter
+ * @param[in,out] data Messages to transfer
+ *
+ * @retval 0 All messages were transferred
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+typedef int32_t (*mlx90632_i2c_dev_transfer_t)(int fd, struct i2c_rdwr_ioctl_data *data);
+
+/** MLX90632 on a Linux i2c adapter */
+typedef struct mlx90632_i2c_dev_s {
+    int fd; /**< File descriptor of the opened i2c adapter */
+    uint16_t addr; /**< 7-bit slave address */
+    uint32_t transfers; /**< Number of transfers (ioctl system calls) done on this device */
+    mlx90632_i2c_dev_transfer_t transfer; /**< Transfer function, @link mlx90632_i2c_dev_ioctl @endlink by default */
+} mlx90632_i2c_dev_t;
+
+/** Default transfer function which issues the I2C_RDWR ioctl
+ *
+ * @param[in] fd File descriptor of the i2c adapter
+ * @param[in,out] data Messages to transfer
+ *
+ * @retval 0 All messages were transferred
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_i2c_dev_ioctl(int fd, struct i2c_rdwr_ioctl_data *data);
+
+/** Initialize device on already opened file descriptor
+ *
+ * Transfer function is set to @link mlx90632_i2c_dev_ioctl @endlink and can be replaced afterwards.
+ *
+ * @param[out] dev Pointer to device to initialize
+ * @param[in] fd File descriptor of the i2c adapter
+ * @param[in] addr 7-bit slave address of the sensor
+ */
+void mlx90632_i2c_dev_init(mlx90632_i2c_dev_t *dev, int fd, uint16_t addr);
+
+/** Open i2c adapter and initialize device on it
+ *
+ * @param[out] dev Pointer to device to initialize
+ * @param[in] path Path to the adapter, for example /dev/i2c-1
+ * @param[in] addr 7-bit slave address of the sensor
+ *
+ * @retval 0 Successfully opened
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_i2c_dev_open(mlx90632_i2c_dev_t *dev, const char *path, uint16_t addr);
+
+/** Close i2c adapter of the device
+ *
+ * @param[in,out] dev Pointer to device
+ */
+void mlx90632_i2c_dev_close(mlx90632_i2c_dev_t *dev);
+
+/** Select device used by the mlx90632_depends.h i2c functions in the calling thread
+ *
+ * mlx90632_i2c_read, mlx90632_i2c_write and mlx90632_i2c_read_block of this backend operate on the selected
+ * device, so library functions can be used with several sensors from different threads.
+ *
+ * @param[in] dev Pointer to device or NULL to deselect
+ */
+void mlx90632_i2c_dev_select(mlx90632_i2c_dev_t *dev);
+
+/** Read one register with a single combined transfer
+ *
+ * @param[in,out] dev Pointer to device
+ * @param[in] register_address Address of the register to be read from
+ * @param[out] value Pointer to where read data is written
+ *
+ * @retval 0 Successfully read
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_i2c_dev_read(mlx90632_i2c_dev_t *dev, int16_t register_address, uint16_t *value);
+
+/** Read consecutive registers with a single combined transfer
+ *
+ * @param[in,out] dev Pointer to device
+ * @param[in] register_address Address of the first register to be read from
+ * @param[out] value Pointer to array of at least words elements where read data is written
+ * @param[in] words Number of 16-bit registers to read
+ *
+ * @retval 0 Successfully read
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_i2c_dev_read_block(mlx90632_i2c_dev_t *dev, int16_t register_address, uint16_t *value,
+                                    uint16_t words);
+
+/** Read scattered registers with as few transfers as possible
+ *
+ * Up to @link MLX90632_I2C_DEV_MAX_READS @endlink registers are read in one transfer.
+ *
+ * @param[in,out] dev Pointer to device
+ * @param[in] register_address Pointer to array of count register addresses
+ * @param[out] value Pointer to array of count elements where read data is written
+ * @param[in] count Number of registers to read
+ *
+ * @retval 0 Successfully read
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_i2c_dev_read_multi(mlx90632_i2c_dev_t *dev, const int16_t *register_address, uint16_t *value,
+                                    uint16_t count);
+
+/** Write one register with a single transfer
+ *
+ * @param[in,out] dev Pointer to device
+ * @param[in] register_address Address of the register to be written to
+ * @param[in] value Value to be written
+ *
+ * @retval 0 Successfully written
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_i2c_dev_write(mlx90632_i2c_dev_t *dev, int16_t register_address, uint16_t value);
+
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * @file mlx90632_i2c_queue.h
+ * @brief MLX90632 queue coalescing transfers of several sensors into one I2C_RDWR ioctl
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API_linux MLX90632 Linux host backend
+ *
+ * @details
+ * Transfers of several sensors on the same i2c adapter are collected in a @link mlx90632_i2c_queue_t @endlink and
+ * handed to the kernel in one I2C_RDWR ioctl by @link mlx90632_i2c_queue_flush @endlink, after which the complete
+ * function of every transfer is called with its result. A read is two messages, so up to
+ * @link MLX90632_I2C_DEV_MAX_READS @endlink reads fit in one ioctl.
+ *
+ * This backend implements @link mlx90632_i2c_submit @endlink by adding the transfer to the queue and device
+ * selected with @link mlx90632_i2c_queue_select @endlink in the calling thread, so the asynchronous functions of
+ * mlx90632_async.h queue their RAM reads. Reading RAM of 16 sensors then costs one ioctl instead of 96.
+ *
+ * Built with `make linux`. mlx90632.h, mlx90632_depends.h and mlx90632_i2c_dev.h need to be included before this
+ * file.
+ * @{
+ */
+#ifndef _MLX90632_I2C_QUEUE_LIB_
+#define _MLX90632_I2C_QUEUE_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_I2C_QUEUE_MSGS I2C_RDWR_IOCTL_MAX_MSGS /**< Messages which fit in one queue */
+
+/** Transfers waiting for the next flush */
+typedef struct mlx90632_i2c_queue_s {
+    int fd; /**< File descriptor of the adapter of the queued transfers */
+    mlx90632_i2c_dev_transfer_t transfer; /**< Transfer function of the first queued device */
+    uint32_t transfers; /**< Number of transfers (ioctl system calls) done by flushes */
+    uint16_t count; /**< Number of queued transfers */
+    uint16_t nmsgs; /**< Number of queued messages */
+    struct i2c_msg msgs[MLX90632_I2C_QUEUE_MSGS]; /**< Messages of the queued transfers */
+    uint8_t buf[MLX90632_I2C_QUEUE_MSGS][4]; /**< Register address, and value of a write, of every transfer */
+    mlx90632_i2c_xfer_t *xfer[MLX90632_I2C_QUEUE_MSGS]; /**< Queued transfers */
+} mlx90632_i2c_queue_t;
+
+/** Initialize empty queue
+ *
+ * @param[out] queue Pointer to queue to initialize
+ */
+void mlx90632_i2c_queue_init(mlx90632_i2c_queue_t *queue);
+
+/** Add transfer of a device to the queue
+ *
+ * Nothing is sent before @link mlx90632_i2c_queue_flush @endlink. All devices in the queue must be on the same
+ * adapter.
+ *
+ * @param[in,out] queue Pointer to queue
+ * @param[in] dev Pointer to device the transfer is addressed to
+ * @param[in,out] xfer Pointer to transfer, owned by the queue until its complete function is called
+ *
+ * @retval 0 Transfer was queued
+ * @retval -EINVAL Transfer has no words, too many words, or a write of more than one word
+ * @retval -EXDEV Device is on a different adapter than the queued transfers
+ * @retval -ENOBUFS Transfer does not fit in the queue, flush it first
+ */
+int32_t mlx90632_i2c_queue_add(mlx90632_i2c_queue_t *queue, mlx90632_i2c_dev_t *dev, mlx90632_i2c_xfer_t *xfer);
+
+/** Send all queued transfers in one ioctl and complete them
+ *
+ * Queue is empty again before the first complete function is called, so complete functions can queue new
+ * transfers. When the ioctl fails every transfer completes with its error.
+ *
+ * @param[in,out] queue Pointer to queue
+ *
+ * @retval 0 All transfers succeeded or queue was empty
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_i2c_queue_flush(mlx90632_i2c_queue_t *queue);
+
+/** Select queue and device used by mlx90632_i2c_submit in the calling thread
+ *
+ * @param[in] queue Pointer to queue or NULL to deselect
+ * @param[in] dev Pointer to device which submitted transfers are addressed to
+ */
+void mlx90632_i2c_queue_select(mlx90632_i2c_queue_t *queue, mlx90632_i2c_dev_t *dev);
+
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,101 @@
+/**
+ * @file mlx90632_latest.h
+ * @brief MLX90632 latest sample cell for concurrent readers
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API_linux MLX90632 Linux host backend
+ *
+ * @details
+ * Acquisition thread publishes every calculated sample of a sensor into its cell and any number of threads (user
+ * interface, control loop, logger) read the latest one at their own rate, without a mutex between them.
+ *
+ * Cell is a sequence lock: the writer makes the sequence odd, stores the value and makes the sequence even again,
+ * and never waits for readers. Readers copy the value between two reads of the sequence and retry when it changed
+ * or was odd, so they get a consistent tuple of raw values, temperatures and timestamp. Readers only read the cell,
+ * so its cache line is shared between their cores instead of bouncing, and each cell is aligned to its own cache
+ * line so that cells of different sensors do not share one. Retries are bounded by
+ * @link MLX90632_LATEST_READ_TRIES @endlink, so a reader never spins behind a writer; since a write takes a few
+ * nanoseconds and samples come milliseconds apart, a reader needs a second try only rarely.
+ *
+ * There must be a single writer per cell. Cell uses gcc and clang __atomic builtins and is built with `make linux`.
+ * stdint.h needs to be included before this file.
+ * @{
+ */
+#ifndef _MLX90632_LATEST_LIB_
+#define _MLX90632_LATEST_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_LATEST_CACHE_LINE 64 /**< Alignment of a cell, size of cache line */
+#define MLX90632_LATEST_READ_TRIES 16 /**< Reads of a cell before reader gives up on a busy writer */
+
+/** Sample published in a cell */
+typedef struct mlx90632_latest_value_s {
+    uint64_t timestamp_us; /**< Time of the measurement in microseconds */
+    int16_t ambient_new_raw; /**< New raw ambient temperature */
+    int16_t ambient_old_raw; /**< Old raw ambient temperature */
+    int16_t object_new_raw; /**< New raw object temperature */
+    int16_t object_old_raw; /**< Old raw object temperature */
+    double ambient; /**< Ambient temperature in degrees Celsius */
+    double object; /**< Object temperature in degrees Celsius */
+} mlx90632_latest_value_t;
+
+#define MLX90632_LATEST_WORDS ((sizeof(mlx90632_latest_value_t) + 7) / 8) /**< 64-bit words of a value */
+
+/** Latest sample of one sensor */
+typedef struct mlx90632_latest_s {
+    uint32_t sequence; /**< Odd while the value is written, 0 before first publication */
+    uint64_t words[MLX90632_LATEST_WORDS]; /**< Value, copied with atomic word accesses */
+} __attribute__((aligned(MLX90632_LATEST_CACHE_LINE))) mlx90632_latest_t;
+
+/** Initialize cell without a value
+ *
+ * @param[out] cell Pointer to the cell
+ */
+void mlx90632_latest_init(mlx90632_latest_t *cell);
+
+/** Publish new value into the cell
+ *
+ * Never blocks. Must be called from a single writer per cell.
+ *
+ * @param[in,out] cell Pointer to the cell
+ * @param[in] value Pointer to the value to publish
+ */
+void mlx90632_latest_publish(mlx90632_latest_t *cell, const mlx90632_latest_value_t *value);
+
+/** Read latest value of the cell
+ *
+ * @param[in] cell Pointer to the cell
+ * @param[out] value Pointer to where consistent copy of the value is written
+ *
+ * @retval 0 Value was read
+ * @retval -ENODATA Nothing was published yet
+ * @retval -EAGAIN Writer changed the value during each of @link MLX90632_LATEST_READ_TRIES @endlink reads
+ */
+int32_t mlx90632_latest_read(const mlx90632_latest_t *cell, mlx90632_latest_value_t *value);
+
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
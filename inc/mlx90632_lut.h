@@ -0,0 +1,111 @@
+/**
+ * @file mlx90632_lut.h
+ * @brief MLX90632 object temperature from interpolated lookup table
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Optional converter for products without floating point unit or with tight duty cycle. At init the table is
+ * filled with object temperatures calculated by @link mlx90632_calc_temp_object @endlink on a uniform grid of
+ * preprocessed ambient and object values, for the calibration and emissivity at that time. Afterwards raw values
+ * are preprocessed and interpolated bilinearly in the table with integer math only.
+ *
+ * Table is provided by the caller, so its size can be traded against accuracy. Over 10 to 60 degrees Celsius
+ * ambient and -20 to 200 degrees Celsius object temperature, grid of 9 ambient by 65 object points (1170 bytes)
+ * keeps the error against @link mlx90632_calc_temp_object @endlink under 0.3 degrees Celsius and 17 by 129 points
+ * (4386 bytes) under 0.1 degrees Celsius for nominal calibration, and under 0.2 degrees Celsius with calibration
+ * parameters spread by 20 percent, as checked by `make validate`. Error is largest at cold objects, where temperature is most curved in
+ * the object signal, so object points matter more than ambient points. tools/bench/bench_lut.c reports error of
+ * more grid sizes.
+ */
+#ifndef _MLX90632_LUT_LIB_
+#define _MLX90632_LUT_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_LUT_SCALE 100 /**< Table entries per degree Celsius */
+#define MLX90632_LUT_INVALID_LOW INT16_MIN /**< Table entry of grid point below range of table entries */
+#define MLX90632_LUT_INVALID_HIGH INT16_MAX /**< Table entry of grid point above range of table entries */
+
+/** Number of table entries for a grid of ambient_points by object_points */
+#define MLX90632_LUT_SIZE(ambient_points, object_points) ((ambient_points) * (object_points))
+
+/** Lookup table of object temperature */
+typedef struct mlx90632_lut_s {
+    int16_t *temp; /**< Object temperature in 1/@link MLX90632_LUT_SCALE @endlink degrees Celsius, by ambient rows */
+    uint16_t ambient_points; /**< Number of grid points of preprocessed ambient */
+    uint16_t object_points; /**< Number of grid points of preprocessed object */
+    int32_t ambient_min; /**< Preprocessed ambient of the first grid point */
+    int32_t ambient_step; /**< Distance of preprocessed ambient grid points */
+    int32_t object_min; /**< Preprocessed object of the first grid point */
+    int32_t object_step; /**< Distance of preprocessed object grid points */
+    int16_t Gb; /**< Register value on @link MLX90632_EE_Gb @endlink for preprocessing */
+    int16_t Ka; /**< Register value on @link MLX90632_EE_Ka @endlink for preprocessing */
+} mlx90632_lut_t;
+
+/** Fill lookup table for calibration parameters and current emissivity
+ *
+ * Grid spans preprocessed values which correspond to the given ambient and object temperature ranges. Calculation
+ * uses floating point and is done once, table needs to be filled again when emissivity changes. Since preprocessed
+ * object value of a temperature depends on ambient, grid points in the corners can be outside of the requested
+ * range and are marked invalid when they do not fit into the table entries.
+ *
+ * @param[out] lut Pointer to the lookup table
+ * @param[in] table Pointer to @link MLX90632_LUT_SIZE @endlink entries of storage for the table
+ * @param[in] ambient_points Number of grid points of ambient temperature, at least 2
+ * @param[in] object_points Number of grid points of object temperature, at least 2
+ * @param[in] calib Pointer to calibration parameters
+ * @param[in] ambient_min Lowest ambient temperature in degrees Celsius
+ * @param[in] ambient_max Highest ambient temperature in degrees Celsius
+ * @param[in] object_min Lowest object temperature in degrees Celsius
+ * @param[in] object_max Highest object temperature in degrees Celsius
+ *
+ * @retval 0 Table was filled
+ * @retval -EINVAL Less than 2 points or empty temperature range
+ * @retval -ERANGE Object temperature range does not fit into the table entries
+ */
+int32_t mlx90632_lut_init(mlx90632_lut_t *lut, int16_t *table, uint16_t ambient_points, uint16_t object_points,
+                          const mlx90632_calib_t *calib, double ambient_min, double ambient_max,
+                          double object_min, double object_max);
+
+/** Calculate object temperature from raw values with integer math
+ *
+ * @param[in] lut Pointer to the filled lookup table
+ * @param[in] ambient_new_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] ambient_old_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] object_new_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ * @param[in] object_old_raw object temperature from @link MLX90632_RAM_1 @endlink and @link MLX90632_RAM_2 @endlink
+ * @param[out] object Object temperature in millidegrees Celsius
+ *
+ * @retval 0 Temperature was calculated
+ * @retval -ERANGE Preprocessed values are outside of the grid, or next to a grid point whose temperature does
+ *                 not fit into the table entries
+ */
+int32_t mlx90632_lut_calc_temp_object(const mlx90632_lut_t *lut, int16_t ambient_new_raw, int16_t ambient_old_raw,
+                                      int16_t object_new_raw, int16_t object_old_raw, int32_t *object);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,123 @@
+/**
+ * @file mlx90632_newton.h
+ * @brief MLX90632 object temperature solver with Halley steps
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Object temperature of DSPv5 is the solution of
+ * T = ((object / (emissivity * Alpha * (1 + Gb' + Ga' * (T - 25)))) + Ta4)^(1/4) - 273.15 - Hb', where the gain
+ * term depends on T itself. @link mlx90632_calc_temp_object @endlink solves it with five fixed-point substitutions,
+ * whose convergence depends on Ga and emissivity. Functions below apply
+ * @link MLX90632_NEWTON_STEPS @endlink Halley steps, Newton steps which also use the second derivative, on the
+ * same equation written as polynomial in Kelvin. They start from its closed-form solution with the gain fixed at
+ * 25 degrees Celsius. Within the object temperature range of the sensor three steps are within 1e-12 degrees
+ * Celsius, so at machine precision, of the converged solution for both medical and extended range, where five
+ * fixed-point substitutions can be off by a few degrees at low emissivity. Two steps only reach 4e-9 degrees
+ * Celsius for the medical and 6e-7 degrees Celsius for the extended range, so the default is three. Inputs and
+ * results are the same as for the functions they replace.
+ * Accuracy and speed of both are compared by tools/bench/bench_newton.c.
+ */
+#ifndef _MLX90632_NEWTON_LIB_
+#define _MLX90632_NEWTON_LIB_
+
+#include "mlx90632_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef MLX90632_NEWTON_STEPS
+#define MLX90632_NEWTON_STEPS 3 /**< Number of Halley steps starting from the closed-form solution */
+#endif
+
+/** Calculation of object temperature with Halley steps
+ *
+ * Same as @link mlx90632_calc_temp_object @endlink, including emissivity set with
+ * @link mlx90632_set_emissivity @endlink.
+ *
+ * @param[in] object object temperature from @link mlx90632_preprocess_temp_object @endlink
+ * @param[in] ambient ambient temperature from @link mlx90632_preprocess_temp_ambient @endlink
+ * @param[in] Ea Register value on @link MLX90632_EE_Ea @endlink
+ * @param[in] Eb Register value on @link MLX90632_EE_Eb @endlink
+ * @param[in] Ga Register value on @link MLX90632_EE_Ga @endlink
+ * @param[in] Fa Register value on @link MLX90632_EE_Fa @endlink
+ * @param[in] Fb Register value on @link MLX90632_EE_Fb @endlink
+ * @param[in] Ha Register value on @link MLX90632_EE_Ha @endlink
+ * @param[in] Hb Register value on @link MLX90632_EE_Hb @endlink
+ *
+ * @return Calculated object temperature in degrees Celsius
+ */
+double mlx90632_calc_temp_object_newton(int32_t object, int32_t ambient,
+                                        int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
+                                        int16_t Ha, int16_t Hb);
+
+#if MLX90632_ENABLE_REFLECTED
+/** Calculation of object temperature with reflected temperature compensation and Halley steps
+ *
+ * Same as @link mlx90632_calc_temp_object_reflected @endlink.
+ *
+ * @param[in] object object temperature from @link mlx90632_preprocess_temp_object @endlink
+ * @param[in] ambient ambient temperature from @link mlx90632_preprocess_temp_ambient @endlink
+ * @param[in] reflected temperature of the environment in degrees Celsius
+ * @param[in] Ea Register value on @link MLX90632_EE_Ea @endlink
+ * @param[in] Eb Register value on @link MLX90632_EE_Eb @endlink
+ * @param[in] Ga Register value on @link MLX90632_EE_Ga @endlink
+ * @param[in] Fa Register value on @link MLX90632_EE_Fa @endlink
+ * @param[in] Fb Register value on @link MLX90632_EE_Fb @endlink
+ * @param[in] Ha Register value on @link MLX90632_EE_Ha @endlink
+ * @param[in] Hb Register value on @link MLX90632_EE_Hb @endlink
+ *
+ * @return Calculated object temperature in degrees Celsius
+ */
+double mlx90632_calc_temp_object_reflected_newton(int32_t object, int32_t ambient, double reflected,
+                                                  int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
+                                                  int16_t Ha, int16_t Hb);
+#endif
+
+#if MLX90632_ENABLE_EXTENDED
+/** Calculation of object temperature for the extended range with Halley steps
+ *
+ * Same as @link mlx90632_calc_temp_object_extended @endlink.
+ *
+ * @param[in] object object temperature from @link mlx90632_preprocess_temp_object_extended @endlink
+ * @param[in] ambient ambient temperature from @link mlx90632_preprocess_temp_ambient_extended @endlink
+ * @param[in] reflected temperature of the environment in degrees Celsius
+ * @param[in] Ea Register value on @link MLX90632_EE_Ea @endlink
+ * @param[in] Eb Register value on @link MLX90632_EE_Eb @endlink
+ * @param[in] Ga Register value on @link MLX90632_EE_Ga @endlink
+ * @param[in] Fa Register value on @link MLX90632_EE_Fa @endlink
+ * @param[in] Fb Register value on @link MLX90632_EE_Fb @endlink
+ * @param[in] Ha Register value on @link MLX90632_EE_Ha @endlink
+ * @param[in] Hb Register value on @link MLX90632_EE_Hb @endlink
+ *
+ * @return Calculated object temperature in degrees Celsius
+ */
+double mlx90632_calc_temp_object_extended_newton(int32_t object, int32_t ambient, double reflected,
+                                                 int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
+                                                 int16_t Ha, int16_t Hb);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ * @file mlx90632_sample.h
+ * @brief MLX90632 raw read functions with per-sample metadata
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Variants of the raw read functions which fill a @link mlx90632_sample_t @endlink in place. Status register value
+ * is the one already read while waiting for the measurement, so the metadata costs no additional bus access.
+ *
+ * Functions in this file require @link mlx90632_get_time_us @endlink to be implemented.
+ */
+#ifndef _MLX90632_SAMPLE_LIB_
+#define _MLX90632_SAMPLE_LIB_
+
+#include "mlx90632_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Raw sample together with the information about when and how it was measured */
+typedef struct mlx90632_sample_s {
+    uint64_t timestamp_us; /**< Time at which the measurement was seen complete, from @link mlx90632_get_time_us @endlink */
+    int16_t ambient_new_raw; /**< New raw ambient temperature */
+    int16_t ambient_old_raw; /**< Old raw ambient temperature */
+    int16_t object_new_raw; /**< New raw object temperature */
+    int16_t object_old_raw; /**< Old raw object temperature, 0 for extended range */
+    uint16_t status; /**< @link MLX90632_REG_STATUS @endlink value which completed the wait, 0 when it was not read */
+    uint8_t cycle_pos; /**< Channel position of the new measurement, see @link MLX90632_STAT_CYCLE_POS @endlink */
+    uint8_t meas_type; /**< Measurement type, one of MLX90632_MTYP_* values */
+} mlx90632_sample_t;
+
+/** Statistics of a @link mlx90632_capture @endlink run */
+typedef struct mlx90632_capture_stats_s {
+    uint32_t missed; /**< Number of measurement cycles which completed between two captured samples */
+    uint32_t duplicated; /**< Number of captured samples which were the same measurement as the previous one */
+} mlx90632_capture_stats_t;
+
+/** Read raw ambient and object temperature into sample only when measurement data is ready
+ *
+ * Same as @link mlx90632_read_temp_raw_wo_wait @endlink. Since status register is not read, status is set to 0 and
+ * meas_type tells only the measurement range (@link MLX90632_MTYP_MEDICAL @endlink), timestamp is the time of the read.
+ *
+ * @param[in] channel_position Channel position where new (recently updated) measurement can be found
+ * @param[out] sample Pointer to sample which is filled
+ *
+ * @retval 0 Successfully read both temperatures
+ * @retval <0 Something went wrong. Check errno.h for more details
+ *
+ * @note This function is not blocking!
+ */
+int32_t mlx90632_read_temp_raw_wo_wait_sample(int32_t channel_position, mlx90632_sample_t *sample);
+
+/** Trigger and read raw ambient and object temperature into sample
+ *
+ * Same as @link mlx90632_read_temp_raw @endlink.
+ *
+ * @param[out] sample Pointer to sample which is filled
+ *
+ * @retval 0 Successfully read both temperatures
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_read_temp_raw_sample(mlx90632_sample_t *sample);
+
+#if MLX90632_ENABLE_BURST
+/** Trigger and read raw ambient and object temperature into sample in sleeping step mode
+ *
+ * Same as @link mlx90632_read_temp_raw_burst @endlink.
+ *
+ * @param[out] sample Pointer to sample which is filled
+ *
+ * @retval 0 Successfully read both temperatures
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_read_temp_raw_burst_sample(mlx90632_sample_t *sample);
+#endif
+
+#if MLX90632_ENABLE_EXTENDED
+/** Read raw ambient and object temperature for extended range into sample only when measurement data is ready
+ *
+ * Same as @link mlx90632_read_temp_raw_extended_wo_wait @endlink. Since status register is not read, status is set
+ * to 0 and meas_type tells only the measurement range (@link MLX90632_MTYP_EXTENDED @endlink), timestamp is the time
+ * of the read.
+ *
+ * @param[out] sample Pointer to sample which is filled
+ *
+ * @retval 0 Successfully read both temperatures
+ * @retval <0 Something went wrong. Check errno.h for more details
+ *
+ * @note This function is not blocking!
+ */
+int32_t mlx90632_read_temp_raw_extended_wo_wait_sample(mlx90632_sample_t *sample);
+
+/** Trigger and read raw ambient and object temperature for extended range into sample
+ *
+ * Same as @link mlx90632_read_temp_raw_extended @endlink.
+ *
+ * @param[out] sample Pointer to sample which is filled
+ *
+ * @retval 0 Successfully read both temperatures
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_read_temp_raw_extended_sample(mlx90632_sample_t *sample);
+#endif
+
+#if MLX90632_ENABLE_EXTENDED && MLX90632_ENABLE_BURST
+/** Trigger and read raw ambient and object temperature for extended range into sample in sleeping step mode
+ *
+ * Same as @link mlx90632_read_temp_raw_extended_burst @endlink.
+ *
+ * @param[out] sample Pointer to sample which is filled
+ *
+ * @retval 0 Successfully read both temperatures
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_read_temp_raw_extended_burst_sample(mlx90632_sample_t *sample);
+#endif
+
+/** Read durations of both medical measurements, reset statistics and trigger measurement
+ *
+ * First step of @link mlx90632_capture @endlink and of other capture loops of consecutive medical cycles.
+ *
+ * @param[out] period_us Durations of the first and second medical measurement in microseconds
+ * @param[out] stats Capture statistics to reset
+ *
+ * @retval 0 Capture can start
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_capture_start(uint32_t period_us[2], mlx90632_capture_stats_t *stats);
+
+/** Account missed and duplicated cycles between two consecutive captured samples
+ *
+ * In medical continuous mode the cycle position alternates between 1 and 2, so the number of elapsed cycles must be
+ * odd when position changed and even when it did not. Elapsed time rounded to the number of cycles is corrected to
+ * the nearest value with the right parity.
+ *
+ * @param[in] prev Previous captured sample
+ * @param[in] cur Current captured sample
+ * @param[in] period_us Duration of the measurement following prev in microseconds
+ * @param[in,out] stats Capture statistics to update
+ */
+void mlx90632_capture_account(const mlx90632_sample_t *prev, const mlx90632_sample_t *cur, uint32_t period_us,
+                              mlx90632_capture_stats_t *stats);
+
+/** Capture consecutive measurement cycles in medical continuous mode into a caller provided buffer
+ *
+ * Measurement duration of both medical measurements is read once. After each sample the function sleeps until
+ * shortly before the expected completion of the next measurement and then polls the status register with a short
+ * interval, so no cycle is lost to the 10 ms polling of @link mlx90632_wait_for_measurement @endlink. Status
+ * register value read while polling is reused to clear the data ready flag, after which the raw values are read.
+ *
+ * Missed and duplicated cycles are detected from the alternating cycle position and the time between samples.
+ *
+ * @param[out] buf Pointer to array of at least n samples which is filled
+ * @param[in] n Number of samples to capture
+ * @param[out] stats Pointer to where capture statistics are written
+ *
+ * @retval 0 Successfully captured n samples
+ * @retval <0 Something went wrong. Check errno.h for more details. Samples captured so far are in buf
+ *
+ * @note This function is using usleep so it is blocking for about n measurement cycles!
+ */
+int32_t mlx90632_capture(mlx90632_sample_t *buf, uint32_t n, mlx90632_capture_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,214 @@
+/**
+ * @file mlx90632_shm.h
+ * @brief MLX90632 shared memory sample rings for other processes
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API_linux MLX90632 Linux host backend
+ *
+ * @details
+ * Acquisition process publishes every sample of its sensors into a POSIX shared memory object and analytics,
+ * logging or user interface processes map the same object read-only and read samples straight from it, without
+ * sockets or system calls per sample.
+ *
+ * Object has a fixed layout: @link mlx90632_shm_header_t @endlink, followed by one ring per device. Each ring is
+ * @link mlx90632_shm_ring_t @endlink with the number of published samples, followed by a power of two number of
+ * @link mlx90632_shm_slot_t @endlink. Sample number n of a device is in slot n modulo the number of slots. All of
+ * them are aligned to a cache line. Header carries @link MLX90632_SHM_MAGIC @endlink and
+ * @link MLX90632_SHM_VERSION @endlink, which is incremented whenever the layout changes, so that readers built
+ * against a different layout refuse to open the object instead of misreading it.
+ *
+ * Every slot is a sequence lock over the 64-bit sample number. Writer never waits for readers, and readers never
+ * write to the object and never retry: a read either returns a consistent sample, or tells that the sample is not
+ * published yet or was already overwritten by the writer, in which case the reader skips ahead with
+ * @link mlx90632_shm_head @endlink. Readers which keep up can therefore follow every sample, while slow readers
+ * lose the oldest ones and never slow down acquisition.
+ *
+ * There must be a single writer per object. Needs lock-free 64-bit gcc and clang __atomic builtins, which all
+ * 64-bit targets have, and is built with `make linux`. mlx90632.h needs to be included before this file.
+ * @{
+ */
+#ifndef _MLX90632_SHM_LIB_
+#define _MLX90632_SHM_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLX90632_SHM_MAGIC 0x4D4C5832 /**< First word of the object, ASCII MLX2 */
+#define MLX90632_SHM_VERSION 1 /**< Version of the object layout */
+#define MLX90632_SHM_CACHE_LINE 64 /**< Alignment of header, rings and slots */
+
+/** Sample of one device as stored in the shared memory */
+typedef struct mlx90632_shm_sample_s {
+    uint64_t timestamp_us; /**< Time of the measurement in microseconds */
+    int16_t ambient_new_raw; /**< New raw ambient temperature */
+    int16_t ambient_old_raw; /**< Old raw ambient temperature */
+    int16_t object_new_raw; /**< New raw object temperature */
+    int16_t object_old_raw; /**< Old raw object temperature */
+    double ambient; /**< Ambient temperature in degrees Celsius */
+    double object; /**< Object temperature in degrees Celsius */
+} mlx90632_shm_sample_t;
+
+#define MLX90632_SHM_WORDS ((sizeof(mlx90632_shm_sample_t) + 7) / 8) /**< 64-bit words of a sample */
+
+/** Header at the start of the object */
+typedef struct mlx90632_shm_header_s {
+    uint32_t magic; /**< @link MLX90632_SHM_MAGIC @endlink, written last when the object is ready */
+    uint16_t version; /**< @link MLX90632_SHM_VERSION @endlink */
+    uint16_t header_size; /**< Size of the header in bytes, offset of the first ring */
+    uint32_t ring_size; /**< Size of one ring including its slots in bytes */
+    uint32_t slot_size; /**< Size of one slot in bytes */
+    uint32_t devices; /**< Number of rings */
+    uint32_t slots; /**< Number of slots in each ring, power of two */
+} __attribute__((aligned(MLX90632_SHM_CACHE_LINE))) mlx90632_shm_header_t;
+
+/** Slot of a ring */
+typedef struct mlx90632_shm_slot_s {
+    uint64_t sequence; /**< 2 * (n + 1) when sample n is stored, odd while it is written, 0 if never written */
+    uint64_t words[MLX90632_SHM_WORDS]; /**< Sample, copied with atomic word accesses */
+} __attribute__((aligned(MLX90632_SHM_CACHE_LINE))) mlx90632_shm_slot_t;
+
+/** Sample ring of one device */
+typedef struct mlx90632_shm_ring_s {
+    uint64_t head; /**< Number of samples published to the ring */
+    mlx90632_shm_slot_t slot[]; /**< Slots, number of them is in @link mlx90632_shm_header_s::slots @endlink */
+} mlx90632_shm_ring_t;
+
+/** Mapping of the shared memory object in this process */
+typedef struct mlx90632_shm_s {
+    int fd; /**< File descriptor of the object */
+    size_t size; /**< Size of the mapping in bytes */
+    mlx90632_shm_header_t *header; /**< Mapped object */
+    uint32_t devices; /**< Number of rings */
+    uint32_t slots; /**< Number of slots in each ring */
+} mlx90632_shm_t;
+
+/** Create shared memory object and map it for writing
+ *
+ * An existing object with the same name is replaced. Processes which had it mapped keep the old one and need to
+ * open the name again.
+ *
+ * @param[out] shm Pointer to mapping to initialize
+ * @param[in] name Name of the object, for example /mlx90632
+ * @param[in] devices Number of device rings
+ * @param[in] slots Number of samples kept for each device, power of two
+ *
+ * @retval 0 Object created
+ * @retval -EINVAL Devices or slots are 0 or slots is not a power of two
+ * @retval -ENOTSUP 64-bit atomic operations are not lock-free on this target
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_shm_create(mlx90632_shm_t *shm, const char *name, uint32_t devices, uint32_t slots);
+
+/** Open existing shared memory object and map it read-only
+ *
+ * @param[out] shm Pointer to mapping to initialize
+ * @param[in] name Name of the object given to @link mlx90632_shm_create @endlink
+ *
+ * @retval 0 Object opened
+ * @retval -EPROTO Object has a different magic, version or layout
+ * @retval -ENOTSUP 64-bit atomic operations are not lock-free on this target
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_shm_open(mlx90632_shm_t *shm, const char *name);
+
+/** Unmap shared memory object
+ *
+ * Object itself stays until @link mlx90632_shm_unlink @endlink.
+ *
+ * @param[in,out] shm Pointer to mapping
+ */
+void mlx90632_shm_close(mlx90632_shm_t *shm);
+
+/** Remove name of the shared memory object
+ *
+ * @param[in] name Name of the object
+ *
+ * @retval 0 Name removed
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_shm_unlink(const char *name);
+
+/** Publish next sample of a device
+ *
+ * Never blocks. Must be called from a single writer per object.
+ *
+ * @param[in,out] shm Pointer to mapping created with @link mlx90632_shm_create @endlink
+ * @param[in] device Index of the device ring
+ * @param[in] sample Pointer to the sample to publish
+ *
+ * @retval 0 Sample published
+ * @retval -EINVAL Device index is out of range
+ */
+int32_t mlx90632_shm_publish(mlx90632_shm_t *shm, uint32_t device, const mlx90632_shm_sample_t *sample);
+
+/** Read measurement which is ready, calculate temperatures and publish them
+ *
+ * Replaces @link mlx90632_read_temp_raw_wo_wait @endlink in the acquisition loop once data ready was seen. Raw
+ * values are read through the i2c functions of mlx90632_depends.h, so with the i2c-dev backend the device needs to be
+ * selected with @link mlx90632_i2c_dev_select @endlink first. Object temperature uses the emissivity set with
+ * @link mlx90632_set_emissivity @endlink.
+ *
+ * @param[in,out] shm Pointer to mapping created with @link mlx90632_shm_create @endlink
+ * @param[in] device Index of the device ring
+ * @param[in] channel_position Channel position as for @link mlx90632_read_temp_raw_wo_wait @endlink
+ * @param[in] calib Pointer to calibration parameters of the device
+ * @param[in] timestamp_us Time of the measurement in microseconds
+ *
+ * @retval 0 Sample published
+ * @retval -EINVAL Device index is out of range
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_shm_acquire(mlx90632_shm_t *shm, uint32_t device, int32_t channel_position,
+                             const mlx90632_calib_t *calib, uint64_t timestamp_us);
+
+/** Number of samples published for a device
+ *
+ * Latest sample is head - 1 and the oldest one which can still be read is head - slots.
+ *
+ * @param[in] shm Pointer to mapping
+ * @param[in] device Index of the device ring, must be less than number of devices
+ *
+ * @return Number of samples published to the ring
+ */
+uint64_t mlx90632_shm_head(const mlx90632_shm_t *shm, uint32_t device);
+
+/** Read sample of a device by its number
+ *
+ * Wait-free: reads the slot once and never retries.
+ *
+ * @param[in] shm Pointer to mapping
+ * @param[in] device Index of the device ring
+ * @param[in] n Number of the sample, counted from 0
+ * @param[out] sample Pointer to where consistent copy of the sample is written
+ *
+ * @retval 0 Sample was read
+ * @retval -EINVAL Device index is out of range
+ * @retval -ENODATA Sample is not published yet
+ * @retval -EOVERFLOW Sample was overwritten, reader needs to continue from a later one
+ */
+int32_t mlx90632_shm_read(const mlx90632_shm_t *shm, uint32_t device, uint64_t n, mlx90632_shm_sample_t *sample);
+
+///@}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
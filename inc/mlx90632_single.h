@@ -0,0 +1,77 @@
+/**
+ * @file mlx90632_single.h
+ * @brief MLX90632 on-demand single measurement pipeline
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_API MLX90632 Driver Library API
+ *
+ * @details
+ * Single (step) mode measurement refreshes only one channel of the medical measurement table per trigger, so
+ * after power-up it needs to be triggered and completed twice before both channels contain valid data. The
+ * pipeline below keeps track of that warm-up, caches the last read value of each channel and reads only the
+ * channel which was updated by the latest trigger.
+ *
+ * Functions in this file require @link mlx90632_get_time_us @endlink to be implemented.
+ */
+#ifndef _MLX90632_SINGLE_LIB_
+#define _MLX90632_SINGLE_LIB_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of single measurements needed after power-up before both channels hold valid data */
+#define MLX90632_SINGLE_WARMUP_MEASUREMENTS 2
+
+/** Prepare the mlx90632 for on-demand single measurements
+ *
+ * Puts the sensor in step mode with medical measurement type, caches measurement duration of both medical
+ * measurements from @link MLX90632_EE_MEDICAL_MEAS1 @endlink and @link MLX90632_EE_MEDICAL_MEAS2 @endlink and
+ * restarts the warm-up. Call it again after sensor power-up or reset.
+ *
+ * @retval 0 Successfully prepared the single measurement pipeline
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+int32_t mlx90632_single_init(void);
+
+/** Trigger a single measurement, wait for it and calculate the temperatures
+ *
+ * If the pipeline is not warmed-up yet, required additional measurements are triggered and completed first.
+ * Each trigger is followed by a sleep of exactly the measurement duration of the channel which is expected to
+ * be updated, after which only its three RAM words are read. The other channel is taken from the cache.
+ *
+ * @param[in] calib Calibration parameters of the sensor
+ * @param[out] ambient Pointer to where ambient temperature in degrees Celsius is written
+ * @param[out] object Pointer to where object temperature in degrees Celsius is written
+ * @param[out] latency_us Pointer to where time from the trigger to calculated result in microseconds is written
+ *
+ * @retval 0 Successfully measured and calculated both temperatures
+ * @retval -EINVAL Pipeline was not initialized via @link mlx90632_single_init @endlink or invalid cycle position
+ * @retval <0 Something went wrong. Check errno.h for more details
+ *
+ * @note This function is using msleep and usleep so it is blocking!
+ */
+int32_t mlx90632_single_measurement(const mlx90632_calib_t *calib, double *ambient, double *object,
+                                    uint32_t *latency_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,256 @@
+/**
+ * @file mlx90632_epoll.c
+ * @brief timerfd and epoll integration of MLX90632 driver for Linux hosts
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+
+#include "mlx90632.h"
+#include "mlx90632_i2c_dev.h"
+#include "mlx90632_epoll.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+/* Register access through the selected device, same prototypes as in mlx90632_depends.h */
+extern int32_t mlx90632_i2c_read(int16_t register_address, uint16_t *value);
+extern int32_t mlx90632_i2c_write(int16_t register_address, uint16_t value);
+
+/** Current CLOCK_MONOTONIC time in microseconds */
+STATIC uint64_t mlx90632_epoll_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/** Arm sensor timer at absolute CLOCK_MONOTONIC time in microseconds */
+STATIC int32_t mlx90632_epoll_arm(mlx90632_epoll_sensor_t *sensor, uint64_t time_us)
+{
+    struct itimerspec its;
+
+    its.it_interval.tv_sec = 0;
+    its.it_interval.tv_nsec = 0;
+    its.it_value.tv_sec = (time_t)(time_us / 1000000);
+    its.it_value.tv_nsec = (long)(time_us % 1000000) * 1000;
+
+    if (timerfd_settime(sensor->timer_fd, TFD_TIMER_ABSTIME, &its, NULL) < 0)
+        return -errno;
+
+    return 0;
+}
+
+int32_t mlx90632_epoll_add(int epoll_fd, mlx90632_epoll_sensor_t *sensor, mlx90632_i2c_dev_t *dev,
+                           const mlx90632_calib_t *calib, mlx90632_epoll_cb_t callback, void *user)
+{
+    struct epoll_event event;
+    int32_t ret;
+
+    sensor->dev = dev;
+    sensor->calib = calib;
+    sensor->callback = callback;
+    sensor->user = user;
+    sensor->retries = 0;
+    sensor->late = 0;
+    sensor->cycle_pos = 0;
+    sensor->timer_fd = -1;
+
+    mlx90632_i2c_dev_select(dev);
+
+    ret = mlx90632_get_measurement_time(MLX90632_EE_MEDICAL_MEAS1);
+    if (ret < 0)
+        return ret;
+    sensor->period_us[0] = (uint32_t)ret * 1000;
+
+    ret = mlx90632_get_measurement_time(MLX90632_EE_MEDICAL_MEAS2);
+    if (ret < 0)
+        return ret;
+    sensor->period_us[1] = (uint32_t)ret * 1000;
+
+    ret = mlx90632_trigger_measurement();
+    if (ret < 0)
+        return ret;
+
+    sensor->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (sensor->timer_fd < 0)
+        return -errno;
+
+    // Channel which is measured now is not known, so wait for the longer one
+    sensor->deadline_us = mlx90632_epoll_now() +
+                          (sensor->period_us[0] > sensor->period_us[1] ? sensor->period_us[0] : sensor->period_us[1]);
+    ret = mlx90632_epoll_arm(sensor, sensor->deadline_us);
+    if (ret < 0)
+        goto err_close;
+
+    event.events = EPOLLIN;
+    event.data.ptr = sensor;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, sensor->timer_fd, &event) < 0)
+    {
+        ret = -errno;
+        goto err_close;
+    }
+
+    return 0;
+
+err_close:
+    close(sensor->timer_fd);
+    sensor->timer_fd = -1;
+    return ret;
+}
+
+void mlx90632_epoll_remove(int epoll_fd, mlx90632_epoll_sensor_t *sensor)
+{
+    if (sensor->timer_fd < 0)
+        return;
+
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, sensor->timer_fd, NULL);
+    close(sensor->timer_fd);
+    sensor->timer_fd = -1;
+}
+
+/** Read raw values of the measurement which is ready and calculate temperatures
+ *
+ * @param[in] sensor Pointer to sensor state
+ * @param[out] ambient Pointer to where ambient temperature is written
+ * @param[out] object Pointer to where object temperature is written
+ *
+ * @retval 0 Temperatures calculated
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+STATIC int32_t mlx90632_epoll_calculate(const mlx90632_epoll_sensor_t *sensor, double *ambient, double *object)
+{
+    const mlx90632_calib_t *calib = sensor->calib;
+    int16_t ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw;
+    double pre_ambient, pre_object;
+    int32_t ret;
+
+    ret = mlx90632_read_temp_raw_wo_wait(sensor->cycle_pos, &ambient_new_raw, &ambient_old_raw,
+                                         &object_new_raw, &object_old_raw);
+    if (ret < 0)
+        return ret;
+
+    *ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw,
+                                          calib->P_T, calib->P_R, calib->P_G, calib->P_O, calib->Gb);
+
+    pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib->Gb);
+    pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                 ambient_new_raw, ambient_old_raw, calib->Ka);
+    *object = mlx90632_calc_temp_object(pre_object, pre_ambient, calib->Ea, calib->Eb, calib->Ga,
+                                        calib->Fa, calib->Fb, calib->Ha, calib->Hb);
+
+    return 0;
+}
+
+int32_t mlx90632_epoll_dispatch(mlx90632_epoll_sensor_t *sensor)
+{
+    double ambient = 0.0, object = 0.0;
+    uint64_t expirations, now;
+    uint32_t period;
+    uint16_t reg_status;
+    int32_t ret;
+
+    // Acknowledge the expiry, timer is non-blocking so nothing happens when dispatched without it
+    if (read(sensor->timer_fd, &expirations, sizeof(expirations)) < 0)
+        expirations = 0;
+
+    mlx90632_i2c_dev_select(sensor->dev);
+
+    ret = mlx90632_i2c_read(MLX90632_REG_STATUS, &reg_status);
+    now = mlx90632_epoll_now();
+    if (ret < 0)
+        goto err_rearm;
+
+    if (!(reg_status & MLX90632_STAT_DATA_RDY))
+    {
+        if (sensor->retries++ == 0)
+            sensor->late++;
+
+        if ((uint64_t)sensor->retries * MLX90632_EPOLL_RETRY_TIME > sensor->period_us[0] + sensor->period_us[1])
+        {
+            sensor->retries = 0;
+            ret = -ETIMEDOUT;
+            goto err_rearm;
+        }
+
+        ret = mlx90632_epoll_arm(sensor, now + MLX90632_EPOLL_RETRY_TIME);
+        return ret < 0 ? ret : 0;
+    }
+
+    ret = mlx90632_i2c_write(MLX90632_REG_STATUS, reg_status & (~MLX90632_STAT_DATA_RDY));
+    if (ret < 0)
+        goto err_rearm;
+
+    sensor->cycle_pos = (reg_status & MLX90632_STAT_CYCLE_POS) >> 2;
+    period = sensor->period_us[sensor->cycle_pos == 1 ? 1 : 0];
+
+    // Data found at the first read keeps the schedule, otherwise it is resynchronized to the time it was seen
+    if ((sensor->retries == 0) && (sensor->deadline_us + period > now + MLX90632_EPOLL_ADVANCE))
+        sensor->deadline_us += period - MLX90632_EPOLL_ADVANCE;
+    else
+        sensor->deadline_us = now + period;
+    sensor->retries = 0;
+
+    ret = mlx90632_epoll_arm(sensor, sensor->deadline_us);
+    if (ret < 0)
+        return ret;
+
+    ret = mlx90632_epoll_calculate(sensor, &ambient, &object);
+    sensor->callback(sensor, ret, ambient, object);
+
+    return ret < 0 ? ret : 1;
+
+err_rearm:
+    sensor->callback(sensor, ret, ambient, object);
+    sensor->deadline_us = now + sensor->period_us[0];
+    mlx90632_epoll_arm(sensor, sensor->deadline_us);
+    return ret;
+}
+
+int32_t mlx90632_epoll_run(int epoll_fd, int timeout_ms)
+{
+    struct epoll_event events[MLX90632_EPOLL_MAX_EVENTS];
+    int count, i;
+
+    count = epoll_wait(epoll_fd, events, MLX90632_EPOLL_MAX_EVENTS, timeout_ms);
+    if (count < 0)
+        return errno == EINTR ? 0 : -errno;
+
+    for (i = 0; i < count; ++i)
+        mlx90632_epoll_dispatch((mlx90632_epoll_sensor_t *)events[i].data.ptr);
+
+    return count;
+}
+
+///@}
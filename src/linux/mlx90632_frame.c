@@ -0,0 +1,547 @@
+/**
+ * @file mlx90632_frame.c
+ * @brief Acquisition engine of MLX90632 driver building synchronized frames of sensors on several i2c buses
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "mlx90632.h"
+#include "mlx90632_depends.h"
+#include "mlx90632_i2c_dev.h"
+#include "mlx90632_frame.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+#define MLX90632_FRAME_SLOT_UNUSED 0 /**< Slot never held a frame */
+#define MLX90632_FRAME_SLOT_ASSEMBLING 1 /**< Slot waits for contributions of buses */
+#define MLX90632_FRAME_SLOT_DONE 2 /**< Frame of the slot was handed to the compute thread */
+
+/** Current CLOCK_MONOTONIC time in microseconds */
+STATIC uint64_t mlx90632_frame_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/** Sleep until absolute CLOCK_MONOTONIC time in microseconds */
+STATIC void mlx90632_frame_sleep_until(uint64_t time_us)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t)(time_us / 1000000);
+    ts.tv_nsec = (long)(time_us % 1000000) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+}
+
+/** Check measurement type and measurement times of the devices of a bus against mode and period */
+STATIC int32_t mlx90632_frame_check(mlx90632_frame_bus_t *bus, mlx90632_frame_mode_t mode, uint32_t period_us)
+{
+    static const uint16_t meas[] = { MLX90632_EE_MEDICAL_MEAS1, MLX90632_EE_MEDICAL_MEAS2 };
+    int32_t ret;
+    uint16_t i, m;
+
+    bus->dataset_us = 0;
+    for (i = 0; i < bus->count; ++i)
+    {
+        mlx90632_i2c_dev_select(bus->dev[i]);
+        ret = mlx90632_get_meas_type();
+        if (ret < 0)
+            return ret;
+
+        if (mode == MLX90632_FRAME_CONTINUOUS)
+        {
+            if (ret != MLX90632_MTYP_MEDICAL)
+                return -EINVAL;
+
+            // sensor completes the measurement it is in within one measurement time after the trigger
+            for (m = 0; m < ARRAY_SIZE(meas); ++m)
+            {
+                ret = mlx90632_get_measurement_time(meas[m]);
+                if (ret < 0)
+                    return ret;
+                if ((uint32_t)ret * 1000 >= period_us)
+                    return -EINVAL;
+            }
+        }
+        else
+        {
+#if MLX90632_ENABLE_BURST
+            if (ret != MLX90632_MTYP_MEDICAL_BURST)
+                return -EINVAL;
+
+            ret = mlx90632_calculate_dataset_ready_time();
+            if (ret < 0)
+                return ret;
+            if ((uint32_t)ret * 1000 >= period_us)
+                return -EINVAL;
+            if ((uint32_t)ret * 1000 > bus->dataset_us)
+                bus->dataset_us = (uint32_t)ret * 1000;
+#else
+            return -EINVAL;
+#endif
+        }
+    }
+
+    return 0;
+}
+
+/** Start next measurement of the selected device */
+STATIC int32_t mlx90632_frame_trigger(mlx90632_frame_mode_t mode)
+{
+#if MLX90632_ENABLE_BURST
+    if (mode == MLX90632_FRAME_BURST)
+        return mlx90632_trigger_measurement_burst();
+#else
+    (void)mode;
+#endif
+
+    return mlx90632_trigger_measurement();
+}
+
+/** Check once whether the selected device has data, returns channel position or -EAGAIN */
+STATIC int32_t mlx90632_frame_ready(mlx90632_frame_mode_t mode)
+{
+    uint16_t reg_status;
+    int32_t ret;
+
+    if (mode == MLX90632_FRAME_CONTINUOUS)
+        return mlx90632_poll_measurement();
+
+    ret = mlx90632_i2c_read(MLX90632_REG_STATUS, &reg_status);
+    if (ret < 0)
+        return ret;
+    if (reg_status & MLX90632_STAT_BUSY)
+        return -EAGAIN;
+
+    // whole table was refreshed, so new values are at the same position as for mlx90632_read_temp_raw_burst
+    return 2;
+}
+
+/** Add time spent in register accesses since start_us to the bus and return current time */
+STATIC uint64_t mlx90632_frame_busy(mlx90632_frame_bus_t *bus, uint64_t start_us)
+{
+    uint64_t now = mlx90632_frame_now();
+
+    __atomic_add_fetch(&bus->busy_us, now - start_us, __ATOMIC_RELAXED);
+    return now;
+}
+
+/** Acquire one sample of every device of the bus in the window starting at start_us */
+STATIC void mlx90632_frame_acquire(mlx90632_frame_bus_t *bus, uint64_t start_us, mlx90632_frame_sample_t *sample)
+{
+    mlx90632_frame_engine_t *engine = bus->engine;
+    uint64_t deadline_us = start_us + engine->period_us;
+    uint64_t now, t;
+    uint8_t waiting[MLX90632_FRAME_BUS_SENSORS];
+    uint16_t i, left = 0;
+    int32_t ret;
+
+    now = mlx90632_frame_now();
+    for (i = 0; i < bus->count; ++i)
+    {
+        sample[i].timestamp_us = 0;
+        sample[i].status = -ETIMEDOUT;
+        waiting[i] = 0;
+
+        mlx90632_i2c_dev_select(bus->dev[i]);
+        t = now;
+        ret = mlx90632_frame_trigger(engine->mode);
+        now = mlx90632_frame_busy(bus, t);
+        if (ret < 0)
+        {
+            sample[i].status = ret;
+            continue;
+        }
+
+        // burst measurement ends one dataset time after its trigger, continuous one when data ready is seen
+        sample[i].timestamp_us = now + bus->dataset_us;
+        waiting[i] = 1;
+        left++;
+    }
+
+    if (engine->mode == MLX90632_FRAME_BURST)
+        mlx90632_frame_sleep_until(now + bus->dataset_us);
+
+    while (left > 0)
+    {
+        now = mlx90632_frame_now();
+        for (i = 0; i < bus->count; ++i)
+        {
+            if (!waiting[i])
+                continue;
+
+            mlx90632_i2c_dev_select(bus->dev[i]);
+            t = now;
+            ret = mlx90632_frame_ready(engine->mode);
+            if (ret >= 0)
+            {
+                if (engine->mode == MLX90632_FRAME_CONTINUOUS)
+                    sample[i].timestamp_us = t;
+                ret = mlx90632_read_temp_raw_wo_wait(ret, &sample[i].ambient_new_raw, &sample[i].ambient_old_raw,
+                                                     &sample[i].object_new_raw, &sample[i].object_old_raw);
+            }
+            now = mlx90632_frame_busy(bus, t);
+            if (ret == -EAGAIN)
+                continue;
+
+            sample[i].status = (ret < 0) ? ret : 0;
+            waiting[i] = 0;
+            left--;
+        }
+
+        if ((left == 0) || (now + MLX90632_FRAME_POLL_TIME >= deadline_us))
+            break;
+        mlx90632_frame_sleep_until(now + MLX90632_FRAME_POLL_TIME);
+    }
+}
+
+/** Hand frame of the slot to the compute thread, called with the lock held */
+STATIC void mlx90632_frame_deliver(mlx90632_frame_engine_t *engine, mlx90632_frame_slot_t *slot)
+{
+    mlx90632_frame_t *frame = &slot->frame;
+    uint64_t first = UINT64_MAX, last = 0, latency;
+    uint16_t i, tail;
+
+    frame->good = 0;
+    for (i = 0; i < frame->count; ++i)
+    {
+        if (frame->sample[i].status < 0)
+            continue;
+        frame->good++;
+        if (frame->sample[i].timestamp_us < first)
+            first = frame->sample[i].timestamp_us;
+        if (frame->sample[i].timestamp_us > last)
+            last = frame->sample[i].timestamp_us;
+    }
+    frame->skew_us = frame->good ? (uint32_t)(last - first) : 0;
+    frame->complete_us = mlx90632_frame_now();
+    latency = frame->complete_us - frame->start_us;
+
+    engine->stats.frames++;
+    if (frame->good < frame->count)
+        engine->stats.incomplete++;
+    engine->latency_sum_us += latency;
+    if (latency > engine->stats.latency_max_us)
+        engine->stats.latency_max_us = latency;
+    engine->skew_sum_us += frame->skew_us;
+    if (frame->skew_us > engine->stats.skew_max_us)
+        engine->stats.skew_max_us = frame->skew_us;
+
+    // compute thread which does not keep up loses the oldest frame, never the buses
+    if (engine->queue_count == MLX90632_FRAME_QUEUE)
+    {
+        engine->queue_head = (engine->queue_head + 1) % MLX90632_FRAME_QUEUE;
+        engine->queue_count--;
+        engine->stats.overruns++;
+    }
+    tail = (engine->queue_head + engine->queue_count) % MLX90632_FRAME_QUEUE;
+    memcpy(&engine->queue[tail], frame, sizeof(*frame));
+    engine->queue_count++;
+
+    slot->state = MLX90632_FRAME_SLOT_DONE;
+    pthread_cond_signal(&engine->ready);
+}
+
+/** Add samples of a bus to the frame of window seq */
+STATIC void mlx90632_frame_submit(mlx90632_frame_bus_t *bus, uint32_t seq, const mlx90632_frame_sample_t *sample)
+{
+    mlx90632_frame_engine_t *engine = bus->engine;
+    mlx90632_frame_slot_t *slot = &engine->slot[seq % MLX90632_FRAME_SLOTS];
+    uint16_t i;
+
+    pthread_mutex_lock(&engine->lock);
+    if ((slot->state != MLX90632_FRAME_SLOT_ASSEMBLING) || (slot->frame.seq != seq))
+    {
+        if ((slot->state != MLX90632_FRAME_SLOT_UNUSED) && (seq <= slot->frame.seq))
+        {
+            // frame was already handed over without this bus
+            engine->stats.late += bus->count;
+            pthread_mutex_unlock(&engine->lock);
+            return;
+        }
+
+        if (slot->state == MLX90632_FRAME_SLOT_ASSEMBLING)
+            mlx90632_frame_deliver(engine, slot);
+
+        slot->state = MLX90632_FRAME_SLOT_ASSEMBLING;
+        slot->pending = engine->count;
+        slot->frame.seq = seq;
+        slot->frame.count = engine->count;
+        slot->frame.start_us = engine->start_us + (uint64_t)seq * engine->period_us;
+        for (i = 0; i < engine->count; ++i)
+        {
+            slot->frame.sample[i].timestamp_us = 0;
+            slot->frame.sample[i].status = -ETIMEDOUT;
+        }
+    }
+
+    memcpy(&slot->frame.sample[bus->first], sample, bus->count * sizeof(*sample));
+    slot->pending -= bus->count;
+    if (slot->pending == 0)
+        mlx90632_frame_deliver(engine, slot);
+    pthread_mutex_unlock(&engine->lock);
+}
+
+/** Worker thread of one bus */
+STATIC void *mlx90632_frame_worker(void *arg)
+{
+    mlx90632_frame_bus_t *bus = arg;
+    mlx90632_frame_engine_t *engine = bus->engine;
+    mlx90632_frame_sample_t sample[MLX90632_FRAME_BUS_SENSORS];
+    uint64_t start_us;
+    uint32_t seq = 0;
+    uint16_t i;
+
+    while (__atomic_load_n(&engine->running, __ATOMIC_ACQUIRE))
+    {
+        start_us = engine->start_us + (uint64_t)seq * engine->period_us;
+        mlx90632_frame_sleep_until(start_us);
+        if (!__atomic_load_n(&engine->running, __ATOMIC_ACQUIRE))
+            break;
+
+        mlx90632_frame_acquire(bus, start_us, sample);
+        mlx90632_frame_submit(bus, seq++, sample);
+        __atomic_add_fetch(&bus->windows, 1, __ATOMIC_RELAXED);
+
+        // windows which ended while this one was acquired are skipped, so the bus catches up with the others
+        while (mlx90632_frame_now() >= engine->start_us + (uint64_t)(seq + 1) * engine->period_us)
+        {
+            for (i = 0; i < bus->count; ++i)
+            {
+                sample[i].timestamp_us = 0;
+                sample[i].status = -ETIMEDOUT;
+            }
+            mlx90632_frame_submit(bus, seq++, sample);
+            __atomic_add_fetch(&bus->missed, 1, __ATOMIC_RELAXED);
+        }
+    }
+
+    mlx90632_i2c_dev_select(NULL);
+    return NULL;
+}
+
+/** Compute thread passing queued frames to the callback */
+STATIC void *mlx90632_frame_compute(void *arg)
+{
+    mlx90632_frame_engine_t *engine = arg;
+    mlx90632_frame_t frame;
+
+    pthread_mutex_lock(&engine->lock);
+    for (;;)
+    {
+        // after the workers are joined only the frames which are still queued are left
+        while ((engine->queue_count == 0) && (engine->stop_us == 0))
+            pthread_cond_wait(&engine->ready, &engine->lock);
+        if (engine->queue_count == 0)
+            break;
+
+        memcpy(&frame, &engine->queue[engine->queue_head], sizeof(frame));
+        engine->queue_head = (engine->queue_head + 1) % MLX90632_FRAME_QUEUE;
+        engine->queue_count--;
+
+        pthread_mutex_unlock(&engine->lock);
+        engine->callback(engine, &frame, engine->user);
+        pthread_mutex_lock(&engine->lock);
+    }
+    pthread_mutex_unlock(&engine->lock);
+
+    return NULL;
+}
+
+/** Hand frames which are still assembling to the compute thread in window order, called with the lock held */
+STATIC void mlx90632_frame_flush(mlx90632_frame_engine_t *engine)
+{
+    mlx90632_frame_slot_t *oldest;
+    uint16_t s;
+
+    do
+    {
+        oldest = NULL;
+        for (s = 0; s < MLX90632_FRAME_SLOTS; ++s)
+        {
+            if ((engine->slot[s].state == MLX90632_FRAME_SLOT_ASSEMBLING) &&
+                ((oldest == NULL) || (engine->slot[s].frame.seq < oldest->frame.seq)))
+                oldest = &engine->slot[s];
+        }
+        if (oldest != NULL)
+            mlx90632_frame_deliver(engine, oldest);
+    } while (oldest != NULL);
+}
+
+/** Stop the first workers workers and the compute thread */
+STATIC void mlx90632_frame_join(mlx90632_frame_engine_t *engine, uint16_t workers)
+{
+    uint16_t b;
+
+    __atomic_store_n(&engine->running, 0, __ATOMIC_RELEASE);
+    for (b = 0; b < workers; ++b)
+        pthread_join(engine->bus[b].thread, NULL);
+
+    // buses which stopped in different windows leave frames behind which would never complete
+    pthread_mutex_lock(&engine->lock);
+    mlx90632_frame_flush(engine);
+    engine->stop_us = mlx90632_frame_now();
+    pthread_cond_signal(&engine->ready);
+    pthread_mutex_unlock(&engine->lock);
+    pthread_join(engine->compute, NULL);
+}
+
+void mlx90632_frame_init(mlx90632_frame_engine_t *engine)
+{
+    memset(engine, 0, sizeof(*engine));
+    pthread_mutex_init(&engine->lock, NULL);
+    pthread_cond_init(&engine->ready, NULL);
+}
+
+int32_t mlx90632_frame_add_bus(mlx90632_frame_engine_t *engine, mlx90632_i2c_dev_t *const *devs, uint16_t count)
+{
+    mlx90632_frame_bus_t *bus;
+    uint16_t i;
+
+    if (__atomic_load_n(&engine->running, __ATOMIC_ACQUIRE))
+        return -EBUSY;
+    if (count == 0)
+        return -EINVAL;
+    if ((engine->buses >= MLX90632_FRAME_MAX_BUSES) || (count > MLX90632_FRAME_BUS_SENSORS))
+        return -ENOBUFS;
+
+    bus = &engine->bus[engine->buses++];
+    memset(bus, 0, sizeof(*bus));
+    bus->engine = engine;
+    for (i = 0; i < count; ++i)
+        bus->dev[i] = devs[i];
+    bus->count = count;
+    bus->first = engine->count;
+    engine->count += count;
+
+    return 0;
+}
+
+int32_t mlx90632_frame_start(mlx90632_frame_engine_t *engine, mlx90632_frame_mode_t mode, uint32_t period_us,
+                             mlx90632_frame_cb_t callback, void *user)
+{
+    int32_t ret = 0;
+    uint16_t b;
+
+    if (__atomic_load_n(&engine->running, __ATOMIC_ACQUIRE))
+        return -EBUSY;
+    if ((engine->buses == 0) || ((mode != MLX90632_FRAME_CONTINUOUS) && (mode != MLX90632_FRAME_BURST)))
+        return -EINVAL;
+
+    for (b = 0; (b < engine->buses) && (ret == 0); ++b)
+        ret = mlx90632_frame_check(&engine->bus[b], mode, period_us);
+    mlx90632_i2c_dev_select(NULL);
+    if (ret < 0)
+        return ret;
+
+    engine->mode = mode;
+    engine->period_us = period_us;
+    engine->callback = callback;
+    engine->user = user;
+    memset(engine->slot, 0, sizeof(engine->slot));
+    memset(&engine->stats, 0, sizeof(engine->stats));
+    engine->queue_head = 0;
+    engine->queue_count = 0;
+    engine->latency_sum_us = 0;
+    engine->skew_sum_us = 0;
+    for (b = 0; b < engine->buses; ++b)
+    {
+        engine->bus[b].busy_us = 0;
+        engine->bus[b].windows = 0;
+        engine->bus[b].missed = 0;
+    }
+
+    engine->stop_us = 0;
+    engine->start_us = mlx90632_frame_now();
+    __atomic_store_n(&engine->running, 1, __ATOMIC_RELEASE);
+
+    ret = pthread_create(&engine->compute, NULL, mlx90632_frame_compute, engine);
+    if (ret != 0)
+    {
+        __atomic_store_n(&engine->running, 0, __ATOMIC_RELEASE);
+        engine->stop_us = engine->start_us;
+        return -ret;
+    }
+
+    for (b = 0; b < engine->buses; ++b)
+    {
+        ret = pthread_create(&engine->bus[b].thread, NULL, mlx90632_frame_worker, &engine->bus[b]);
+        if (ret != 0)
+        {
+            mlx90632_frame_join(engine, b);
+            return -ret;
+        }
+    }
+
+    return 0;
+}
+
+void mlx90632_frame_stop(mlx90632_frame_engine_t *engine)
+{
+    if (!__atomic_load_n(&engine->running, __ATOMIC_ACQUIRE))
+        return;
+
+    mlx90632_frame_join(engine, engine->buses);
+}
+
+void mlx90632_frame_get_stats(mlx90632_frame_engine_t *engine, mlx90632_frame_stats_t *stats)
+{
+    uint64_t elapsed = 0;
+    uint16_t b;
+
+    pthread_mutex_lock(&engine->lock);
+    *stats = engine->stats;
+    if (stats->frames)
+    {
+        stats->latency_mean_us = (double)engine->latency_sum_us / stats->frames;
+        stats->skew_mean_us = (double)engine->skew_sum_us / stats->frames;
+    }
+    if (engine->start_us)
+        elapsed = (engine->stop_us ? engine->stop_us : mlx90632_frame_now()) - engine->start_us;
+    pthread_mutex_unlock(&engine->lock);
+
+    stats->buses = engine->buses;
+    for (b = 0; b < engine->buses; ++b)
+    {
+        uint64_t busy_us = __atomic_load_n(&engine->bus[b].busy_us, __ATOMIC_RELAXED);
+
+        stats->utilisation[b] = elapsed ? (double)busy_us / elapsed : 0.0;
+        stats->missed[b] = __atomic_load_n(&engine->bus[b].missed, __ATOMIC_RELAXED);
+    }
+}
+
+///@}
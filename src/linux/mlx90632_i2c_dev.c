@@ -0,0 +1,241 @@
+/**
+ * @file mlx90632_i2c_dev.c
+ * @brief Linux i2c-dev backend for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @details
+ * mlx90632_depends.h is not included here, because its usleep declaration conflicts with the one from unistd.h.
+ * The i2c functions below have the same prototypes as declared there.
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+#include "mlx90632_i2c_dev.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+/** Device used by the mlx90632_depends.h functions in the current thread */
+static __thread mlx90632_i2c_dev_t *mlx90632_i2c_dev_current;
+
+int32_t mlx90632_i2c_dev_ioctl(int fd, struct i2c_rdwr_ioctl_data *data)
+{
+    int ret = ioctl(fd, I2C_RDWR, data);
+
+    if (ret < 0)
+        return -errno;
+    if ((uint32_t)ret != data->nmsgs)
+        return -EIO;
+
+    return 0;
+}
+
+void mlx90632_i2c_dev_init(mlx90632_i2c_dev_t *dev, int fd, uint16_t addr)
+{
+    dev->fd = fd;
+    dev->addr = addr;
+    dev->transfers = 0;
+    dev->transfer = mlx90632_i2c_dev_ioctl;
+}
+
+int32_t mlx90632_i2c_dev_open(mlx90632_i2c_dev_t *dev, const char *path, uint16_t addr)
+{
+    int fd = open(path, O_RDWR | O_CLOEXEC);
+
+    if (fd < 0)
+        return -errno;
+
+    mlx90632_i2c_dev_init(dev, fd, addr);
+    return 0;
+}
+
+void mlx90632_i2c_dev_close(mlx90632_i2c_dev_t *dev)
+{
+    if (dev->fd >= 0)
+        close(dev->fd);
+    dev->fd = -1;
+
+    if (mlx90632_i2c_dev_current == dev)
+        mlx90632_i2c_dev_current = NULL;
+}
+
+void mlx90632_i2c_dev_select(mlx90632_i2c_dev_t *dev)
+{
+    mlx90632_i2c_dev_current = dev;
+}
+
+/** Execute and count one transfer of the device */
+STATIC int32_t mlx90632_i2c_dev_transfer(mlx90632_i2c_dev_t *dev, struct i2c_msg *msgs, uint32_t nmsgs)
+{
+    struct i2c_rdwr_ioctl_data data;
+
+    data.msgs = msgs;
+    data.nmsgs = nmsgs;
+    dev->transfers++;
+
+    return dev->transfer(dev->fd, &data);
+}
+
+/** Fill message pair which reads len bytes from register address into buf
+ *
+ * @param[in] dev Pointer to device
+ * @param[out] msgs Pointer to two messages to fill
+ * @param[out] addr Pointer to 2 byte buffer for big-endian register address
+ * @param[in] register_address Address of the register to be read from
+ * @param[out] buf Pointer to where read data is written
+ * @param[in] len Number of bytes to read
+ */
+STATIC void mlx90632_i2c_dev_read_msgs(const mlx90632_i2c_dev_t *dev, struct i2c_msg *msgs, uint8_t *addr,
+                                       int16_t register_address, uint8_t *buf, uint16_t len)
+{
+    addr[0] = (uint8_t)((uint16_t)register_address >> 8);
+    addr[1] = (uint8_t)register_address;
+
+    msgs[0].addr = dev->addr;
+    msgs[0].flags = 0;
+    msgs[0].len = 2;
+    msgs[0].buf = addr;
+
+    msgs[1].addr = dev->addr;
+    msgs[1].flags = I2C_M_RD;
+    msgs[1].len = len;
+    msgs[1].buf = buf;
+}
+
+/** Convert big-endian words received from the sensor to host order in place */
+STATIC void mlx90632_i2c_dev_to_host(uint16_t *value, uint16_t words)
+{
+    uint8_t *buf = (uint8_t *)value;
+    uint16_t i;
+
+    for (i = 0; i < words; ++i)
+        value[i] = (uint16_t)((buf[2 * i] << 8) | buf[2 * i + 1]);
+}
+
+int32_t mlx90632_i2c_dev_read(mlx90632_i2c_dev_t *dev, int16_t register_address, uint16_t *value)
+{
+    return mlx90632_i2c_dev_read_block(dev, register_address, value, 1);
+}
+
+int32_t mlx90632_i2c_dev_read_block(mlx90632_i2c_dev_t *dev, int16_t register_address, uint16_t *value,
+                                    uint16_t words)
+{
+    struct i2c_msg msgs[2];
+    uint8_t addr[2];
+    int32_t ret;
+
+    if (words == 0)
+        return 0;
+
+    if (words > UINT16_MAX / 2)
+        return -EINVAL;
+
+    mlx90632_i2c_dev_read_msgs(dev, msgs, addr, register_address, (uint8_t *)value, (uint16_t)(words * 2));
+
+    ret = mlx90632_i2c_dev_transfer(dev, msgs, 2);
+    if (ret < 0)
+        return ret;
+
+    mlx90632_i2c_dev_to_host(value, words);
+    return 0;
+}
+
+int32_t mlx90632_i2c_dev_read_multi(mlx90632_i2c_dev_t *dev, const int16_t *register_address, uint16_t *value,
+                                    uint16_t count)
+{
+    struct i2c_msg msgs[MLX90632_I2C_DEV_MAX_READS * 2];
+    uint8_t addr[MLX90632_I2C_DEV_MAX_READS][2];
+    uint16_t i, batch;
+    int32_t ret;
+
+    while (count > 0)
+    {
+        batch = count > MLX90632_I2C_DEV_MAX_READS ? MLX90632_I2C_DEV_MAX_READS : count;
+
+        for (i = 0; i < batch; ++i)
+            mlx90632_i2c_dev_read_msgs(dev, &msgs[2 * i], addr[i], register_address[i], (uint8_t *)&value[i], 2);
+
+        ret = mlx90632_i2c_dev_transfer(dev, msgs, 2 * batch);
+        if (ret < 0)
+            return ret;
+
+        mlx90632_i2c_dev_to_host(value, batch);
+
+        register_address += batch;
+        value += batch;
+        count -= batch;
+    }
+
+    return 0;
+}
+
+int32_t mlx90632_i2c_dev_write(mlx90632_i2c_dev_t *dev, int16_t register_address, uint16_t value)
+{
+    struct i2c_msg msg;
+    uint8_t buf[4];
+
+    buf[0] = (uint8_t)((uint16_t)register_address >> 8);
+    buf[1] = (uint8_t)register_address;
+    buf[2] = (uint8_t)(value >> 8);
+    buf[3] = (uint8_t)value;
+
+    msg.addr = dev->addr;
+    msg.flags = 0;
+    msg.len = 4;
+    msg.buf = buf;
+
+    return mlx90632_i2c_dev_transfer(dev, &msg, 1);
+}
+
+int32_t mlx90632_i2c_read(int16_t register_address, uint16_t *value)
+{
+    if (mlx90632_i2c_dev_current == NULL)
+        return -ENODEV;
+
+    return mlx90632_i2c_dev_read(mlx90632_i2c_dev_current, register_address, value);
+}
+
+int32_t mlx90632_i2c_read_block(int16_t register_address, uint16_t *value, uint16_t words)
+{
+    if (mlx90632_i2c_dev_current == NULL)
+        return -ENODEV;
+
+    return mlx90632_i2c_dev_read_block(mlx90632_i2c_dev_current, register_address, value, words);
+}
+
+int32_t mlx90632_i2c_write(int16_t register_address, uint16_t value)
+{
+    if (mlx90632_i2c_dev_current == NULL)
+        return -ENODEV;
+
+    return mlx90632_i2c_dev_write(mlx90632_i2c_dev_current, register_address, value);
+}
+
+///@}
@@ -0,0 +1,159 @@
+/**
+ * @file mlx90632_i2c_queue.c
+ * @brief Queue coalescing transfers of several sensors into one I2C_RDWR ioctl for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @details
+ * unistd.h is not included here, so mlx90632_depends.h can be included for the transfer descriptor.
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_depends.h"
+#include "mlx90632_i2c_dev.h"
+#include "mlx90632_i2c_queue.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+/** Queue and device used by mlx90632_i2c_submit in the current thread */
+static __thread mlx90632_i2c_queue_t *mlx90632_i2c_queue_current;
+static __thread mlx90632_i2c_dev_t *mlx90632_i2c_queue_current_dev;
+
+void mlx90632_i2c_queue_init(mlx90632_i2c_queue_t *queue)
+{
+    queue->fd = -1;
+    queue->transfer = NULL;
+    queue->transfers = 0;
+    queue->count = 0;
+    queue->nmsgs = 0;
+}
+
+int32_t mlx90632_i2c_queue_add(mlx90632_i2c_queue_t *queue, mlx90632_i2c_dev_t *dev, mlx90632_i2c_xfer_t *xfer)
+{
+    struct i2c_msg *msgs;
+    uint8_t *buf;
+
+    if ((xfer->words == 0) || (xfer->words > UINT16_MAX / 2) || (xfer->write && (xfer->words != 1)))
+        return -EINVAL;
+
+    if ((queue->count > 0) && (dev->fd != queue->fd))
+        return -EXDEV;
+
+    if (queue->nmsgs + (xfer->write ? 1 : 2) > MLX90632_I2C_QUEUE_MSGS)
+        return -ENOBUFS;
+
+    if (queue->count == 0)
+    {
+        queue->fd = dev->fd;
+        queue->transfer = dev->transfer;
+    }
+
+    msgs = &queue->msgs[queue->nmsgs];
+    buf = queue->buf[queue->count];
+    buf[0] = (uint8_t)((uint16_t)xfer->register_address >> 8);
+    buf[1] = (uint8_t)xfer->register_address;
+
+    msgs[0].addr = dev->addr;
+    msgs[0].flags = 0;
+    msgs[0].buf = buf;
+
+    if (xfer->write)
+    {
+        buf[2] = (uint8_t)(xfer->value[0] >> 8);
+        buf[3] = (uint8_t)xfer->value[0];
+        msgs[0].len = 4;
+        queue->nmsgs += 1;
+    }
+    else
+    {
+        // repeated start between register address and data, like mlx90632_i2c_dev_read_block
+        msgs[0].len = 2;
+        msgs[1].addr = dev->addr;
+        msgs[1].flags = I2C_M_RD;
+        msgs[1].len = (uint16_t)(xfer->words * 2);
+        msgs[1].buf = (uint8_t *)xfer->value;
+        queue->nmsgs += 2;
+    }
+
+    queue->xfer[queue->count++] = xfer;
+    return 0;
+}
+
+int32_t mlx90632_i2c_queue_flush(mlx90632_i2c_queue_t *queue)
+{
+    mlx90632_i2c_xfer_t *xfer[MLX90632_I2C_QUEUE_MSGS];
+    struct i2c_rdwr_ioctl_data data;
+    uint16_t count = queue->count;
+    uint16_t i, j;
+    uint8_t *buf;
+    int32_t ret;
+
+    if (count == 0)
+        return 0;
+
+    data.msgs = queue->msgs;
+    data.nmsgs = queue->nmsgs;
+    queue->transfers++;
+    ret = queue->transfer(queue->fd, &data);
+
+    for (i = 0; i < count; ++i)
+        xfer[i] = queue->xfer[i];
+    queue->count = 0;
+    queue->nmsgs = 0;
+
+    for (i = 0; i < count; ++i)
+    {
+        if ((ret == 0) && !xfer[i]->write)
+        {
+            // big-endian words received from the sensor to host order in place
+            buf = (uint8_t *)xfer[i]->value;
+            for (j = 0; j < xfer[i]->words; ++j)
+                xfer[i]->value[j] = (uint16_t)((buf[2 * j] << 8) | buf[2 * j + 1]);
+        }
+
+        xfer[i]->status = ret;
+        xfer[i]->complete(xfer[i]);
+    }
+
+    return ret;
+}
+
+void mlx90632_i2c_queue_select(mlx90632_i2c_queue_t *queue, mlx90632_i2c_dev_t *dev)
+{
+    mlx90632_i2c_queue_current = queue;
+    mlx90632_i2c_queue_current_dev = dev;
+}
+
+int32_t mlx90632_i2c_submit(mlx90632_i2c_xfer_t *xfer)
+{
+    if ((mlx90632_i2c_queue_current == NULL) || (mlx90632_i2c_queue_current_dev == NULL))
+        return -ENODEV;
+
+    return mlx90632_i2c_queue_add(mlx90632_i2c_queue_current, mlx90632_i2c_queue_current_dev, xfer);
+}
+
+///@}
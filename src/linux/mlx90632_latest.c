@@ -0,0 +1,88 @@
+/**
+ * @file mlx90632_latest.c
+ * @brief Latest sample cell with sequence lock for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_latest.h"
+
+void mlx90632_latest_init(mlx90632_latest_t *cell)
+{
+    memset(cell, 0, sizeof(*cell));
+}
+
+void mlx90632_latest_publish(mlx90632_latest_t *cell, const mlx90632_latest_value_t *value)
+{
+    uint64_t words[MLX90632_LATEST_WORDS] = { 0 };
+    uint32_t sequence = __atomic_load_n(&cell->sequence, __ATOMIC_RELAXED);
+    uint32_t next = sequence + 2;
+    uint32_t i;
+
+    // 0 means nothing was published, so it is skipped when sequence wraps
+    if (next == 0)
+        next = 2;
+
+    memcpy(words, value, sizeof(*value));
+
+    // odd sequence must be visible before any word of the new value
+    __atomic_store_n(&cell->sequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    for (i = 0; i < MLX90632_LATEST_WORDS; ++i)
+        __atomic_store_n(&cell->words[i], words[i], __ATOMIC_RELAXED);
+    __atomic_store_n(&cell->sequence, next, __ATOMIC_RELEASE);
+}
+
+int32_t mlx90632_latest_read(const mlx90632_latest_t *cell, mlx90632_latest_value_t *value)
+{
+    uint64_t words[MLX90632_LATEST_WORDS];
+    uint32_t tries, i;
+
+    for (tries = 0; tries < MLX90632_LATEST_READ_TRIES; ++tries)
+    {
+        uint32_t before = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+
+        if (before == 0)
+            return -ENODATA;
+        if (before & 1)
+            continue;
+
+        for (i = 0; i < MLX90632_LATEST_WORDS; ++i)
+            words[i] = __atomic_load_n(&cell->words[i], __ATOMIC_RELAXED);
+
+        // words must be read before the sequence is checked again
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&cell->sequence, __ATOMIC_RELAXED) == before)
+        {
+            memcpy(value, words, sizeof(*value));
+            return 0;
+        }
+    }
+
+    return -EAGAIN;
+}
+
+///@}
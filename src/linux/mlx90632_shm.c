@@ -0,0 +1,284 @@
+/**
+ * @file mlx90632_shm.c
+ * @brief Shared memory sample rings for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mlx90632.h"
+#include "mlx90632_shm.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+/** Ring of a device in the mapped object */
+STATIC mlx90632_shm_ring_t *mlx90632_shm_ring(const mlx90632_shm_t *shm, uint32_t device)
+{
+    return (mlx90632_shm_ring_t *)((char *)shm->header + shm->header->header_size +
+                                   (size_t)device * shm->header->ring_size);
+}
+
+/** Map object of size bytes and fill in the mapping */
+STATIC int32_t mlx90632_shm_map(mlx90632_shm_t *shm, int fd, size_t size, int prot)
+{
+    void *map = mmap(NULL, size, prot, MAP_SHARED, fd, 0);
+
+    if (map == MAP_FAILED)
+        return -errno;
+
+    shm->fd = fd;
+    shm->size = size;
+    shm->header = (mlx90632_shm_header_t *)map;
+    return 0;
+}
+
+int32_t mlx90632_shm_create(mlx90632_shm_t *shm, const char *name, uint32_t devices, uint32_t slots)
+{
+    mlx90632_shm_header_t *header;
+    size_t ring_size, size;
+    int32_t ret;
+    int fd;
+
+    if (!__atomic_always_lock_free(sizeof(uint64_t), 0))
+        return -ENOTSUP;
+
+    if ((devices == 0) || (slots == 0) || (slots & (slots - 1)) ||
+        (slots > (UINT32_MAX - sizeof(mlx90632_shm_ring_t)) / sizeof(mlx90632_shm_slot_t)))
+        return -EINVAL;
+
+    ring_size = sizeof(mlx90632_shm_ring_t) + (size_t)slots * sizeof(mlx90632_shm_slot_t);
+    if (devices > (SIZE_MAX - sizeof(mlx90632_shm_header_t)) / ring_size)
+        return -EINVAL;
+    size = sizeof(mlx90632_shm_header_t) + devices * ring_size;
+
+    // Readers of a previous object keep their mapping, this one starts from empty rings
+    shm_unlink(name);
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0)
+        return -errno;
+
+    if (ftruncate(fd, (off_t)size) < 0)
+    {
+        ret = -errno;
+        goto err_close;
+    }
+
+    ret = mlx90632_shm_map(shm, fd, size, PROT_READ | PROT_WRITE);
+    if (ret < 0)
+        goto err_close;
+
+    // ftruncate filled the object with zeroes, so every head and sequence is already 0
+    header = shm->header;
+    header->version = MLX90632_SHM_VERSION;
+    header->header_size = sizeof(mlx90632_shm_header_t);
+    header->ring_size = (uint32_t)ring_size;
+    header->slot_size = sizeof(mlx90632_shm_slot_t);
+    header->devices = devices;
+    header->slots = slots;
+    __atomic_store_n(&header->magic, MLX90632_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    shm->devices = devices;
+    shm->slots = slots;
+    return 0;
+
+err_close:
+    close(fd);
+    shm_unlink(name);
+    return ret;
+}
+
+int32_t mlx90632_shm_open(mlx90632_shm_t *shm, const char *name)
+{
+    const mlx90632_shm_header_t *header;
+    struct stat st;
+    int32_t ret;
+    int fd;
+
+    if (!__atomic_always_lock_free(sizeof(uint64_t), 0))
+        return -ENOTSUP;
+
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+        return -errno;
+
+    if (fstat(fd, &st) < 0)
+    {
+        ret = -errno;
+        goto err_close;
+    }
+
+    // Object which is still being created is empty or has no magic yet
+    if ((size_t)st.st_size < sizeof(mlx90632_shm_header_t))
+    {
+        ret = -EPROTO;
+        goto err_close;
+    }
+
+    ret = mlx90632_shm_map(shm, fd, (size_t)st.st_size, PROT_READ);
+    if (ret < 0)
+        goto err_close;
+
+    header = shm->header;
+    if ((__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != MLX90632_SHM_MAGIC) ||
+        (header->version != MLX90632_SHM_VERSION) ||
+        (header->header_size != sizeof(mlx90632_shm_header_t)) ||
+        (header->slot_size != sizeof(mlx90632_shm_slot_t)) ||
+        (header->slots == 0) || (header->slots & (header->slots - 1)) ||
+        (header->ring_size != sizeof(mlx90632_shm_ring_t) + (size_t)header->slots * sizeof(mlx90632_shm_slot_t)) ||
+        (header->devices > (shm->size - header->header_size) / header->ring_size))
+    {
+        ret = -EPROTO;
+        goto err_unmap;
+    }
+
+    shm->devices = header->devices;
+    shm->slots = header->slots;
+    return 0;
+
+err_unmap:
+    munmap(shm->header, shm->size);
+err_close:
+    close(fd);
+    return ret;
+}
+
+void mlx90632_shm_close(mlx90632_shm_t *shm)
+{
+    munmap(shm->header, shm->size);
+    close(shm->fd);
+    shm->header = NULL;
+    shm->fd = -1;
+}
+
+int32_t mlx90632_shm_unlink(const char *name)
+{
+    if (shm_unlink(name) < 0)
+        return -errno;
+
+    return 0;
+}
+
+int32_t mlx90632_shm_publish(mlx90632_shm_t *shm, uint32_t device, const mlx90632_shm_sample_t *sample)
+{
+    uint64_t words[MLX90632_SHM_WORDS] = { 0 };
+    mlx90632_shm_ring_t *ring;
+    mlx90632_shm_slot_t *slot;
+    uint64_t n;
+    uint32_t i;
+
+    if (device >= shm->devices)
+        return -EINVAL;
+
+    ring = mlx90632_shm_ring(shm, device);
+    n = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    slot = &ring->slot[n & (shm->slots - 1)];
+
+    memcpy(words, sample, sizeof(*sample));
+
+    // odd sequence must be visible before any word of the new sample
+    __atomic_store_n(&slot->sequence, 2 * n + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    for (i = 0; i < MLX90632_SHM_WORDS; ++i)
+        __atomic_store_n(&slot->words[i], words[i], __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->sequence, 2 * n + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->head, n + 1, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+int32_t mlx90632_shm_acquire(mlx90632_shm_t *shm, uint32_t device, int32_t channel_position,
+                             const mlx90632_calib_t *calib, uint64_t timestamp_us)
+{
+    mlx90632_shm_sample_t sample;
+    double pre_ambient, pre_object;
+    int32_t ret;
+
+    if (device >= shm->devices)
+        return -EINVAL;
+
+    ret = mlx90632_read_temp_raw_wo_wait(channel_position, &sample.ambient_new_raw, &sample.ambient_old_raw,
+                                         &sample.object_new_raw, &sample.object_old_raw);
+    if (ret < 0)
+        return ret;
+
+    sample.timestamp_us = timestamp_us;
+    sample.ambient = mlx90632_calc_temp_ambient(sample.ambient_new_raw, sample.ambient_old_raw,
+                                                calib->P_T, calib->P_R, calib->P_G, calib->P_O, calib->Gb);
+
+    pre_ambient = mlx90632_preprocess_temp_ambient(sample.ambient_new_raw, sample.ambient_old_raw, calib->Gb);
+    pre_object = mlx90632_preprocess_temp_object(sample.object_new_raw, sample.object_old_raw,
+                                                 sample.ambient_new_raw, sample.ambient_old_raw, calib->Ka);
+    sample.object = mlx90632_calc_temp_object(pre_object, pre_ambient, calib->Ea, calib->Eb, calib->Ga,
+                                              calib->Fa, calib->Fb, calib->Ha, calib->Hb);
+
+    return mlx90632_shm_publish(shm, device, &sample);
+}
+
+uint64_t mlx90632_shm_head(const mlx90632_shm_t *shm, uint32_t device)
+{
+    return __atomic_load_n(&mlx90632_shm_ring(shm, device)->head, __ATOMIC_ACQUIRE);
+}
+
+int32_t mlx90632_shm_read(const mlx90632_shm_t *shm, uint32_t device, uint64_t n, mlx90632_shm_sample_t *sample)
+{
+    uint64_t words[MLX90632_SHM_WORDS];
+    const mlx90632_shm_slot_t *slot;
+    uint64_t expected = 2 * n + 2;
+    uint64_t sequence;
+    uint32_t i;
+
+    if (device >= shm->devices)
+        return -EINVAL;
+
+    slot = &mlx90632_shm_ring(shm, device)->slot[n & (shm->slots - 1)];
+
+    // older sample of the slot or sample n being written
+    sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+    if (sequence < expected)
+        return -ENODATA;
+    if (sequence > expected)
+        return -EOVERFLOW;
+
+    for (i = 0; i < MLX90632_SHM_WORDS; ++i)
+        words[i] = __atomic_load_n(&slot->words[i], __ATOMIC_RELAXED);
+
+    // words must be read before the sequence is checked again
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) != expected)
+        return -EOVERFLOW;
+
+    memcpy(sample, words, sizeof(*sample));
+    return 0;
+}
+
+///@}
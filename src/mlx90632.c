@@ -87,6 +87,21 @@ int32_t mlx90632_wait_for_measurement(void)
     return (reg_status & MLX90632_STAT_CYCLE_POS) >> 2;
 }
 
+int32_t mlx90632_poll_measurement(void)
+{
+    uint16_t reg_status;
+    int32_t ret;
+
+    ret = mlx90632_i2c_read(MLX90632_REG_STATUS, &reg_status);
+    if (ret < 0)
+        return ret;
+
+    if (!(reg_status & MLX90632_STAT_DATA_RDY))
+        return -EAGAIN;
+
+    return (reg_status & MLX90632_STAT_CYCLE_POS) >> 2;
+}
+
 int32_t mlx90632_start_measurement(void)
 {
     int32_t ret = mlx90632_trigger_measurement();
@@ -250,6 +265,7 @@ int32_t mlx90632_read_temp_raw(int16_t *ambient_new_raw, int16_t *ambient_old_ra
                                           object_new_raw, object_old_raw);
 }
 
+#if MLX90632_ENABLE_BURST
 int32_t mlx90632_read_temp_raw_burst(int16_t *ambient_new_raw, int16_t *ambient_old_raw,
                                      int16_t *object_new_raw, int16_t *object_old_raw)
 {
@@ -264,6 +280,7 @@ int32_t mlx90632_read_temp_raw_burst(int16_t *ambient_new_raw, int16_t *ambient_
     return mlx90632_read_temp_raw_wo_wait(2, ambient_new_raw, ambient_old_raw,
                                           object_new_raw, object_old_raw);
 }
+#endif
 
 
 /* DSPv5 */
@@ -350,6 +367,7 @@ STATIC double mlx90632_calc_temp_object_iteration(double prev_object_temp, int32
     return sqrt(first_sqrt) - 273.15 - Hb_customer;
 }
 
+#if MLX90632_ENABLE_REFLECTED
 /** Iterative calculation of object temperature  when the environment temperature differs from the sensor temperature
  *
  * DSPv5 requires 3 iterations to reduce noise for object temperature. Since
@@ -395,6 +413,7 @@ STATIC double mlx90632_calc_temp_object_iteration_reflected(double prev_object_t
 
     return sqrt(first_sqrt) - 273.15 - Hb_customer;
 }
+#endif
 
 static double emissivity = 0.0;
 void mlx90632_set_emissivity(double value)
@@ -435,6 +454,7 @@ double mlx90632_calc_temp_object(int32_t object, int32_t ambient,
     return temp;
 }
 
+#if MLX90632_ENABLE_REFLECTED
 double mlx90632_calc_temp_object_reflected(int32_t object, int32_t ambient, double reflected,
                                            int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
                                            int16_t Ha, int16_t Hb)
@@ -465,6 +485,7 @@ double mlx90632_calc_temp_object_reflected(int32_t object, int32_t ambient, doub
     }
     return temp;
 }
+#endif
 
 int32_t mlx90632_init(void)
 {
@@ -542,6 +563,7 @@ int32_t mlx90632_get_measurement_time(uint16_t meas)
     return MLX90632_MEAS_MAX_TIME >> reg;
 }
 
+#if MLX90632_ENABLE_BURST
 int32_t mlx90632_calculate_dataset_ready_time(void)
 {
     int32_t ret;
@@ -653,6 +675,7 @@ int32_t mlx90632_start_measurement_burst(void)
 
     return ret;
 }
+#endif
 
 int32_t mlx90632_trigger_measurement_single(void)
 {
@@ -675,6 +698,7 @@ int32_t mlx90632_trigger_measurement_single(void)
     return ret;
 }
 
+#if MLX90632_ENABLE_EEPROM_WRITE
 STATIC int32_t mlx90632_unlock_eeporm(void)
 {
     return mlx90632_i2c_write(0x3005, MLX90632_EEPROM_WRITE_KEY);
@@ -757,6 +781,7 @@ int32_t mlx90632_set_refresh_rate(mlx90632_meas_t measRate)
 
     return ret;
 }
+#endif
 
 mlx90632_meas_t mlx90632_get_refresh_rate(void)
 {
@@ -0,0 +1,92 @@
+/**
+ * @file mlx90632_ambient_state.c
+ * @brief Object temperature calculation with cached ambient terms for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "mlx90632_ambient_state.h"
+
+void mlx90632_ambient_state_invalidate(mlx90632_ambient_state_t *state)
+{
+    state->calib = NULL;
+}
+
+int32_t mlx90632_ambient_state_update(mlx90632_ambient_state_t *state, int16_t ambient_new_raw,
+                                      int16_t ambient_old_raw, const mlx90632_calib_t *calib)
+{
+    double emissivity = mlx90632_get_emissivity();
+    double kEa, kEb, TAdut;
+
+    if ((state->calib == calib) && (state->emissivity == emissivity) &&
+        (state->ambient_new_raw == ambient_new_raw) && (state->ambient_old_raw == ambient_old_raw))
+        return 0;
+
+    state->calib = calib;
+    state->emissivity = emissivity;
+    state->ambient_new_raw = ambient_new_raw;
+    state->ambient_old_raw = ambient_old_raw;
+
+    state->ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw, calib->P_T, calib->P_R,
+                                                calib->P_G, calib->P_O, calib->Gb);
+    state->pre_ambient = (int32_t)mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib->Gb);
+    state->VR_IR = ambient_old_raw + ((double)calib->Ka / 1024.0) * (ambient_new_raw / (MLX90632_REF_3));
+
+    kEa = ((double)calib->Ea) / ((double)65536.0);
+    kEb = ((double)calib->Eb) / ((double)256.0);
+    TAdut = (((double)state->pre_ambient) - kEb) / kEa + 25;
+    state->TAdut4 = (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15);
+    state->Gb = 1 + ((double)calib->Fb * (TAdut - 25)) / ((double)68719476736.0);
+    state->kGa = (double)calib->Ga / ((double)68719476736.0);
+    state->Alpha = emissivity * (double)calib->Fa * (calib->Ha / ((double)16384.0)) / ((double)70368744177664.0);
+    state->Hb_customer = calib->Hb / ((double)1024.0);
+
+    return 1;
+}
+
+double mlx90632_calc_temp_object_cached(const mlx90632_ambient_state_t *state, int16_t object_new_raw,
+                                        int16_t object_old_raw)
+{
+    int32_t object;
+    double temp = 25.0;
+    int8_t i;
+
+    object = (int32_t)(((((object_new_raw + object_old_raw) / 2) / (MLX90632_REF_12)) / state->VR_IR) * 524288.0);
+
+    for (i = 0; i < 5; ++i)
+    {
+        double calcedFa = object / (state->Alpha * (state->Gb + state->kGa * (temp - 25)));
+
+        temp = sqrt(sqrt(calcedFa + state->TAdut4)) - 273.15 - state->Hb_customer;
+    }
+
+    return temp;
+}
+
+///@}
@@ -0,0 +1,157 @@
+/**
+ * @file mlx90632_async.c
+ * @brief Raw reads over asynchronous i2c transfers for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_depends.h"
+#include "mlx90632_async.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+/** Word of register address in the buffer of a transfer which starts at register first */
+#define MLX90632_ASYNC_RAM(async, first, address) ((int16_t)(async)->ram[(address) - (first)])
+
+/** Fill in the read transfer of async and submit it
+ *
+ * @param[in,out] async Pointer to read state with done, context and channel position already set
+ * @param[in] first Address of the first RAM word to read
+ * @param[in] words Number of RAM words to read
+ * @param[in] complete Function which extracts raw values once the transfer is finished
+ *
+ * @retval 0 Transfer was submitted
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+STATIC int32_t mlx90632_async_submit(mlx90632_async_t *async, int16_t first, uint16_t words,
+                                     void (*complete)(mlx90632_i2c_xfer_t *xfer))
+{
+    async->xfer.register_address = first;
+    async->xfer.value = async->ram;
+    async->xfer.words = words;
+    async->xfer.write = 0;
+    async->xfer.status = 0;
+    async->xfer.complete = complete;
+
+    return mlx90632_i2c_submit(&async->xfer);
+}
+
+/** Extract medical raw values when the transfer of @link mlx90632_read_temp_raw_wo_wait_async @endlink is finished
+ *
+ * @param[in] xfer Pointer to the finished transfer, first member of @link mlx90632_async_t @endlink
+ */
+STATIC void mlx90632_async_complete_medical(mlx90632_i2c_xfer_t *xfer)
+{
+    mlx90632_async_t *async = (mlx90632_async_t *)xfer;
+    uint8_t channel = (uint8_t)async->channel_position;
+    uint8_t channel_old = 3 - channel;
+
+    if (xfer->status < 0)
+    {
+        async->done(async, xfer->status);
+        return;
+    }
+
+    async->ambient_new_raw = MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(1), MLX90632_RAM_3(1));
+    async->ambient_old_raw = MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(1), MLX90632_RAM_3(2));
+    async->object_new_raw = (MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(1), MLX90632_RAM_2(channel)) +
+                             MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(1), MLX90632_RAM_1(channel))) / 2;
+    async->object_old_raw = (MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(1), MLX90632_RAM_2(channel_old)) +
+                             MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(1), MLX90632_RAM_1(channel_old))) / 2;
+
+    async->done(async, 0);
+}
+
+int32_t mlx90632_read_temp_raw_wo_wait_async(mlx90632_async_t *async, int32_t channel_position,
+                                             mlx90632_async_cb_t done, void *context)
+{
+    if ((channel_position != 1) && (channel_position != 2))
+        return -EINVAL;
+
+    async->channel_position = channel_position;
+    async->done = done;
+    async->context = context;
+
+    return mlx90632_async_submit(async, MLX90632_RAM_1(1), MLX90632_RAM_3(2) - MLX90632_RAM_1(1) + 1,
+                                 mlx90632_async_complete_medical);
+}
+
+#if MLX90632_ENABLE_EXTENDED
+/** Extract extended range raw values when the transfer of @link mlx90632_read_temp_raw_extended_wo_wait_async
+ * @endlink is finished
+ *
+ * @param[in] xfer Pointer to the finished transfer, first member of @link mlx90632_async_t @endlink
+ */
+STATIC void mlx90632_async_complete_extended(mlx90632_i2c_xfer_t *xfer)
+{
+    mlx90632_async_t *async = (mlx90632_async_t *)xfer;
+    int32_t read;
+
+    if (xfer->status < 0)
+    {
+        async->done(async, xfer->status);
+        return;
+    }
+
+    async->ambient_new_raw = MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(17), MLX90632_RAM_3(17));
+    async->ambient_old_raw = MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(17), MLX90632_RAM_3(18));
+    async->object_old_raw = 0;
+
+    // same grouping and rounding as mlx90632_read_temp_object_raw_extended
+    read = MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(17), MLX90632_RAM_1(17));
+    read = read - MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(17), MLX90632_RAM_2(17));
+    read = read - MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(17), MLX90632_RAM_1(18));
+    read = (read + MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(17), MLX90632_RAM_2(18))) / 2;
+    read = read + MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(17), MLX90632_RAM_1(19));
+    read = read + MLX90632_ASYNC_RAM(async, MLX90632_RAM_1(17), MLX90632_RAM_2(19));
+
+    if (read > 32767 || read < -32768)
+    {
+        async->done(async, -EINVAL);
+        return;
+    }
+    async->object_new_raw = (int16_t)read;
+
+    async->done(async, 0);
+}
+
+int32_t mlx90632_read_temp_raw_extended_wo_wait_async(mlx90632_async_t *async, mlx90632_async_cb_t done,
+                                                      void *context)
+{
+    async->channel_position = 19;
+    async->done = done;
+    async->context = context;
+
+    return mlx90632_async_submit(async, MLX90632_RAM_1(17), MLX90632_RAM_2(19) - MLX90632_RAM_1(17) + 1,
+                                 mlx90632_async_complete_extended);
+}
+#endif
+
+///@}
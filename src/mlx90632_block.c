@@ -0,0 +1,126 @@
+/**
+ * @file mlx90632_block.c
+ * @brief Block read of status register and medical RAM for MLX90632 driver with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_sample.h"
+#include "mlx90632_block.h"
+#include "mlx90632_depends.h"
+
+#define MLX90632_BLOCK_POLL_TIME 200 /**< Retry interval in us of a block read which found no data ready */
+#define MLX90632_BLOCK_LEAD 250 /**< Time in us by which block capture reads earlier than one cycle after the previous read */
+
+/** Words of the block from status register to the last RAM word of medical measurements */
+#define MLX90632_BLOCK_WORDS (MLX90632_RAM_3(2) - MLX90632_REG_STATUS + 1)
+/** Index of a register in the block read by @link mlx90632_read_temp_raw_block_sample @endlink */
+#define MLX90632_BLOCK(address) ((address) - MLX90632_REG_STATUS)
+
+int32_t mlx90632_read_temp_raw_block_sample(mlx90632_sample_t *sample)
+{
+    uint16_t block[MLX90632_BLOCK_WORDS];
+    uint8_t channel, channel_old;
+    int32_t ret;
+
+    ret = mlx90632_i2c_read_block(MLX90632_REG_STATUS, block, MLX90632_BLOCK_WORDS);
+    if (ret < 0)
+        return ret;
+
+    // data of the previous cycle was already read, discard the block
+    if (!(block[0] & MLX90632_STAT_DATA_RDY))
+        return -EAGAIN;
+
+    channel = (block[0] & MLX90632_STAT_CYCLE_POS) >> 2;
+    if ((channel != 1) && (channel != 2))
+        return -EINVAL;
+    channel_old = 3 - channel;
+
+    sample->timestamp_us = mlx90632_get_time_us();
+    sample->status = block[0];
+    sample->cycle_pos = channel;
+    sample->meas_type = MLX90632_MTYP_MEDICAL;
+
+    sample->ambient_new_raw = (int16_t)block[MLX90632_BLOCK(MLX90632_RAM_3(1))];
+    sample->ambient_old_raw = (int16_t)block[MLX90632_BLOCK(MLX90632_RAM_3(2))];
+    sample->object_new_raw = ((int16_t)block[MLX90632_BLOCK(MLX90632_RAM_2(channel))] +
+                              (int16_t)block[MLX90632_BLOCK(MLX90632_RAM_1(channel))]) / 2;
+    sample->object_old_raw = ((int16_t)block[MLX90632_BLOCK(MLX90632_RAM_2(channel_old))] +
+                              (int16_t)block[MLX90632_BLOCK(MLX90632_RAM_1(channel_old))]) / 2;
+
+    return mlx90632_i2c_write(MLX90632_REG_STATUS, block[0] & (~MLX90632_STAT_DATA_RDY));
+}
+
+int32_t mlx90632_capture_block(mlx90632_sample_t *buf, uint32_t n, mlx90632_capture_stats_t *stats)
+{
+    uint32_t period_us[2];
+    uint64_t now, next, start, read = 0;
+    uint32_t i, wait;
+    int32_t ret;
+
+    ret = mlx90632_capture_start(period_us, stats);
+    if (ret < 0)
+        return ret;
+
+    for (i = 0; i < n; ++i)
+    {
+        if (i > 0)
+        {
+            /* Read a little earlier than one cycle after the previous read: each read which finds the data ready
+             * moves the next one closer to data ready, until one comes too early and the retry catches up
+             */
+            next = read + period_us[buf[i - 1].cycle_pos == 1 ? 1 : 0] - MLX90632_BLOCK_LEAD;
+            now = mlx90632_get_time_us();
+            if (next > now)
+            {
+                wait = (uint32_t)(next - now);
+                usleep(wait, wait + MLX90632_BLOCK_POLL_TIME);
+            }
+        }
+
+        start = mlx90632_get_time_us();
+        read = start;
+        while ((ret = mlx90632_read_temp_raw_block_sample(&buf[i])) == -EAGAIN)
+        {
+            // Allow retrying for two full cycles before giving up
+            if (read - start > period_us[0] + period_us[1])
+                return -ETIMEDOUT;
+
+            usleep(MLX90632_BLOCK_POLL_TIME, MLX90632_BLOCK_POLL_TIME + MLX90632_BLOCK_POLL_TIME / 10);
+            read = mlx90632_get_time_us();
+        }
+        if (ret < 0)
+            return ret;
+
+        if (i > 0)
+            mlx90632_capture_account(&buf[i - 1], &buf[i], period_us[buf[i - 1].cycle_pos == 1 ? 1 : 0], stats);
+    }
+
+    return 0;
+}
+
+///@}
@@ -0,0 +1,206 @@
+/**
+ * @file mlx90632_burst_sched.c
+ * @brief Duty-cycled burst measurement scheduler for MLX90632 driver with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_burst_sched.h"
+#include "mlx90632_depends.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+#if MLX90632_ENABLE_BURST
+int32_t mlx90632_burst_sched_init(mlx90632_burst_sched_t *sched, uint32_t period_ms)
+{
+    int32_t ret;
+    uint16_t reg_ctrl;
+
+    ret = mlx90632_get_meas_type();
+    if (ret < 0)
+        return ret;
+
+    if ((ret != MLX90632_MTYP_MEDICAL_BURST) &&
+        (!MLX90632_ENABLE_EXTENDED || (ret != MLX90632_MTYP_EXTENDED_BURST)))
+        return -EINVAL;
+
+    sched->meas_type = (uint8_t)ret;
+
+    ret = mlx90632_calculate_dataset_ready_time();
+    if (ret < 0)
+        return ret;
+
+    if ((uint32_t)ret > period_ms)
+        return -EINVAL;
+
+    sched->dataset_time_us = (uint32_t)ret * 1000;
+
+    ret = mlx90632_i2c_read(MLX90632_REG_CTRL, &reg_ctrl);
+    if (ret < 0)
+        return ret;
+
+    sched->reg_ctrl = reg_ctrl & ~MLX90632_CFG_SOB_MASK;
+    sched->period_us = (uint64_t)period_ms * 1000;
+    sched->next_trigger_us = mlx90632_get_time_us();
+    sched->ready_us = 0;
+    sched->bus_time_us = 0;
+    sched->cpu_time_us = 0;
+    sched->last_bus_time_us = 0;
+    sched->last_cpu_time_us = 0;
+    sched->pending = 0;
+
+    return 0;
+}
+
+/** Trigger the burst and compute the time of the next one
+ *
+ * @param[in,out] sched Pointer to scheduler state
+ * @param[in] now Current time in microseconds
+ *
+ * @retval 0 Burst triggered
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+STATIC int32_t mlx90632_burst_sched_trigger(mlx90632_burst_sched_t *sched, uint64_t now)
+{
+    uint64_t begin = mlx90632_get_time_us();
+    int32_t ret = mlx90632_i2c_write(MLX90632_REG_CTRL, sched->reg_ctrl | MLX90632_START_BURST_MEAS);
+    uint64_t end = mlx90632_get_time_us();
+
+    sched->bus_time_us += (uint32_t)(end - begin);
+    if (ret < 0)
+        return ret;
+
+    sched->pending = 1;
+    sched->ready_us = end + sched->dataset_time_us;
+    sched->next_trigger_us += sched->period_us;
+    // Host woke up too late, skip the missed periods instead of bursting them back to back
+    if (sched->next_trigger_us < sched->ready_us)
+        sched->next_trigger_us = now + sched->period_us;
+
+    return 0;
+}
+
+/** Check that burst is complete and read its raw values
+ *
+ * @retval 1 New raw values were written
+ * @retval 0 Sensor is still busy
+ * @retval -ETIMEDOUT Sensor was still busy one dataset time after the burst should have been complete
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+STATIC int32_t mlx90632_burst_sched_read(mlx90632_burst_sched_t *sched,
+                                         int16_t *ambient_new_raw, int16_t *ambient_old_raw,
+                                         int16_t *object_new_raw, int16_t *object_old_raw)
+{
+    uint64_t begin = mlx90632_get_time_us();
+    uint16_t reg_status;
+    int32_t ret;
+
+    ret = mlx90632_i2c_read(MLX90632_REG_STATUS, &reg_status);
+    if ((ret >= 0) && !(reg_status & MLX90632_STAT_BUSY))
+    {
+#if MLX90632_ENABLE_EXTENDED
+        if (sched->meas_type == MLX90632_MTYP_EXTENDED_BURST)
+            ret = mlx90632_read_temp_raw_extended_wo_wait(ambient_new_raw, ambient_old_raw, object_new_raw);
+        else
+#endif
+            ret = mlx90632_read_temp_raw_wo_wait(2, ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw);
+        if (ret >= 0)
+            ret = 1;
+    }
+    else if (ret >= 0)
+    {
+        ret = 0;
+    }
+    sched->bus_time_us += (uint32_t)(mlx90632_get_time_us() - begin);
+
+    if (ret == 0)
+    {
+        // give up after dataset time / MLX90632_BURST_SCHED_POLL_TIME retries, the burst is lost
+        if (begin >= sched->ready_us + sched->dataset_time_us)
+        {
+            sched->pending = 0;
+            return -ETIMEDOUT;
+        }
+        return 0;
+    }
+
+    if (ret == 1)
+        sched->pending = 0;
+
+    return ret;
+}
+
+int32_t mlx90632_burst_sched_run(mlx90632_burst_sched_t *sched,
+                                 int16_t *ambient_new_raw, int16_t *ambient_old_raw,
+                                 int16_t *object_new_raw, int16_t *object_old_raw,
+                                 uint64_t *wakeup_us)
+{
+    uint64_t start = mlx90632_get_time_us();
+    int32_t ret = 0;
+
+    if (!sched->pending)
+    {
+        if (start >= sched->next_trigger_us)
+        {
+            ret = mlx90632_burst_sched_trigger(sched, start);
+        }
+        *wakeup_us = sched->pending ? sched->ready_us : sched->next_trigger_us;
+    }
+    else if (start >= sched->ready_us)
+    {
+        ret = mlx90632_burst_sched_read(sched, ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw);
+        *wakeup_us = sched->pending ? start + MLX90632_BURST_SCHED_POLL_TIME : sched->next_trigger_us;
+    }
+    else
+    {
+        *wakeup_us = sched->ready_us;
+    }
+
+    // bus time is counted around the register accesses only, CPU time around the whole call
+    sched->cpu_time_us += (uint32_t)(mlx90632_get_time_us() - start);
+
+    if (ret == 1)
+    {
+        sched->last_bus_time_us = sched->bus_time_us;
+        sched->last_cpu_time_us = sched->cpu_time_us;
+        sched->bus_time_us = 0;
+        sched->cpu_time_us = 0;
+    }
+    else if (ret == -ETIMEDOUT)
+    {
+        sched->bus_time_us = 0;
+        sched->cpu_time_us = 0;
+    }
+
+    return ret;
+}
+#endif
+
+///@}
@@ -0,0 +1,219 @@
+/**
+ * @file mlx90632_cost.c
+ * @brief Bus cost model of the acquisition functions of MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_cost.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+/** Register accesses of one pass through the measurement table, as the acquisition function does them */
+typedef struct mlx90632_cost_seq_s {
+    uint8_t meas_count; /**< Measurements in the table */
+    uint8_t samples; /**< Samples returned per pass */
+    uint8_t waits; /**< Waits polling status register per pass, 0 when function sleeps for the measurement time */
+    uint8_t reads; /**< Register reads per pass, without status reads of the waits */
+    uint8_t writes; /**< Register writes per pass */
+    uint8_t latency_reads; /**< Reads from end of measurement to last raw value, without status reads of the waits */
+} mlx90632_cost_seq_t;
+
+static const mlx90632_cost_seq_t mlx90632_cost_seq[MLX90632_COST_APIS] = {
+    // trigger read and write, wait and 6 RAM reads per channel
+    [MLX90632_COST_RAW] = { 2, 2, 2, 14, 2, 6 },
+    // control read and write, measurement type and 2 table reads, sleep, status read and 6 RAM reads
+    [MLX90632_COST_RAW_BURST] = { 2, 1, 0, 11, 1, 10 },
+    // trigger read and write and wait per measurement until position 19, 8 RAM reads
+    [MLX90632_COST_RAW_EXTENDED] = { 3, 1, 3, 11, 3, 8 },
+    // control read and write, measurement type and 3 table reads, sleep, status read and 8 RAM reads
+    [MLX90632_COST_RAW_EXTENDED_BURST] = { 3, 1, 0, 14, 1, 13 },
+    // control write, sleep, status read, 3 RAM reads and status write per channel
+    [MLX90632_COST_SINGLE] = { 2, 2, 0, 8, 4, 4 },
+};
+
+/** Table of measurement parameters in EEPROM used by every acquisition function */
+static const uint16_t mlx90632_cost_meas_ee[MLX90632_COST_APIS][MLX90632_COST_MAX_MEAS] = {
+    [MLX90632_COST_RAW] = { MLX90632_EE_MEDICAL_MEAS1, MLX90632_EE_MEDICAL_MEAS2 },
+    [MLX90632_COST_RAW_BURST] = { MLX90632_EE_MEDICAL_MEAS1, MLX90632_EE_MEDICAL_MEAS2 },
+    [MLX90632_COST_RAW_EXTENDED] = { MLX90632_EE_EXTENDED_MEAS1, MLX90632_EE_EXTENDED_MEAS2, MLX90632_EE_EXTENDED_MEAS3 },
+    [MLX90632_COST_RAW_EXTENDED_BURST] = { MLX90632_EE_EXTENDED_MEAS1, MLX90632_EE_EXTENDED_MEAS2,
+                                           MLX90632_EE_EXTENDED_MEAS3 },
+    [MLX90632_COST_SINGLE] = { MLX90632_EE_MEDICAL_MEAS1, MLX90632_EE_MEDICAL_MEAS2 },
+};
+
+int32_t mlx90632_cost_bus_init(mlx90632_cost_bus_t *bus, uint32_t clock_hz, uint32_t overhead_us)
+{
+    if (clock_hz == 0)
+        return -EINVAL;
+
+    // rounded up, a transaction does not end before its last bit
+    bus->read_us = (uint32_t)(((uint64_t)MLX90632_COST_READ_BITS * 1000000 + clock_hz - 1) / clock_hz) + overhead_us;
+    bus->write_us = (uint32_t)(((uint64_t)MLX90632_COST_WRITE_BITS * 1000000 + clock_hz - 1) / clock_hz) + overhead_us;
+    bus->poll_us = MLX90632_COST_POLL_US;
+
+    return 0;
+}
+
+int32_t mlx90632_cost_sensor_init(mlx90632_cost_sensor_t *sensor, mlx90632_cost_api_t api, mlx90632_meas_t rate)
+{
+    uint8_t i;
+
+    if (((uint32_t)api >= MLX90632_COST_APIS) || (rate < MLX90632_MEAS_HZ_HALF) || (rate > MLX90632_MEAS_HZ_64))
+        return -EINVAL;
+
+    sensor->api = api;
+    sensor->meas_count = mlx90632_cost_seq[api].meas_count;
+    for (i = 0; i < MLX90632_COST_MAX_MEAS; ++i)
+        sensor->meas_time_ms[i] = (i < sensor->meas_count) ? (uint16_t)(MLX90632_MEAS_MAX_TIME >> rate) : 0;
+
+    return 0;
+}
+
+int32_t mlx90632_cost_sensor_read(mlx90632_cost_sensor_t *sensor, mlx90632_cost_api_t api)
+{
+    int32_t ret;
+    uint8_t i;
+
+    if ((uint32_t)api >= MLX90632_COST_APIS)
+        return -EINVAL;
+
+    sensor->api = api;
+    sensor->meas_count = mlx90632_cost_seq[api].meas_count;
+    for (i = 0; i < MLX90632_COST_MAX_MEAS; ++i)
+    {
+        sensor->meas_time_ms[i] = 0;
+        if (i >= sensor->meas_count)
+            continue;
+
+        ret = mlx90632_get_measurement_time(mlx90632_cost_meas_ee[api][i]);
+        if (ret < 0)
+            return ret;
+        sensor->meas_time_ms[i] = (uint16_t)ret;
+    }
+
+    return 0;
+}
+
+int32_t mlx90632_cost_predict(const mlx90632_cost_bus_t *bus, const mlx90632_cost_sensor_t *sensor,
+                              mlx90632_cost_t *cost)
+{
+    const mlx90632_cost_seq_t *seq;
+    double table_us = 0.0;
+    double pass_us, fixed_us, reads;
+    uint8_t i;
+
+    if (((uint32_t)sensor->api >= MLX90632_COST_APIS) ||
+        (sensor->meas_count != mlx90632_cost_seq[sensor->api].meas_count))
+        return -EINVAL;
+
+    seq = &mlx90632_cost_seq[sensor->api];
+    for (i = 0; i < seq->meas_count; ++i)
+        table_us += sensor->meas_time_ms[i] * 1000.0;
+
+    reads = seq->reads;
+    fixed_us = (double)seq->reads * bus->read_us + (double)seq->writes * bus->write_us;
+    if (seq->waits)
+    {
+        /* Sensor measures continuously and the function catches every measurement, so the pass lasts as long as
+         * the table. Time which is not spent on fixed transactions goes to waits, each of them is a status read
+         * followed by a sleep, except for the last status read, which sees data ready.
+         */
+        double polls = (table_us - fixed_us + (double)seq->waits * bus->poll_us) / (bus->poll_us + bus->read_us);
+
+        if (polls < seq->waits)
+        {
+            // function is slower than the sensor, every wait sees data ready at once
+            polls = seq->waits;
+            table_us = fixed_us + polls * bus->read_us;
+        }
+        reads += polls;
+        pass_us = table_us;
+    }
+    else
+    {
+        pass_us = table_us + fixed_us;
+    }
+
+    cost->reads = reads / seq->samples;
+    cost->writes = (double)seq->writes / seq->samples;
+    cost->bus_us = (reads * bus->read_us + (double)seq->writes * bus->write_us) / seq->samples;
+    cost->samples_per_s = seq->samples * 1e6 / pass_us;
+    cost->latency_us = (double)seq->latency_reads * bus->read_us;
+    if (seq->waits)
+        cost->latency_us += (bus->poll_us + bus->read_us) / 2.0; // data ready is seen half a poll later on average
+
+    return 0;
+}
+
+int32_t mlx90632_cost_plan(const mlx90632_cost_bus_t *bus, const mlx90632_cost_sensor_t *sensors, uint32_t count,
+                           mlx90632_cost_t *costs, mlx90632_cost_plan_t *plan)
+{
+    double others, latency_transactions;
+    uint32_t i;
+    int32_t ret;
+
+    if (count == 0)
+        return -EINVAL;
+
+    plan->utilisation = 0.0;
+    for (i = 0; i < count; ++i)
+    {
+        ret = mlx90632_cost_predict(bus, &sensors[i], &costs[i]);
+        if (ret < 0)
+            return ret;
+        plan->utilisation += costs[i].bus_us * costs[i].samples_per_s / 1e6;
+    }
+
+    plan->feasible = plan->utilisation <= 1.0;
+    plan->samples_per_s = 0.0;
+    plan->latency_us = 0.0;
+    for (i = 0; i < count; ++i)
+    {
+        const mlx90632_cost_seq_t *seq = &mlx90632_cost_seq[sensors[i].api];
+
+        // transaction in progress is found with the probability the bus is busy and is half done on average
+        others = plan->utilisation - costs[i].bus_us * costs[i].samples_per_s / 1e6;
+        if (others > 1.0)
+            others = 1.0;
+        latency_transactions = seq->latency_reads + (seq->waits ? 1 : 0);
+        costs[i].latency_us += latency_transactions * others * bus->read_us / 2.0;
+
+        if (!plan->feasible)
+            costs[i].samples_per_s /= plan->utilisation;
+
+        plan->samples_per_s += costs[i].samples_per_s;
+        if (costs[i].latency_us > plan->latency_us)
+            plan->latency_us = costs[i].latency_us;
+    }
+
+    return 0;
+}
+
+///@}
@@ -0,0 +1,226 @@
+/**
+ * @file mlx90632_delta.c
+ * @brief Delta and varint encoding of temperature streams for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_delta.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+#define MLX90632_DELTA_TAG_BLOCK 1 /**< Record tag of a block header, sample tags are even */
+#define MLX90632_DELTA_ZIGZAG_MAX (((uint64_t)1 << 33) - 1) /**< Largest zig-zag difference of two 32-bit values */
+#define MLX90632_DELTA_MDEG_MAX 2147483.0 /**< Largest temperature in degrees Celsius which fits in millidegrees */
+
+/** Write unsigned varint to buf and return number of bytes written */
+STATIC uint32_t mlx90632_delta_varint_put(uint8_t *buf, uint64_t value)
+{
+    uint32_t n = 0;
+
+    while (value >= 0x80)
+    {
+        buf[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buf[n++] = (uint8_t)value;
+    return n;
+}
+
+/** Read unsigned varint from the stream, returns -EBADMSG when it is truncated or longer than 64 bits */
+STATIC int32_t mlx90632_delta_varint_get(const mlx90632_delta_t *delta, uint32_t *pos, uint64_t *value)
+{
+    uint64_t result = 0;
+    uint32_t shift;
+
+    for (shift = 0; shift < 64; shift += 7)
+    {
+        uint8_t byte;
+
+        if (*pos >= delta->size)
+            return -EBADMSG;
+
+        byte = delta->buf[(*pos)++];
+        if ((shift == 63) && (byte > 1))
+            return -EBADMSG;
+
+        result |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            *value = result;
+            return 0;
+        }
+    }
+
+    return -EBADMSG;
+}
+
+/** Map signed value to unsigned so that values close to zero of both signs are small */
+STATIC uint64_t mlx90632_delta_zigzag(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (value < 0 ? UINT64_MAX : 0);
+}
+
+/** Inverse of @link mlx90632_delta_zigzag @endlink */
+STATIC int64_t mlx90632_delta_unzigzag(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+/** Round temperature in degrees Celsius to millidegrees, returns -EINVAL when it does not fit */
+STATIC int32_t mlx90632_delta_mdeg(double temperature, int32_t *mdeg)
+{
+    if (!(fabs(temperature) <= MLX90632_DELTA_MDEG_MAX))
+        return -EINVAL;
+
+    *mdeg = (int32_t)floor(temperature * 1000.0 + 0.5);
+    return 0;
+}
+
+void mlx90632_delta_init(mlx90632_delta_t *delta, uint8_t *buf, uint32_t size)
+{
+    memset(delta, 0, sizeof(*delta));
+    delta->buf = buf;
+    delta->size = size;
+}
+
+int32_t mlx90632_delta_block(mlx90632_delta_t *delta, uint64_t timestamp_us)
+{
+    uint8_t record[MLX90632_DELTA_RECORD_MAX];
+    uint32_t len;
+
+    len = mlx90632_delta_varint_put(record, MLX90632_DELTA_TAG_BLOCK);
+    len += mlx90632_delta_varint_put(record + len, timestamp_us);
+    if (delta->size - delta->pos < len)
+        return -ENOBUFS;
+
+    memcpy(delta->buf + delta->pos, record, len);
+    delta->pos += len;
+    delta->timestamp_us = timestamp_us;
+    delta->interval_us = 0;
+    delta->ambient = 0;
+    delta->object = 0;
+    return 0;
+}
+
+int32_t mlx90632_delta_put(mlx90632_delta_t *delta, uint64_t timestamp_us, double ambient, double object)
+{
+    uint8_t record[MLX90632_DELTA_RECORD_MAX];
+    int32_t ambient_mdeg, object_mdeg;
+    int64_t interval;
+    uint32_t len;
+
+    if ((mlx90632_delta_mdeg(ambient, &ambient_mdeg) < 0) || (mlx90632_delta_mdeg(object, &object_mdeg) < 0))
+        return -EINVAL;
+
+    interval = (int64_t)(timestamp_us - delta->timestamp_us);
+    len = mlx90632_delta_varint_put(record,
+                                    mlx90632_delta_zigzag((int64_t)((uint64_t)interval - delta->interval_us)) << 1);
+    len += mlx90632_delta_varint_put(record + len, mlx90632_delta_zigzag((int64_t)ambient_mdeg - delta->ambient));
+    len += mlx90632_delta_varint_put(record + len, mlx90632_delta_zigzag((int64_t)object_mdeg - delta->object));
+    if (delta->size - delta->pos < len)
+        return -ENOBUFS;
+
+    memcpy(delta->buf + delta->pos, record, len);
+    delta->pos += len;
+    delta->timestamp_us = timestamp_us;
+    delta->interval_us = interval;
+    delta->ambient = ambient_mdeg;
+    delta->object = object_mdeg;
+    return 0;
+}
+
+int32_t mlx90632_delta_get(mlx90632_delta_t *delta, uint64_t *timestamp_us, double *ambient, double *object)
+{
+    uint64_t tag, base, ambient_delta, object_delta;
+    int64_t interval, ambient_mdeg, object_mdeg;
+    uint32_t pos = delta->pos;
+    int32_t ret;
+
+    for (;;)
+    {
+        if (pos >= delta->size)
+            return -ENODATA;
+
+        ret = mlx90632_delta_varint_get(delta, &pos, &tag);
+        if (ret < 0)
+            return ret;
+
+        if (tag != MLX90632_DELTA_TAG_BLOCK)
+            break;
+
+        ret = mlx90632_delta_varint_get(delta, &pos, &base);
+        if (ret < 0)
+            return ret;
+
+        delta->pos = pos;
+        delta->timestamp_us = base;
+        delta->interval_us = 0;
+        delta->ambient = 0;
+        delta->object = 0;
+    }
+
+    if (tag & 1)
+        return -EBADMSG;
+
+    ret = mlx90632_delta_varint_get(delta, &pos, &ambient_delta);
+    if (ret < 0)
+        return ret;
+    ret = mlx90632_delta_varint_get(delta, &pos, &object_delta);
+    if (ret < 0)
+        return ret;
+
+    // differences of two 32-bit values are at most 33 bits
+    if ((ambient_delta > MLX90632_DELTA_ZIGZAG_MAX) || (object_delta > MLX90632_DELTA_ZIGZAG_MAX))
+        return -EBADMSG;
+
+    ambient_mdeg = delta->ambient + mlx90632_delta_unzigzag(ambient_delta);
+    object_mdeg = delta->object + mlx90632_delta_unzigzag(object_delta);
+    if ((ambient_mdeg < INT32_MIN) || (ambient_mdeg > INT32_MAX) ||
+        (object_mdeg < INT32_MIN) || (object_mdeg > INT32_MAX))
+        return -EBADMSG;
+
+    interval = (int64_t)((uint64_t)delta->interval_us + (uint64_t)mlx90632_delta_unzigzag(tag >> 1));
+
+    delta->pos = pos;
+    delta->timestamp_us += (uint64_t)interval;
+    delta->interval_us = interval;
+    delta->ambient = (int32_t)ambient_mdeg;
+    delta->object = (int32_t)object_mdeg;
+
+    *timestamp_us = delta->timestamp_us;
+    *ambient = delta->ambient / 1000.0;
+    *object = delta->object / 1000.0;
+    return 0;
+}
+
+///@}
@@ -0,0 +1,204 @@
+/**
+ * @file mlx90632_emissivity.c
+ * @brief Object temperature under several emissivities for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_emissivity.h"
+
+int32_t mlx90632_calc_temp_object_emissivities(const mlx90632_calib_t *calib,
+                                               int16_t ambient_new_raw, int16_t ambient_old_raw,
+                                               int16_t object_new_raw, int16_t object_old_raw,
+                                               const double *emissivity, double *object, uint16_t count)
+{
+    double kEa, kEb, TAdut, TAdut4, Gb, kGa, Alpha, Hb_customer;
+    int32_t pre_ambient, pre_object;
+    uint16_t c;
+    int8_t i;
+
+    for (c = 0; c < count; ++c)
+    {
+        if (!(emissivity[c] > 0.0))
+            return -EINVAL;
+    }
+
+    pre_ambient = (int32_t)mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib->Gb);
+    pre_object = (int32_t)mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                          ambient_new_raw, ambient_old_raw, calib->Ka);
+
+    kEa = ((double)calib->Ea) / ((double)65536.0);
+    kEb = ((double)calib->Eb) / ((double)256.0);
+    TAdut = (((double)pre_ambient) - kEb) / kEa + 25;
+    TAdut4 = (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15);
+    Gb = 1 + ((double)calib->Fb * (TAdut - 25)) / ((double)68719476736.0);
+    kGa = (double)calib->Ga / ((double)68719476736.0);
+    Alpha = (double)calib->Fa * (calib->Ha / ((double)16384.0)) / ((double)70368744177664.0);
+    Hb_customer = calib->Hb / ((double)1024.0);
+
+    for (c = 0; c < count; ++c)
+        object[c] = 25.0;
+
+    // iterations are the outer loop, so the inner loop has no dependency between candidates
+    for (i = 0; i < 5; ++i)
+    {
+        for (c = 0; c < count; ++c)
+        {
+            double calcedFa = pre_object / (emissivity[c] * Alpha * (Gb + kGa * (object[c] - 25)));
+
+            object[c] = sqrt(sqrt(calcedFa + TAdut4)) - 273.15 - Hb_customer;
+        }
+    }
+
+    return 0;
+}
+
+/** Relative size of determinant below which samples are treated as not determining the fit */
+#define MLX90632_FIT_SINGULAR 1e-9
+
+/** Fourth power of 25 degrees Celsius in Kelvin, subtracted from fit terms to reduce cancellation in the sums */
+#define MLX90632_FIT_PIVOT (298.15 * 298.15 * 298.15 * 298.15)
+
+void mlx90632_emissivity_fit_init(mlx90632_emissivity_fit_t *fit)
+{
+    fit->samples = 0;
+    fit->sw = 0.0;
+    fit->su = 0.0;
+    fit->sz = 0.0;
+    fit->suu = 0.0;
+    fit->suz = 0.0;
+    fit->sxx = 0.0;
+    fit->sxy = 0.0;
+}
+
+int32_t mlx90632_emissivity_fit_add(mlx90632_emissivity_fit_t *fit, const mlx90632_calib_t *calib,
+                                    int16_t ambient_new_raw, int16_t ambient_old_raw,
+                                    int16_t object_new_raw, int16_t object_old_raw, double reference)
+{
+    double kEa, kEb, TAdut, TAdut4, Alpha, D, S, Tobj, Tobj4, w, u, z, x;
+    int32_t pre_ambient, pre_object;
+
+    Tobj = reference + 273.15 + calib->Hb / ((double)1024.0);
+    if (!(reference > -273.15) || !(Tobj > 0.0))
+        return -EINVAL;
+
+    pre_ambient = (int32_t)mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib->Gb);
+    pre_object = (int32_t)mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                          ambient_new_raw, ambient_old_raw, calib->Ka);
+
+    kEa = ((double)calib->Ea) / ((double)65536.0);
+    kEb = ((double)calib->Eb) / ((double)256.0);
+    TAdut = (((double)pre_ambient) - kEb) / kEa + 25;
+    TAdut4 = (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15);
+    Alpha = (double)calib->Fa * (calib->Ha / ((double)16384.0)) / ((double)70368744177664.0);
+    // gain depends on object temperature, which is known from the reference
+    D = 1 + ((double)calib->Fb * (TAdut - 25) + (double)calib->Ga * (reference - 25)) / ((double)68719476736.0);
+    S = pre_object / (Alpha * D);
+    Tobj4 = Tobj * Tobj * Tobj * Tobj;
+
+    // residual of the fourth powers divided by 4 * Tobj^3 is the error in temperature
+    w = 1.0 / (16.0 * Tobj * Tobj * Tobj * Tobj * Tobj * Tobj);
+    u = Tobj4 - MLX90632_FIT_PIVOT;
+    z = S + TAdut4 - MLX90632_FIT_PIVOT;
+    x = Tobj4 - TAdut4;
+
+    fit->samples++;
+    fit->sw += w;
+    fit->su += w * u;
+    fit->sz += w * z;
+    fit->suu += w * u * u;
+    fit->suz += w * u * z;
+    fit->sxx += w * x * x;
+    fit->sxy += w * x * S;
+
+    return 0;
+}
+
+void mlx90632_emissivity_fit_merge(mlx90632_emissivity_fit_t *fit, const mlx90632_emissivity_fit_t *other)
+{
+    fit->samples += other->samples;
+    fit->sw += other->sw;
+    fit->su += other->su;
+    fit->sz += other->sz;
+    fit->suu += other->suu;
+    fit->suz += other->suz;
+    fit->sxx += other->sxx;
+    fit->sxy += other->sxy;
+}
+
+int32_t mlx90632_emissivity_fit_solve(const mlx90632_emissivity_fit_t *fit, double *emissivity)
+{
+    if (!(fit->sxx > 0.0))
+        return -EINVAL;
+
+    *emissivity = fit->sxy / fit->sxx;
+    return 0;
+}
+
+int32_t mlx90632_emissivity_fit_solve_with_reflected(const mlx90632_emissivity_fit_t *fit, double reflected,
+                                                     double *emissivity)
+{
+    double R, den;
+
+    // S + Ta4 - Tr4 = emissivity * (Tobj4 - Tr4), all terms relative to the pivot
+    R = (reflected + 273.15) * (reflected + 273.15) * (reflected + 273.15) * (reflected + 273.15);
+    R -= MLX90632_FIT_PIVOT;
+    den = fit->suu - 2 * R * fit->su + R * R * fit->sw;
+    if (!(den > MLX90632_FIT_SINGULAR * (fit->suu + R * R * fit->sw)))
+        return -EINVAL;
+
+    *emissivity = (fit->suz - R * fit->su - R * fit->sz + R * R * fit->sw) / den;
+    return 0;
+}
+
+int32_t mlx90632_emissivity_fit_solve_reflected(const mlx90632_emissivity_fit_t *fit, double *emissivity,
+                                                double *reflected)
+{
+    double det, e, c, Tr4;
+
+    // z = emissivity * u + c, with c = (1 - emissivity) * Tr4 - (1 - emissivity) * pivot
+    det = fit->sw * fit->suu - fit->su * fit->su;
+    if (!(det > MLX90632_FIT_SINGULAR * fit->sw * fit->suu))
+        return -EINVAL;
+
+    e = (fit->sw * fit->suz - fit->su * fit->sz) / det;
+    c = (fit->sz - e * fit->su) / fit->sw;
+    if (e == 1.0)
+        return -EINVAL;
+
+    Tr4 = c / (1 - e) + MLX90632_FIT_PIVOT;
+    if (!(Tr4 > 0.0))
+        return -ERANGE;
+
+    *emissivity = e;
+    *reflected = sqrt(sqrt(Tr4)) - 273.15;
+    return 0;
+}
+
+///@}
@@ -41,6 +41,7 @@
 #define STATIC static
 #endif
 
+#if MLX90632_ENABLE_EXTENDED
 /** Read ambient raw old and new values for the extended range based on @link mlx90632_start_measurement @endlink return value.
  *
  * Two i2c_reads are needed to obtain necessary raw ambient values from the sensor, as they are then
@@ -169,7 +170,9 @@ int32_t mlx90632_read_temp_raw_extended(int16_t *ambient_new_raw, int16_t *ambie
     /** Read raw ambient and object temperature for extended range */
     return mlx90632_read_temp_raw_extended_wo_wait(ambient_new_raw, ambient_old_raw, object_new_raw);
 }
+#endif
 
+#if MLX90632_ENABLE_EXTENDED && MLX90632_ENABLE_BURST
 int32_t mlx90632_read_temp_raw_extended_burst(int16_t *ambient_new_raw, int16_t *ambient_old_raw, int16_t *object_new_raw)
 {
     // trigger and wait for measurement to complete
@@ -181,7 +184,9 @@ int32_t mlx90632_read_temp_raw_extended_burst(int16_t *ambient_new_raw, int16_t
     /** Read raw ambient and object temperature for extended range */
     return mlx90632_read_temp_raw_extended_wo_wait(ambient_new_raw, ambient_old_raw, object_new_raw);
 }
+#endif
 
+#if MLX90632_ENABLE_EXTENDED
 double mlx90632_preprocess_temp_ambient_extended(int16_t ambient_new_raw, int16_t ambient_old_raw, int16_t Gb)
 {
     double VR_Ta, kGb;
@@ -294,6 +299,7 @@ double mlx90632_calc_temp_object_extended(int32_t object, int32_t ambient, doubl
 
     return temp;
 }
+#endif
 
 int32_t mlx90632_set_meas_type(uint8_t type)
 {
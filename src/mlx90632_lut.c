@@ -0,0 +1,245 @@
+/**
+ * @file mlx90632_lut.c
+ * @brief Interpolated lookup table of object temperature for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_lut.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+/** Preprocess raw values with integer math
+ *
+ * Same as @link mlx90632_preprocess_temp_object @endlink and @link mlx90632_preprocess_temp_ambient @endlink with
+ * results truncated to integer. Denominators are multiplied by MLX90632_REF_3 * 1024, so that Gb and Ka divided by
+ * 1024 stay integer: 12 * 1024 * VR = 12288 * ambient_old_raw + K * ambient_new_raw.
+ *
+ * @param[in] signal Ambient new raw value or average of object raw values
+ * @param[in] ambient_new_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] ambient_old_raw ambient temperature from @link MLX90632_RAM_3 @endlink based on cyclic position
+ * @param[in] K Gb for ambient or Ka for object preprocessing
+ *
+ * @return Preprocessed value
+ */
+STATIC int32_t mlx90632_lut_preprocess(int32_t signal, int16_t ambient_new_raw, int16_t ambient_old_raw, int16_t K)
+{
+    int64_t denominator = 12288 * (int64_t)ambient_old_raw + (int64_t)K * ambient_new_raw;
+
+    if (denominator == 0)
+        return INT32_MAX;
+
+    return (int32_t)(((int64_t)signal << 29) / denominator);
+}
+
+/** Find grid cell of value
+ *
+ * @param[in] value Preprocessed value
+ * @param[in] min Value of first grid point
+ * @param[in] step Distance of grid points
+ * @param[in] points Number of grid points
+ * @param[out] index Index of the lower grid point of the cell
+ * @param[out] fraction Distance of value from the lower grid point
+ *
+ * @retval 0 Value is on the grid
+ * @retval -ERANGE Value is outside of the grid
+ */
+STATIC int32_t mlx90632_lut_cell(int32_t value, int32_t min, int32_t step, uint16_t points,
+                                 uint16_t *index, int32_t *fraction)
+{
+    int64_t offset = (int64_t)value - min;
+
+    if ((offset < 0) || (offset > (int64_t)step * (points - 1)))
+        return -ERANGE;
+
+    *index = (uint16_t)(offset / step);
+    *fraction = (int32_t)(offset % step);
+    if (*index == points - 1)
+    {
+        *index = points - 2;
+        *fraction = step;
+    }
+
+    return 0;
+}
+
+/** Whether table entry holds a temperature */
+STATIC int mlx90632_lut_valid(int16_t temp)
+{
+    return (temp != MLX90632_LUT_INVALID_LOW) && (temp != MLX90632_LUT_INVALID_HIGH);
+}
+
+/** Preprocessed ambient value of ambient temperature, inverse of @link mlx90632_calc_temp_ambient @endlink
+ *
+ * @param[in] temp Ambient temperature in degrees Celsius
+ * @param[in] calib Pointer to calibration parameters
+ *
+ * @return Preprocessed ambient value
+ */
+STATIC double mlx90632_lut_ambient_signal(double temp, const mlx90632_calib_t *calib)
+{
+    double Asub = (double)calib->P_T / 17592186044416.0;
+    double Bgain = 1048576.0 / (double)calib->P_G;
+    double Cblock = (double)calib->P_O / 256.0;
+    double Bsub = (temp - Cblock) / Bgain;
+    int8_t i;
+
+    // second order term is small, so few Newton steps from the linear solution are enough
+    for (i = 0; i < 3; ++i)
+        Bsub -= (Bsub * Bgain + Asub * Bsub * Bsub + Cblock - temp) / (Bgain + 2 * Asub * Bsub);
+
+    return Bsub + (double)calib->P_R / 256.0;
+}
+
+/** Preprocessed object value of object temperature, inverse of DSPv5 object equation
+ *
+ * @param[in] temp Object temperature in degrees Celsius
+ * @param[in] ambient Preprocessed ambient value
+ * @param[in] calib Pointer to calibration parameters
+ *
+ * @return Preprocessed object value
+ */
+STATIC double mlx90632_lut_object_signal(double temp, double ambient, const mlx90632_calib_t *calib)
+{
+    double TAdut = (ambient - calib->Eb / 256.0) / (calib->Ea / 65536.0) + 25;
+    double TAdut4 = pow(TAdut + 273.15, 4);
+    double Alpha = (double)calib->Fa * (calib->Ha / 16384.0) / 70368744177664.0;
+    double Gb = 1 + (calib->Fb * (TAdut - 25) + calib->Ga * (temp - 25)) / 68719476736.0;
+
+    return (pow(temp + 273.15 + calib->Hb / 1024.0, 4) - TAdut4) * mlx90632_get_emissivity() * Alpha * Gb;
+}
+
+int32_t mlx90632_lut_init(mlx90632_lut_t *lut, int16_t *table, uint16_t ambient_points, uint16_t object_points,
+                          const mlx90632_calib_t *calib, double ambient_min, double ambient_max,
+                          double object_min, double object_max)
+{
+    double pre_ambient_min, pre_ambient_max, pre_object_min, pre_object_max, signal;
+    uint16_t a, o;
+
+    if ((ambient_points < 2) || (object_points < 2) || !(ambient_min < ambient_max) || !(object_min < object_max))
+        return -EINVAL;
+    if ((object_min * MLX90632_LUT_SCALE <= MLX90632_LUT_INVALID_LOW) ||
+        (object_max * MLX90632_LUT_SCALE >= MLX90632_LUT_INVALID_HIGH))
+        return -ERANGE;
+
+    pre_ambient_min = mlx90632_lut_ambient_signal(ambient_min, calib);
+    pre_ambient_max = mlx90632_lut_ambient_signal(ambient_max, calib);
+
+    // preprocessed object is monotonic in both temperatures, so extremes are at the corners
+    pre_object_min = mlx90632_lut_object_signal(object_min, pre_ambient_min, calib);
+    pre_object_max = pre_object_min;
+    signal = mlx90632_lut_object_signal(object_min, pre_ambient_max, calib);
+    pre_object_min = fmin(pre_object_min, signal);
+    pre_object_max = fmax(pre_object_max, signal);
+    signal = mlx90632_lut_object_signal(object_max, pre_ambient_min, calib);
+    pre_object_min = fmin(pre_object_min, signal);
+    pre_object_max = fmax(pre_object_max, signal);
+    signal = mlx90632_lut_object_signal(object_max, pre_ambient_max, calib);
+    pre_object_min = fmin(pre_object_min, signal);
+    pre_object_max = fmax(pre_object_max, signal);
+
+    lut->temp = table;
+    lut->ambient_points = ambient_points;
+    lut->object_points = object_points;
+    lut->ambient_min = (int32_t)floor(pre_ambient_min);
+    lut->ambient_step = (int32_t)ceil((ceil(pre_ambient_max) - lut->ambient_min) / (ambient_points - 1));
+    lut->object_min = (int32_t)floor(pre_object_min);
+    lut->object_step = (int32_t)ceil((ceil(pre_object_max) - lut->object_min) / (object_points - 1));
+    if (lut->ambient_step < 1)
+        lut->ambient_step = 1;
+    if (lut->object_step < 1)
+        lut->object_step = 1;
+    lut->Gb = calib->Gb;
+    lut->Ka = calib->Ka;
+
+    for (a = 0; a < ambient_points; ++a)
+    {
+        int32_t ambient = lut->ambient_min + a * lut->ambient_step;
+
+        for (o = 0; o < object_points; ++o)
+        {
+            double temp = mlx90632_calc_temp_object(lut->object_min + o * lut->object_step, ambient,
+                                                    calib->Ea, calib->Eb, calib->Ga, calib->Fa, calib->Fb,
+                                                    calib->Ha, calib->Hb);
+
+            // corners of the grid can be outside of the requested range, even below absolute zero
+            temp = round(temp * MLX90632_LUT_SCALE);
+            if (temp > MLX90632_LUT_INVALID_HIGH)
+                temp = MLX90632_LUT_INVALID_HIGH;
+            else if (!(temp > MLX90632_LUT_INVALID_LOW))
+                temp = MLX90632_LUT_INVALID_LOW;
+            table[a * object_points + o] = (int16_t)temp;
+        }
+    }
+
+    return 0;
+}
+
+int32_t mlx90632_lut_calc_temp_object(const mlx90632_lut_t *lut, int16_t ambient_new_raw, int16_t ambient_old_raw,
+                                      int16_t object_new_raw, int16_t object_old_raw, int32_t *object)
+{
+    int32_t ambient, signal, ambient_fraction, object_fraction;
+    uint16_t a, o;
+    const int16_t *row;
+    int64_t low, high, sum, divisor;
+
+    ambient = mlx90632_lut_preprocess(ambient_new_raw, ambient_new_raw, ambient_old_raw, lut->Gb);
+    signal = mlx90632_lut_preprocess((object_new_raw + object_old_raw) / 2, ambient_new_raw, ambient_old_raw,
+                                     lut->Ka);
+
+    if (mlx90632_lut_cell(ambient, lut->ambient_min, lut->ambient_step, lut->ambient_points, &a,
+                          &ambient_fraction) < 0)
+        return -ERANGE;
+    if (mlx90632_lut_cell(signal, lut->object_min, lut->object_step, lut->object_points, &o,
+                          &object_fraction) < 0)
+        return -ERANGE;
+
+    row = &lut->temp[a * lut->object_points + o];
+    if (!mlx90632_lut_valid(row[0]) || !mlx90632_lut_valid(row[1]) ||
+        !mlx90632_lut_valid(row[lut->object_points]) || !mlx90632_lut_valid(row[lut->object_points + 1]))
+        return -ERANGE;
+
+    low = (int64_t)row[0] * (lut->object_step - object_fraction) + (int64_t)row[1] * object_fraction;
+    row += lut->object_points;
+    high = (int64_t)row[0] * (lut->object_step - object_fraction) + (int64_t)row[1] * object_fraction;
+
+    sum = (low * (lut->ambient_step - ambient_fraction) + high * ambient_fraction) * (1000 / MLX90632_LUT_SCALE);
+    divisor = (int64_t)lut->ambient_step * lut->object_step;
+    // round half away from zero
+    if (sum < 0)
+        *object = (int32_t)((sum - divisor / 2) / divisor);
+    else
+        *object = (int32_t)((sum + divisor / 2) / divisor);
+
+    return 0;
+}
+
+///@}
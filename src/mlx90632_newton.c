@@ -0,0 +1,174 @@
+/**
+ * @file mlx90632_newton.c
+ * @brief Object temperature solver with Halley steps for MLX90632 driver
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_newton.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+/** Solve DSPv5 object temperature equation with Halley steps
+ *
+ * Fixed-point form of the equation is T = (K / D(T) + Ta4)^(1/4) - 273.15 - Hb', with
+ * D(T) = Gb + kGa * (T - 25). With u = T + 273.15 + Hb' it becomes the root of the polynomial
+ * F(u) = (u^4 - Ta4) * D(u) - K, which has simple derivatives. Steps start from the closed-form solution with the
+ * gain fixed at D = Gb and use first and second derivative of F, so they converge cubically.
+ *
+ * @param[in] K Object signal divided by emissivity and object gain
+ * @param[in] Gb Gain term which does not depend on object temperature, 1 + Fb * (TAdut - 25) / 2^36
+ * @param[in] kGa Object temperature coefficient of the gain, Ga / 2^36
+ * @param[in] Ta4 Fourth power of ambient or reflected temperature compensation in Kelvin
+ * @param[in] Hb_customer Customer offset in degrees Celsius
+ *
+ * @return Calculated object temperature in degrees Celsius
+ */
+STATIC double mlx90632_newton_solve(double K, double Gb, double kGa, double Ta4, double Hb_customer)
+{
+    double offset = 273.15 + Hb_customer;
+    double u = sqrt(sqrt(K / Gb + Ta4));
+    int8_t i;
+
+    for (i = 0; i < MLX90632_NEWTON_STEPS; ++i)
+    {
+        double u2 = u * u;
+        double u3 = u2 * u;
+        double D = Gb + kGa * (u - offset - 25);
+        double P = u2 * u2 - Ta4;
+        double F = P * D - K;
+        double dF = 4 * u3 * D + P * kGa;
+        double ddF = 12 * u2 * D + 8 * u3 * kGa;
+
+        u = u - 2 * F * dF / (2 * dF * dF - F * ddF);
+    }
+
+    return u - offset;
+}
+
+/** Calculate ambient temperature of the die and setup the Newton solver inputs
+ *
+ * @param[in] object object temperature from preprocessing
+ * @param[in] ambient ambient temperature from preprocessing
+ * @param[in] Ea Register value on @link MLX90632_EE_Ea @endlink
+ * @param[in] Eb Register value on @link MLX90632_EE_Eb @endlink
+ * @param[in] Fa Register value on @link MLX90632_EE_Fa @endlink, or half of it for extended range
+ * @param[in] Fb Register value on @link MLX90632_EE_Fb @endlink
+ * @param[in] Ha Register value on @link MLX90632_EE_Ha @endlink
+ * @param[in] emissivity Value provided by user of the object emissivity
+ * @param[out] K Object signal divided by emissivity and object gain
+ * @param[out] Gb Gain term which does not depend on object temperature
+ *
+ * @return TAdut, ambient temperature of the die in degrees Celsius
+ */
+STATIC double mlx90632_newton_setup(int32_t object, int32_t ambient, int32_t Ea, int32_t Eb, int32_t Fa, int32_t Fb,
+                                    int16_t Ha, double emissivity, double *K, double *Gb)
+{
+    double kEa, kEb, TAdut, Alpha;
+
+    kEa = ((double)Ea) / ((double)65536.0);
+    kEb = ((double)Eb) / ((double)256.0);
+    TAdut = (((double)ambient) - kEb) / kEa + 25;
+
+    Alpha = (double)Fa * (Ha / ((double)16384.0)) / ((double)70368744177664.0);
+    *K = object / (emissivity * Alpha);
+    *Gb = 1 + ((double)Fb * (TAdut - 25)) / ((double)68719476736.0);
+
+    return TAdut;
+}
+
+#if MLX90632_ENABLE_REFLECTED || MLX90632_ENABLE_EXTENDED
+/** Fourth power of reflected temperature compensation, as in @link mlx90632_calc_temp_object_reflected @endlink
+ *
+ * @param[in] TAdut ambient temperature of the die in degrees Celsius
+ * @param[in] reflected temperature of the environment in degrees Celsius
+ * @param[in] emissivity Value provided by user of the object emissivity
+ *
+ * @return Compensation term in Kelvin^4
+ */
+STATIC double mlx90632_newton_reflected(double TAdut, double reflected, double emissivity)
+{
+    double TaTr4, ta4;
+
+    TaTr4 = reflected + 273.15;
+    TaTr4 = TaTr4 * TaTr4;
+    TaTr4 = TaTr4 * TaTr4;
+    ta4 = TAdut + 273.15;
+    ta4 = ta4 * ta4;
+    ta4 = ta4 * ta4;
+
+    return TaTr4 - (TaTr4 - ta4) / emissivity;
+}
+#endif
+
+double mlx90632_calc_temp_object_newton(int32_t object, int32_t ambient,
+                                        int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
+                                        int16_t Ha, int16_t Hb)
+{
+    double K, Gb, TAdut, TAdut4;
+
+    TAdut = mlx90632_newton_setup(object, ambient, Ea, Eb, Fa, Fb, Ha, mlx90632_get_emissivity(), &K, &Gb);
+    TAdut4 = (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15) * (TAdut + 273.15);
+
+    return mlx90632_newton_solve(K, Gb, (double)Ga / ((double)68719476736.0), TAdut4, Hb / ((double)1024.0));
+}
+
+#if MLX90632_ENABLE_REFLECTED
+double mlx90632_calc_temp_object_reflected_newton(int32_t object, int32_t ambient, double reflected,
+                                                  int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
+                                                  int16_t Ha, int16_t Hb)
+{
+    double K, Gb, TAdut;
+    double emissivity = mlx90632_get_emissivity();
+
+    TAdut = mlx90632_newton_setup(object, ambient, Ea, Eb, Fa, Fb, Ha, emissivity, &K, &Gb);
+
+    return mlx90632_newton_solve(K, Gb, (double)Ga / ((double)68719476736.0),
+                                 mlx90632_newton_reflected(TAdut, reflected, emissivity), Hb / ((double)1024.0));
+}
+#endif
+
+#if MLX90632_ENABLE_EXTENDED
+double mlx90632_calc_temp_object_extended_newton(int32_t object, int32_t ambient, double reflected,
+                                                 int32_t Ea, int32_t Eb, int32_t Ga, int32_t Fa, int32_t Fb,
+                                                 int16_t Ha, int16_t Hb)
+{
+    double K, Gb, TAdut;
+    double emissivity = mlx90632_get_emissivity();
+
+    TAdut = mlx90632_newton_setup(object, ambient, Ea, Eb, Fa / 2, Fb, Ha, emissivity, &K, &Gb);
+
+    return mlx90632_newton_solve(K, Gb, (double)Ga / ((double)68719476736.0),
+                                 mlx90632_newton_reflected(TAdut, reflected, emissivity), Hb / ((double)1024.0));
+}
+#endif
+
+///@}
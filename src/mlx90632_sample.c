@@ -0,0 +1,333 @@
+/**
+ * @file mlx90632_sample.c
+ * @brief Raw read functions with per-sample metadata for MLX90632 driver with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_sample.h"
+#include "mlx90632_depends.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+#define MLX90632_CAPTURE_POLL_TIME 200 /**< Status polling interval in us during capture */
+#define MLX90632_CAPTURE_MARGIN 1000 /**< Time in us before expected data ready at which capture starts polling */
+
+/** Poll status register until it reaches expected value and record it in the sample
+ *
+ * Status register value which completed the wait is stored in the sample together with the time at which it was read.
+ *
+ * @param[out] sample Pointer to sample where status, cycle position and timestamp are written
+ * @param[in] mask Status register bits to check
+ * @param[in] value Expected value of the masked status register bits
+ * @param[in] tries Maximum number of status register reads
+ * @param[in] poll_time Time to sleep between two status register reads in microseconds
+ *
+ * @retval >=0 Cycle position of the new measurement
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+STATIC int32_t mlx90632_sample_poll(mlx90632_sample_t *sample, uint16_t mask, uint16_t value,
+                                    int tries, int poll_time)
+{
+    uint16_t reg_status;
+    int32_t ret;
+
+    while (tries-- > 0)
+    {
+        ret = mlx90632_i2c_read(MLX90632_REG_STATUS, &reg_status);
+        if (ret < 0)
+            return ret;
+        if ((reg_status & mask) == value)
+            break;
+        usleep(poll_time, poll_time + poll_time / 10);
+    }
+
+    if (tries < 0)
+    {
+        // data not ready
+        return -ETIMEDOUT;
+    }
+
+    sample->timestamp_us = mlx90632_get_time_us();
+    sample->status = reg_status;
+    sample->cycle_pos = (reg_status & MLX90632_STAT_CYCLE_POS) >> 2;
+
+    return sample->cycle_pos;
+}
+
+/** Wait for status register to reach expected value and record it in the sample
+ *
+ * Same polling as @link mlx90632_wait_for_measurement @endlink and @link mlx90632_wait_for_measurement_burst
+ * @endlink, but status register value which completed the wait is stored in the sample together with the time at
+ * which it was read.
+ *
+ * @param[out] sample Pointer to sample where status, cycle position and timestamp are written
+ * @param[in] mask Status register bits to check
+ * @param[in] value Expected value of the masked status register bits
+ *
+ * @retval >=0 Cycle position of the new measurement
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+STATIC int32_t mlx90632_sample_wait(mlx90632_sample_t *sample, uint16_t mask, uint16_t value)
+{
+    /* minimum wait time to complete measurement
+     * should be calculated according to refresh rate
+     * atm 10ms - 11ms
+     */
+    return mlx90632_sample_poll(sample, mask, value, MLX90632_MAX_NUMBER_MESUREMENT_READ_TRIES, 10000);
+}
+
+#if MLX90632_ENABLE_BURST
+/** Trigger burst measurement and wait for the whole measurement table to be refreshed
+ *
+ * @param[out] sample Pointer to sample where status, cycle position and timestamp are written
+ *
+ * @retval >=0 Cycle position reported by the sensor
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+STATIC int32_t mlx90632_sample_start_burst(mlx90632_sample_t *sample)
+{
+    int32_t ret = mlx90632_trigger_measurement_burst();
+
+    if (ret < 0)
+        return ret;
+
+    ret = mlx90632_calculate_dataset_ready_time();
+    if (ret < 0)
+        return ret;
+    msleep(ret); /* Waiting for refresh of all the measurement tables */
+
+    return mlx90632_sample_wait(sample, MLX90632_STAT_BUSY, 0);
+}
+#endif
+
+int32_t mlx90632_read_temp_raw_wo_wait_sample(int32_t channel_position, mlx90632_sample_t *sample)
+{
+    sample->timestamp_us = mlx90632_get_time_us();
+    sample->status = 0;
+    sample->cycle_pos = (uint8_t)channel_position;
+    sample->meas_type = MLX90632_MTYP_MEDICAL;
+
+    return mlx90632_read_temp_raw_wo_wait(channel_position, &sample->ambient_new_raw, &sample->ambient_old_raw,
+                                          &sample->object_new_raw, &sample->object_old_raw);
+}
+
+int32_t mlx90632_read_temp_raw_sample(mlx90632_sample_t *sample)
+{
+    int32_t ret = mlx90632_trigger_measurement();
+
+    if (ret < 0)
+        return ret;
+
+    ret = mlx90632_sample_wait(sample, MLX90632_STAT_DATA_RDY, MLX90632_STAT_DATA_RDY);
+    if (ret < 0)
+        return ret;
+
+    sample->meas_type = MLX90632_MTYP_MEDICAL;
+
+    return mlx90632_read_temp_raw_wo_wait(ret, &sample->ambient_new_raw, &sample->ambient_old_raw,
+                                          &sample->object_new_raw, &sample->object_old_raw);
+}
+
+#if MLX90632_ENABLE_BURST
+int32_t mlx90632_read_temp_raw_burst_sample(mlx90632_sample_t *sample)
+{
+    int32_t ret = mlx90632_sample_start_burst(sample);
+
+    if (ret < 0)
+        return ret;
+
+    sample->meas_type = MLX90632_MTYP_MEDICAL_BURST;
+
+    return mlx90632_read_temp_raw_wo_wait(2, &sample->ambient_new_raw, &sample->ambient_old_raw,
+                                          &sample->object_new_raw, &sample->object_old_raw);
+}
+#endif
+
+#if MLX90632_ENABLE_EXTENDED
+int32_t mlx90632_read_temp_raw_extended_wo_wait_sample(mlx90632_sample_t *sample)
+{
+    sample->timestamp_us = mlx90632_get_time_us();
+    sample->status = 0;
+    sample->cycle_pos = 19;
+    sample->meas_type = MLX90632_MTYP_EXTENDED;
+    sample->object_old_raw = 0;
+
+    return mlx90632_read_temp_raw_extended_wo_wait(&sample->ambient_new_raw, &sample->ambient_old_raw,
+                                                   &sample->object_new_raw);
+}
+
+int32_t mlx90632_read_temp_raw_extended_sample(mlx90632_sample_t *sample)
+{
+    int32_t ret;
+    int tries = 3;
+
+    // trigger and wait for measurement to complete
+    while (tries-- > 0)
+    {
+        ret = mlx90632_trigger_measurement();
+        if (ret < 0)
+            return ret;
+
+        ret = mlx90632_sample_wait(sample, MLX90632_STAT_DATA_RDY, MLX90632_STAT_DATA_RDY);
+        if (ret < 0)
+            return ret;
+
+        if (ret == 19)
+            break;
+    }
+
+    if (tries < 0)
+    {
+        // data not ready
+        return -ETIMEDOUT;
+    }
+
+    sample->meas_type = MLX90632_MTYP_EXTENDED;
+    sample->object_old_raw = 0;
+
+    return mlx90632_read_temp_raw_extended_wo_wait(&sample->ambient_new_raw, &sample->ambient_old_raw,
+                                                   &sample->object_new_raw);
+}
+#endif
+
+#if MLX90632_ENABLE_EXTENDED && MLX90632_ENABLE_BURST
+int32_t mlx90632_read_temp_raw_extended_burst_sample(mlx90632_sample_t *sample)
+{
+    int32_t ret = mlx90632_sample_start_burst(sample);
+
+    if (ret < 0)
+        return ret;
+
+    sample->meas_type = MLX90632_MTYP_EXTENDED_BURST;
+    sample->object_old_raw = 0;
+
+    return mlx90632_read_temp_raw_extended_wo_wait(&sample->ambient_new_raw, &sample->ambient_old_raw,
+                                                   &sample->object_new_raw);
+}
+#endif
+
+void mlx90632_capture_account(const mlx90632_sample_t *prev, const mlx90632_sample_t *cur, uint32_t period_us,
+                              mlx90632_capture_stats_t *stats)
+{
+    uint64_t elapsed = cur->timestamp_us - prev->timestamp_us;
+    uint32_t cycles = (uint32_t)((elapsed + period_us / 2) / period_us);
+    uint32_t odd = (cur->cycle_pos != prev->cycle_pos);
+
+    if ((cycles & 1) != odd)
+    {
+        if ((cycles == 0) || ((uint64_t)cycles * period_us < elapsed))
+            cycles++;
+        else
+            cycles--;
+    }
+
+    if (cycles == 0)
+        stats->duplicated++;
+    else
+        stats->missed += cycles - 1;
+}
+
+int32_t mlx90632_capture_start(uint32_t period_us[2], mlx90632_capture_stats_t *stats)
+{
+    int32_t ret;
+
+    ret = mlx90632_get_measurement_time(MLX90632_EE_MEDICAL_MEAS1);
+    if (ret < 0)
+        return ret;
+    period_us[0] = (uint32_t)ret * 1000;
+
+    ret = mlx90632_get_measurement_time(MLX90632_EE_MEDICAL_MEAS2);
+    if (ret < 0)
+        return ret;
+    period_us[1] = (uint32_t)ret * 1000;
+
+    stats->missed = 0;
+    stats->duplicated = 0;
+
+    ret = mlx90632_trigger_measurement();
+    if (ret < 0)
+        return ret;
+
+    return 0;
+}
+
+int32_t mlx90632_capture(mlx90632_sample_t *buf, uint32_t n, mlx90632_capture_stats_t *stats)
+{
+    uint32_t period_us[2];
+    uint64_t now, next;
+    uint32_t i, wait;
+    int tries;
+    int32_t ret;
+
+    ret = mlx90632_capture_start(period_us, stats);
+    if (ret < 0)
+        return ret;
+
+    // Allow polling for two full cycles before giving up
+    tries = (int)((period_us[0] + period_us[1]) / MLX90632_CAPTURE_POLL_TIME) + 1;
+
+    for (i = 0; i < n; ++i)
+    {
+        if (i > 0)
+        {
+            // Measurement following channel 1 is channel 2 and vice versa
+            next = buf[i - 1].timestamp_us + period_us[buf[i - 1].cycle_pos == 1 ? 1 : 0];
+            now = mlx90632_get_time_us();
+            if (next > now + MLX90632_CAPTURE_MARGIN)
+            {
+                wait = (uint32_t)(next - now - MLX90632_CAPTURE_MARGIN);
+                usleep(wait, wait + MLX90632_CAPTURE_POLL_TIME);
+            }
+        }
+
+        ret = mlx90632_sample_poll(&buf[i], MLX90632_STAT_DATA_RDY, MLX90632_STAT_DATA_RDY,
+                                   tries, MLX90632_CAPTURE_POLL_TIME);
+        if (ret < 0)
+            return ret;
+
+        ret = mlx90632_i2c_write(MLX90632_REG_STATUS, buf[i].status & (~MLX90632_STAT_DATA_RDY));
+        if (ret < 0)
+            return ret;
+
+        buf[i].meas_type = MLX90632_MTYP_MEDICAL;
+        ret = mlx90632_read_temp_raw_wo_wait(buf[i].cycle_pos, &buf[i].ambient_new_raw, &buf[i].ambient_old_raw,
+                                             &buf[i].object_new_raw, &buf[i].object_old_raw);
+        if (ret < 0)
+            return ret;
+
+        if (i > 0)
+            mlx90632_capture_account(&buf[i - 1], &buf[i], period_us[buf[i - 1].cycle_pos == 1 ? 1 : 0], stats);
+    }
+
+    return 0;
+}
+
+///@}
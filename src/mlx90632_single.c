@@ -0,0 +1,221 @@
+/**
+ * @file mlx90632_single.c
+ * @brief On-demand single measurement pipeline for MLX90632 driver with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @details
+ *
+ * @addtogroup mlx90632_private MLX90632 Internal library functions
+ * @{
+ *
+ */
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_single.h"
+#include "mlx90632_depends.h"
+
+#ifndef STATIC
+#define STATIC static
+#endif
+
+#define MLX90632_SINGLE_POLL_TIME 500 /**< Status polling interval in us once nominal measurement time has passed */
+
+/** State of the single measurement pipeline */
+static struct {
+    uint16_t reg_ctrl; /**< Control register value with step mode, without SOC bit */
+    int32_t meas_time[2]; /**< Duration of medical measurement 1 and 2 in ms */
+    int32_t channel; /**< Channel updated by the last completed measurement, 0 when unknown */
+    int32_t completed; /**< Completed measurements since init, saturates at warm-up count */
+    int16_t raw[2][3]; /**< Cached RAM_1, RAM_2 and RAM_3 value of channel 1 and 2 */
+    uint8_t initialized; /**< Set when @link mlx90632_single_init @endlink was successful */
+} single;
+
+int32_t mlx90632_single_init(void)
+{
+    int32_t ret;
+    uint16_t reg_ctrl;
+
+    single.initialized = 0;
+
+    ret = mlx90632_get_measurement_time(MLX90632_EE_MEDICAL_MEAS1);
+    if (ret < 0)
+        return ret;
+    single.meas_time[0] = ret;
+
+    ret = mlx90632_get_measurement_time(MLX90632_EE_MEDICAL_MEAS2);
+    if (ret < 0)
+        return ret;
+    single.meas_time[1] = ret;
+
+    ret = mlx90632_i2c_read(MLX90632_REG_CTRL, &reg_ctrl);
+    if (ret < 0)
+        return ret;
+
+    reg_ctrl = reg_ctrl & (~MLX90632_CFG_MTYP_MASK & ~MLX90632_CFG_PWR_MASK &
+                           ~MLX90632_CFG_SOC_MASK & ~MLX90632_CFG_SOB_MASK);
+    reg_ctrl |= (MLX90632_MTYP_STATUS_MEDICAL | MLX90632_PWR_STATUS_STEP);
+
+    ret = mlx90632_i2c_write(MLX90632_REG_CTRL, reg_ctrl);
+    if (ret < 0)
+        return ret;
+
+    // Data left behind by previous mode must not be mistaken for a completed measurement
+    ret = mlx90632_trigger_measurement();
+    if (ret < 0)
+        return ret;
+
+    single.reg_ctrl = reg_ctrl;
+    single.channel = 0;
+    single.completed = 0;
+    single.initialized = 1;
+
+    return 0;
+}
+
+/** Trigger one single measurement and read the channel it updated into the cache
+ *
+ * Trigger is a single write since control register value is cached. Sleep time is the measurement duration of the
+ * channel following the last updated one, or the longer of both when it is not known yet. Status register value
+ * read while polling is reused to clear the data ready flag after the channel was read.
+ *
+ * @retval 0 Successfully completed measurement and updated the cache
+ * @retval <0 Something went wrong. Check errno.h for more details
+ */
+STATIC int32_t mlx90632_single_step(void)
+{
+    int tries = MLX90632_MAX_NUMBER_MESUREMENT_READ_TRIES;
+    uint16_t reg_status;
+    uint16_t read_tmp;
+    int32_t sleep_time;
+    int32_t channel;
+    int32_t ret;
+
+    if (single.channel == 1)
+        sleep_time = single.meas_time[1];
+    else if (single.channel == 2)
+        sleep_time = single.meas_time[0];
+    else if (single.meas_time[0] > single.meas_time[1])
+        sleep_time = single.meas_time[0];
+    else
+        sleep_time = single.meas_time[1];
+
+    ret = mlx90632_i2c_write(MLX90632_REG_CTRL, single.reg_ctrl | MLX90632_START_SINGLE_MEAS);
+    if (ret < 0)
+        return ret;
+
+    msleep(sleep_time);
+
+    while (tries-- > 0)
+    {
+        ret = mlx90632_i2c_read(MLX90632_REG_STATUS, &reg_status);
+        if (ret < 0)
+            return ret;
+        if (reg_status & MLX90632_STAT_DATA_RDY)
+            break;
+        usleep(MLX90632_SINGLE_POLL_TIME, MLX90632_SINGLE_POLL_TIME + 100);
+    }
+
+    if (tries < 0)
+    {
+        // data not ready
+        return -ETIMEDOUT;
+    }
+
+    channel = (reg_status & MLX90632_STAT_CYCLE_POS) >> 2;
+    if ((channel != 1) && (channel != 2))
+        return -EINVAL;
+
+    ret = mlx90632_i2c_read(MLX90632_RAM_1(channel), &read_tmp);
+    if (ret < 0)
+        return ret;
+    single.raw[channel - 1][0] = (int16_t)read_tmp;
+
+    ret = mlx90632_i2c_read(MLX90632_RAM_2(channel), &read_tmp);
+    if (ret < 0)
+        return ret;
+    single.raw[channel - 1][1] = (int16_t)read_tmp;
+
+    ret = mlx90632_i2c_read(MLX90632_RAM_3(channel), &read_tmp);
+    if (ret < 0)
+        return ret;
+    single.raw[channel - 1][2] = (int16_t)read_tmp;
+
+    ret = mlx90632_i2c_write(MLX90632_REG_STATUS, reg_status & (~MLX90632_STAT_DATA_RDY));
+    if (ret < 0)
+        return ret;
+
+    single.channel = channel;
+    if (single.completed < MLX90632_SINGLE_WARMUP_MEASUREMENTS)
+        single.completed++;
+
+    return 0;
+}
+
+int32_t mlx90632_single_measurement(const mlx90632_calib_t *calib, double *ambient, double *object,
+                                    uint32_t *latency_us)
+{
+    int16_t ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw;
+    double pre_ambient, pre_object;
+    uint64_t start;
+    int32_t ret;
+    int new, old;
+
+    if (!single.initialized)
+        return -EINVAL;
+
+    while (single.completed < MLX90632_SINGLE_WARMUP_MEASUREMENTS)
+    {
+        ret = mlx90632_single_step();
+        if (ret < 0)
+            return ret;
+    }
+
+    start = mlx90632_get_time_us();
+
+    ret = mlx90632_single_step();
+    if (ret < 0)
+        return ret;
+
+    new = single.channel - 1;
+    old = 2 - single.channel;
+
+    // ambient words do not depend on the channel, as in mlx90632_read_temp_ambient_raw
+    ambient_new_raw = single.raw[0][2];
+    ambient_old_raw = single.raw[1][2];
+    object_new_raw = (single.raw[new][1] + single.raw[new][0]) / 2;
+    object_old_raw = (single.raw[old][1] + single.raw[old][0]) / 2;
+
+    *ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw,
+                                          calib->P_T, calib->P_R, calib->P_G, calib->P_O, calib->Gb);
+
+    pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib->Gb);
+    pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                 ambient_new_raw, ambient_old_raw, calib->Ka);
+    *object = mlx90632_calc_temp_object(pre_object, pre_ambient, calib->Ea, calib->Eb, calib->Ga,
+                                        calib->Fa, calib->Fb, calib->Ha, calib->Hb);
+
+    *latency_us = (uint32_t)(mlx90632_get_time_us() - start);
+
+    return 0;
+}
+
+///@}
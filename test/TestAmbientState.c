@@ -0,0 +1,123 @@
+/**
+ * @file
+ * @brief Unit tests for object temperature calculation with cached ambient terms
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_ambient_state.h"
+#include "calib_fixture.h"
+
+#include "mock_mlx90632_depends.h"
+
+static mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static mlx90632_ambient_state_t state;
+
+/** Rounding difference of the reordered calculations */
+#define CACHED_TOLERANCE 1e-9
+
+static double reference_object(const mlx90632_calib_t *c, int16_t ambient_new_raw, int16_t ambient_old_raw,
+                               int16_t object_new_raw, int16_t object_old_raw)
+{
+    double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, c->Gb);
+    double pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                        ambient_new_raw, ambient_old_raw, c->Ka);
+
+    return mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient, c->Ea, c->Eb, c->Ga,
+                                     c->Fa, c->Fb, c->Ha, c->Hb);
+}
+
+void setUp(void)
+{
+    mlx90632_set_emissivity(1.0);
+    mlx90632_ambient_state_invalidate(&state);
+}
+
+void tearDown(void)
+{
+}
+
+void test_ambient_state_matches_reference(void)
+{
+    static const int16_t raw[] = { 609, 149, -149, 32767, -5000, 26901, 27105 };
+    uint8_t i;
+
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_ambient_state_update(&state, 22454, 23030, &calib));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 48.724, state.ambient);
+
+    for (i = 0; i < sizeof(raw) / sizeof(raw[0]); ++i)
+    {
+        TEST_ASSERT_DOUBLE_WITHIN(CACHED_TOLERANCE, reference_object(&calib, 22454, 23030, raw[i], raw[i]),
+                                  mlx90632_calc_temp_object_cached(&state, raw[i], raw[i]));
+    }
+    // old and new object raw values which differ in sum parity
+    TEST_ASSERT_DOUBLE_WITHIN(CACHED_TOLERANCE, reference_object(&calib, 22454, 23030, 609, 612),
+                              mlx90632_calc_temp_object_cached(&state, 609, 612));
+}
+
+void test_ambient_state_reused(void)
+{
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_ambient_state_update(&state, 22454, 23030, &calib));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_ambient_state_update(&state, 22454, 23030, &calib));
+
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_ambient_state_update(&state, 22455, 23030, &calib));
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_ambient_state_update(&state, 22455, 23031, &calib));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_ambient_state_update(&state, 22455, 23031, &calib));
+    TEST_ASSERT_DOUBLE_WITHIN(CACHED_TOLERANCE, reference_object(&calib, 22455, 23031, 609, 611),
+                              mlx90632_calc_temp_object_cached(&state, 609, 611));
+
+    mlx90632_ambient_state_invalidate(&state);
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_ambient_state_update(&state, 22455, 23031, &calib));
+}
+
+void test_ambient_state_emissivity_change(void)
+{
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_ambient_state_update(&state, 22454, 23030, &calib));
+
+    mlx90632_set_emissivity(0.8);
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_ambient_state_update(&state, 22454, 23030, &calib));
+    TEST_ASSERT_DOUBLE_WITHIN(CACHED_TOLERANCE, reference_object(&calib, 22454, 23030, 609, 611),
+                              mlx90632_calc_temp_object_cached(&state, 609, 611));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_ambient_state_update(&state, 22454, 23030, &calib));
+}
+
+void test_ambient_state_calibration_change(void)
+{
+    mlx90632_calib_t other = calib;
+
+    other.Ga = calib.Ga / 2;
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_ambient_state_update(&state, 22454, 23030, &calib));
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_ambient_state_update(&state, 22454, 23030, &other));
+    TEST_ASSERT_DOUBLE_WITHIN(CACHED_TOLERANCE, reference_object(&other, 22454, 23030, 609, 611),
+                              mlx90632_calc_temp_object_cached(&state, 609, 611));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_ambient_state_update(&state, 22454, 23030, &other));
+}
+
+///@}
@@ -0,0 +1,205 @@
+/**
+ * @file
+ * @brief Unit tests for raw reads over asynchronous i2c transfers with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+
+#include "mock_mlx90632_depends.h"
+
+#include "mlx90632_async.h"
+
+static mlx90632_async_t async;
+static mlx90632_async_t *done_async;
+static int32_t done_status;
+static int done_calls;
+static int context_mock;
+
+/** RAM word of register address in the buffer of a transfer starting at register first */
+#define RAM(first, address) async.ram[(address) - (first)]
+
+void setUp(void)
+{
+    memset(&async, 0, sizeof(async));
+    done_async = NULL;
+    done_status = 1;
+    done_calls = 0;
+}
+
+void tearDown(void)
+{
+}
+
+static void done(mlx90632_async_t *a, int32_t status)
+{
+    done_async = a;
+    done_status = status;
+    done_calls++;
+}
+
+/** Fill medical RAM as the backend would, channel 1 and 2 have different object values */
+static void fill_medical_ram(void)
+{
+    RAM(MLX90632_RAM_1(1), MLX90632_RAM_1(1)) = 150;
+    RAM(MLX90632_RAM_1(1), MLX90632_RAM_2(1)) = 152;
+    RAM(MLX90632_RAM_1(1), MLX90632_RAM_3(1)) = 22454;
+    RAM(MLX90632_RAM_1(1), MLX90632_RAM_1(2)) = 140;
+    RAM(MLX90632_RAM_1(1), MLX90632_RAM_2(2)) = 141;
+    RAM(MLX90632_RAM_1(1), MLX90632_RAM_3(2)) = 23030;
+}
+
+/** One transfer of all medical RAM is submitted and raw values are extracted only on completion */
+void test_read_temp_raw_wo_wait_async_success(void)
+{
+    mlx90632_i2c_submit_ExpectAndReturn(&async.xfer, 0);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_wo_wait_async(&async, 1, done, &context_mock));
+    TEST_ASSERT_EQUAL_HEX16(MLX90632_RAM_1(1), async.xfer.register_address);
+    TEST_ASSERT_EQUAL_UINT16(6, async.xfer.words);
+    TEST_ASSERT_EQUAL_UINT8(0, async.xfer.write);
+    TEST_ASSERT_EQUAL_PTR(async.ram, async.xfer.value);
+    TEST_ASSERT_EQUAL_PTR(&context_mock, async.context);
+    TEST_ASSERT_EQUAL_INT(0, done_calls);
+
+    fill_medical_ram();
+    async.xfer.status = 0;
+    async.xfer.complete(&async.xfer);
+
+    TEST_ASSERT_EQUAL_INT(1, done_calls);
+    TEST_ASSERT_EQUAL_PTR(&async, done_async);
+    TEST_ASSERT_EQUAL_INT32(0, done_status);
+    TEST_ASSERT_EQUAL_INT16(22454, async.ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(23030, async.ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT16(151, async.object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(140, async.object_old_raw);
+}
+
+void test_read_temp_raw_wo_wait_async_channel_2(void)
+{
+    mlx90632_i2c_submit_ExpectAndReturn(&async.xfer, 0);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_wo_wait_async(&async, 2, done, NULL));
+
+    fill_medical_ram();
+    async.xfer.complete(&async.xfer);
+
+    TEST_ASSERT_EQUAL_INT32(0, done_status);
+    TEST_ASSERT_EQUAL_INT16(22454, async.ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(23030, async.ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT16(140, async.object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(151, async.object_old_raw);
+}
+
+void test_read_temp_raw_wo_wait_async_errors(void)
+{
+    // invalid channel position is refused before anything is submitted
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_read_temp_raw_wo_wait_async(&async, 0, done, NULL));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_read_temp_raw_wo_wait_async(&async, 3, done, NULL));
+
+    // transfer which was not started never completes
+    mlx90632_i2c_submit_ExpectAndReturn(&async.xfer, -EBUSY);
+    TEST_ASSERT_EQUAL_INT32(-EBUSY, mlx90632_read_temp_raw_wo_wait_async(&async, 1, done, NULL));
+    TEST_ASSERT_EQUAL_INT(0, done_calls);
+
+    // transfer which failed on the bus completes with its status
+    mlx90632_i2c_submit_ExpectAndReturn(&async.xfer, 0);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_wo_wait_async(&async, 1, done, NULL));
+    async.xfer.status = -EIO;
+    async.xfer.complete(&async.xfer);
+    TEST_ASSERT_EQUAL_INT(1, done_calls);
+    TEST_ASSERT_EQUAL_INT32(-EIO, done_status);
+    TEST_ASSERT_EQUAL_INT16(0, async.ambient_new_raw);
+}
+
+static void expect_read(int16_t address, uint16_t *value)
+{
+    mlx90632_i2c_read_ExpectAndReturn(address, value, 0);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_ReturnThruPtr_value(value);
+}
+
+/** Expect blocking extended range read of the RAM words, in the order of mlx90632_read_temp_raw_extended_wo_wait */
+static void expect_read_extended_ram(uint16_t *ram)
+{
+    static const int16_t order[] = {
+        MLX90632_RAM_3(17), MLX90632_RAM_3(18), MLX90632_RAM_1(17), MLX90632_RAM_2(17),
+        MLX90632_RAM_1(18), MLX90632_RAM_2(18), MLX90632_RAM_1(19), MLX90632_RAM_2(19),
+    };
+    unsigned int i;
+
+    for (i = 0; i < sizeof(order) / sizeof(order[0]); ++i)
+        expect_read(order[i], &ram[order[i] - MLX90632_RAM_1(17)]);
+}
+
+/** Extended range values match the blocking read of the same RAM */
+void test_read_temp_raw_extended_wo_wait_async_success(void)
+{
+    static uint16_t ram[8] = { 0xFF9B, 0x0064, 0x57B6, 0x0032, 0x0028, 0x59F6, 0xFFE7, 0x0019 };
+    int16_t ambient_new_raw, ambient_old_raw, object_new_raw;
+
+    expect_read_extended_ram(ram);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_extended_wo_wait(&ambient_new_raw, &ambient_old_raw,
+                                                                       &object_new_raw));
+
+    mlx90632_i2c_submit_ExpectAndReturn(&async.xfer, 0);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_extended_wo_wait_async(&async, done, NULL));
+    TEST_ASSERT_EQUAL_HEX16(MLX90632_RAM_1(17), async.xfer.register_address);
+    TEST_ASSERT_EQUAL_UINT16(8, async.xfer.words);
+    TEST_ASSERT_EQUAL_INT32(19, async.channel_position);
+
+    memcpy(async.ram, ram, sizeof(ram));
+    async.xfer.complete(&async.xfer);
+
+    TEST_ASSERT_EQUAL_INT32(0, done_status);
+    TEST_ASSERT_EQUAL_INT16(22454, async.ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(ambient_new_raw, async.ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(ambient_old_raw, async.ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT16(-105, async.object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(object_new_raw, async.object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(0, async.object_old_raw);
+}
+
+/** Object value which does not fit in 16 bits fails like the blocking read */
+void test_read_temp_raw_extended_wo_wait_async_overflow(void)
+{
+    static uint16_t ram[8] = { 0x7FFF, 0x8000, 0x57B6, 0x8000, 0x7FFF, 0x59F6, 0x7FFF, 0x7FFF };
+
+    mlx90632_i2c_submit_ExpectAndReturn(&async.xfer, 0);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_extended_wo_wait_async(&async, done, NULL));
+
+    memcpy(async.ram, ram, sizeof(ram));
+    async.xfer.complete(&async.xfer);
+
+    TEST_ASSERT_EQUAL_INT(1, done_calls);
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, done_status);
+}
+
+///@}
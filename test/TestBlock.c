@@ -0,0 +1,238 @@
+/**
+ * @file
+ * @brief Unit tests for block reads of status register and medical RAM with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_sample.h"
+#include "mlx90632_block.h"
+
+#include "mock_mlx90632_depends.h"
+
+static mlx90632_sample_t sample;
+static int16_t ambient_new_mock = 22454;
+static int16_t ambient_old_mock = 23030;
+static int16_t object_new_mock = 150;
+static int16_t object_old_mock = 140;
+
+void setUp(void)
+{
+    memset(&sample, 0, sizeof(sample));
+}
+
+void tearDown(void)
+{
+}
+
+static void expect_read(int16_t address, uint16_t *value)
+{
+    mlx90632_i2c_read_ExpectAndReturn(address, value, 0);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_ReturnThruPtr_value(value);
+}
+
+static void assert_medical_raw(void)
+{
+    TEST_ASSERT_EQUAL_INT16(ambient_new_mock, sample.ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(ambient_old_mock, sample.ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT16(object_new_mock, sample.object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(object_old_mock, sample.object_old_raw);
+}
+
+#define BLOCK_WORDS 10 /**< Status register and RAM of both medical measurements */
+#define BLOCK(address) ((address) - MLX90632_REG_STATUS)
+
+/** Fill block of status register and medical RAM as the sensor returns it */
+static void fill_block(uint16_t *block, uint16_t status, int channel_new, int channel_old)
+{
+    memset(block, 0, BLOCK_WORDS * sizeof(*block));
+    block[0] = status;
+    block[BLOCK(MLX90632_RAM_3(1))] = (uint16_t)ambient_new_mock;
+    block[BLOCK(MLX90632_RAM_3(2))] = (uint16_t)ambient_old_mock;
+    block[BLOCK(MLX90632_RAM_1(channel_new))] = (uint16_t)object_new_mock;
+    block[BLOCK(MLX90632_RAM_2(channel_new))] = (uint16_t)object_new_mock;
+    block[BLOCK(MLX90632_RAM_1(channel_old))] = (uint16_t)object_old_mock;
+    block[BLOCK(MLX90632_RAM_2(channel_old))] = (uint16_t)object_old_mock;
+}
+
+static void expect_read_block(uint16_t *block)
+{
+    mlx90632_i2c_read_block_ExpectAndReturn(MLX90632_REG_STATUS, block, BLOCK_WORDS, 0);
+    mlx90632_i2c_read_block_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_block_ReturnArrayThruPtr_value(block, BLOCK_WORDS);
+}
+
+/** Expect block read which finds data ready, followed by clearing of data ready */
+static void expect_block_sample(uint16_t *block, uint64_t timestamp)
+{
+    expect_read_block(block);
+    mlx90632_get_time_us_ExpectAndReturn(timestamp);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, block[0] & ~MLX90632_STAT_DATA_RDY, 0);
+}
+
+/** One bus transaction reads status and both temperatures, one write clears data ready */
+void test_read_temp_raw_block_sample_success(void)
+{
+    static uint16_t block[BLOCK_WORDS];
+
+    fill_block(block, 0x0009, 2, 1);
+    expect_block_sample(block, 4321);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_block_sample(&sample));
+    assert_medical_raw();
+    TEST_ASSERT_EQUAL_UINT64(4321, sample.timestamp_us);
+    TEST_ASSERT_EQUAL_HEX16(0x0009, sample.status);
+    TEST_ASSERT_EQUAL_UINT8(2, sample.cycle_pos);
+    TEST_ASSERT_EQUAL_UINT8(MLX90632_MTYP_MEDICAL, sample.meas_type);
+
+    fill_block(block, 0x0005, 1, 2);
+    expect_block_sample(block, 5000);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_block_sample(&sample));
+    assert_medical_raw();
+    TEST_ASSERT_EQUAL_UINT8(1, sample.cycle_pos);
+}
+
+/** Block without data ready is discarded and nothing is written */
+void test_read_temp_raw_block_sample_not_ready(void)
+{
+    static uint16_t block[BLOCK_WORDS];
+
+    fill_block(block, 0x0008, 2, 1);
+    expect_read_block(block);
+
+    TEST_ASSERT_EQUAL_INT32(-EAGAIN, mlx90632_read_temp_raw_block_sample(&sample));
+    TEST_ASSERT_EQUAL_UINT64(0, sample.timestamp_us);
+    TEST_ASSERT_EQUAL_INT16(0, sample.ambient_new_raw);
+    TEST_ASSERT_EQUAL_HEX16(0, sample.status);
+}
+
+void test_read_temp_raw_block_sample_errors(void)
+{
+    static uint16_t block[BLOCK_WORDS];
+
+    mlx90632_i2c_read_block_ExpectAndReturn(MLX90632_REG_STATUS, block, BLOCK_WORDS, -EPERM);
+    mlx90632_i2c_read_block_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_read_temp_raw_block_sample(&sample));
+
+    // extended measurement table is running
+    fill_block(block, 0x004D, 2, 1);
+    expect_read_block(block);
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_read_temp_raw_block_sample(&sample));
+
+    fill_block(block, 0x0009, 2, 1);
+    expect_read_block(block);
+    mlx90632_get_time_us_ExpectAndReturn(1000);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0008, -EPERM);
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_read_temp_raw_block_sample(&sample));
+}
+
+/** Expect start of capture with both medical measurements at 64Hz - 15ms */
+static void expect_capture_start(void)
+{
+    static uint16_t reg_meas_mock = 0x870D;
+    static uint16_t reg_status_trigger = 0x0009;
+
+    expect_read(MLX90632_EE_MEDICAL_MEAS1, &reg_meas_mock);
+    expect_read(MLX90632_EE_MEDICAL_MEAS2, &reg_meas_mock);
+    expect_read(MLX90632_REG_STATUS, &reg_status_trigger);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0008, 0);
+}
+
+void test_capture_block_success(void)
+{
+    static uint16_t block_ch1[BLOCK_WORDS];
+    static uint16_t block_ch2[BLOCK_WORDS];
+    static uint16_t block_not_ready[BLOCK_WORDS];
+    mlx90632_sample_t buf[3];
+    mlx90632_capture_stats_t stats = { 5, 5 };
+
+    fill_block(block_ch1, 0x0005, 1, 2);
+    fill_block(block_ch2, 0x0009, 2, 1);
+    fill_block(block_not_ready, 0x0004, 1, 2);
+
+    expect_capture_start();
+    mlx90632_get_time_us_ExpectAndReturn(1000);
+    expect_block_sample(block_ch1, 1600);
+
+    // read 250us earlier than one cycle after the previous read comes too early and is retried
+    mlx90632_get_time_us_ExpectAndReturn(2000);
+    usleep_Expect(13750, 13950);
+    mlx90632_get_time_us_ExpectAndReturn(15750);
+    expect_read_block(block_not_ready);
+    usleep_Expect(200, 220);
+    mlx90632_get_time_us_ExpectAndReturn(16500);
+    expect_block_sample(block_ch2, 17000);
+
+    // schedule follows the retry, next read finds data ready
+    mlx90632_get_time_us_ExpectAndReturn(17500);
+    usleep_Expect(13750, 13950);
+    mlx90632_get_time_us_ExpectAndReturn(31250);
+    expect_block_sample(block_ch1, 31800);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_capture_block(buf, 3, &stats));
+    TEST_ASSERT_EQUAL_UINT32(0, stats.missed);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.duplicated);
+
+    TEST_ASSERT_EQUAL_UINT64(1600, buf[0].timestamp_us);
+    TEST_ASSERT_EQUAL_UINT8(1, buf[0].cycle_pos);
+    TEST_ASSERT_EQUAL_UINT64(17000, buf[1].timestamp_us);
+    TEST_ASSERT_EQUAL_UINT8(2, buf[1].cycle_pos);
+    TEST_ASSERT_EQUAL_HEX16(0x0005, buf[2].status);
+    TEST_ASSERT_EQUAL_UINT8(MLX90632_MTYP_MEDICAL, buf[2].meas_type);
+    TEST_ASSERT_EQUAL_INT16(object_new_mock, buf[2].object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(object_old_mock, buf[2].object_old_raw);
+}
+
+void test_capture_block_timeout(void)
+{
+    static uint16_t block_not_ready[BLOCK_WORDS];
+    mlx90632_sample_t buf[1];
+    mlx90632_capture_stats_t stats;
+    uint64_t t;
+
+    fill_block(block_not_ready, 0x0004, 1, 2);
+
+    expect_capture_start();
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    // retrying gives up after two full cycles
+    for (t = 0; t < 40000; t += 10000)
+    {
+        expect_read_block(block_not_ready);
+        usleep_Expect(200, 220);
+        mlx90632_get_time_us_ExpectAndReturn(t + 10000);
+    }
+    expect_read_block(block_not_ready);
+
+    TEST_ASSERT_EQUAL_INT32(-ETIMEDOUT, mlx90632_capture_block(buf, 1, &stats));
+}
+
+///@}
@@ -0,0 +1,324 @@
+/**
+ * @file
+ * @brief Unit tests for duty-cycled burst scheduler with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_burst_sched.h"
+
+#include "mock_mlx90632_depends.h"
+
+// Pointers should point here
+int16_t ambient_new_raw = 0;
+int16_t ambient_old_raw = 0;
+int16_t object_new_raw = 0;
+int16_t object_old_raw = 0;
+uint64_t wakeup = 0;
+
+static mlx90632_burst_sched_t sched;
+static uint16_t reg_ctrl_mock = 0x0802; // medical sleeping step meas selected & stale SOB
+static uint16_t meas1_mock = 0x820D; // 500ms
+static uint16_t meas2_mock = 0x821D; // 500ms
+
+void setUp(void)
+{
+    ambient_new_raw = 0;
+    ambient_old_raw = 0;
+    object_new_raw = 0;
+    object_old_raw = 0;
+    wakeup = 0;
+    reg_ctrl_mock = 0x0802;
+}
+
+void tearDown(void)
+{
+}
+
+static void expect_read(int16_t address, uint16_t *value)
+{
+    mlx90632_i2c_read_ExpectAndReturn(address, value, 0);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_ReturnThruPtr_value(value);
+}
+
+static void expect_sched_init(uint64_t now)
+{
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock); // get meas type
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock); // dataset ready time
+    expect_read(MLX90632_EE_MEDICAL_MEAS1, &meas1_mock);
+    expect_read(MLX90632_EE_MEDICAL_MEAS2, &meas2_mock);
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    mlx90632_get_time_us_ExpectAndReturn(now);
+}
+
+void test_burst_sched_init_success(void)
+{
+    expect_sched_init(5000);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_init(&sched, 10000));
+    TEST_ASSERT_EQUAL_UINT32(1000000, sched.dataset_time_us);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, sched.reg_ctrl);
+    TEST_ASSERT_EQUAL_UINT64(5000, sched.next_trigger_us);
+    TEST_ASSERT_EQUAL_UINT64(10000000, sched.period_us);
+}
+
+void test_burst_sched_init_continuous(void)
+{
+    reg_ctrl_mock = 0x0006; // medical continuous
+
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_burst_sched_init(&sched, 10000));
+}
+
+void test_burst_sched_init_period_too_short(void)
+{
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    expect_read(MLX90632_EE_MEDICAL_MEAS1, &meas1_mock);
+    expect_read(MLX90632_EE_MEDICAL_MEAS2, &meas2_mock);
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_burst_sched_init(&sched, 999));
+}
+
+/** Full sample cycle: trigger, early wake-up, busy sensor, read and next trigger */
+void test_burst_sched_run_cycle(void)
+{
+    static uint16_t status_busy = 0x0400;
+    static uint16_t status_done = 0x010B;
+    static int16_t ambient_new_mock = 22454;
+    static int16_t ambient_old_mock = 23030;
+    static int16_t object_new_mock = 150;
+    static int16_t object_old_mock = 140;
+
+    expect_sched_init(0);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_init(&sched, 10000));
+
+    // Trigger is single write of cached control register
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, 0x0002 | MLX90632_START_BURST_MEAS, 0);
+    mlx90632_get_time_us_ExpectAndReturn(100);
+    mlx90632_get_time_us_ExpectAndReturn(110);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT64(1000100, wakeup);
+
+    // Woken up too early - no bus access
+    mlx90632_get_time_us_ExpectAndReturn(500000);
+    mlx90632_get_time_us_ExpectAndReturn(500010);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT64(1000100, wakeup);
+
+    // Sensor still busy
+    mlx90632_get_time_us_ExpectAndReturn(1000100);
+    mlx90632_get_time_us_ExpectAndReturn(1000100);
+    expect_read(MLX90632_REG_STATUS, &status_busy);
+    mlx90632_get_time_us_ExpectAndReturn(1000200);
+    mlx90632_get_time_us_ExpectAndReturn(1000210);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT64(1000100 + MLX90632_BURST_SCHED_POLL_TIME, wakeup);
+
+    // Data is read with one status and six RAM reads
+    mlx90632_get_time_us_ExpectAndReturn(1001100);
+    mlx90632_get_time_us_ExpectAndReturn(1001110);
+    expect_read(MLX90632_REG_STATUS, &status_done);
+    expect_read(MLX90632_RAM_3(1), (uint16_t *)&ambient_new_mock);
+    expect_read(MLX90632_RAM_3(2), (uint16_t *)&ambient_old_mock);
+    expect_read(MLX90632_RAM_2(2), (uint16_t *)&object_new_mock);
+    expect_read(MLX90632_RAM_1(2), (uint16_t *)&object_new_mock);
+    expect_read(MLX90632_RAM_2(1), (uint16_t *)&object_old_mock);
+    expect_read(MLX90632_RAM_1(1), (uint16_t *)&object_old_mock);
+    mlx90632_get_time_us_ExpectAndReturn(1001710);
+    mlx90632_get_time_us_ExpectAndReturn(1001720);
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT64(10000000, wakeup);
+    TEST_ASSERT_EQUAL_INT16(ambient_new_mock, ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(ambient_old_mock, ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT16(object_new_mock, object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(object_old_mock, object_old_raw);
+    // Bus time only covers the register accesses, CPU time the whole calls
+    TEST_ASSERT_EQUAL_UINT32(100 + 100 + 600, sched.last_bus_time_us);
+    TEST_ASSERT_EQUAL_UINT32(110 + 10 + 110 + 620, sched.last_cpu_time_us);
+
+    // Next trigger is not due yet
+    mlx90632_get_time_us_ExpectAndReturn(9000000);
+    mlx90632_get_time_us_ExpectAndReturn(9000010);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT64(10000000, wakeup);
+}
+
+/** Host woke up much later than next trigger time, missed periods are skipped */
+void test_burst_sched_run_late(void)
+{
+    expect_sched_init(0);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_init(&sched, 2000));
+
+    mlx90632_get_time_us_ExpectAndReturn(7500000);
+    mlx90632_get_time_us_ExpectAndReturn(7500000);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, 0x0002 | MLX90632_START_BURST_MEAS, 0);
+    mlx90632_get_time_us_ExpectAndReturn(7500100);
+    mlx90632_get_time_us_ExpectAndReturn(7500110);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT64(8500100, wakeup);
+    TEST_ASSERT_EQUAL_UINT64(9500000, sched.next_trigger_us);
+}
+
+/** Extended burst reads extended measurement table */
+void test_burst_sched_run_extended(void)
+{
+    static uint16_t status_done = 0x014F;
+    static int16_t ram_mock[8] = { 22454, 23030, 150, 140, 148, 142, 147, 143 };
+
+    reg_ctrl_mock = 0x0112; // extended sleeping step meas selected
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    expect_read(MLX90632_EE_EXTENDED_MEAS1, &meas1_mock);
+    expect_read(MLX90632_EE_EXTENDED_MEAS2, &meas1_mock);
+    expect_read(MLX90632_EE_EXTENDED_MEAS3, &meas1_mock);
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_init(&sched, 2000));
+    TEST_ASSERT_EQUAL_UINT32(1500000, sched.dataset_time_us);
+
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, 0x0112 | MLX90632_START_BURST_MEAS, 0);
+    mlx90632_get_time_us_ExpectAndReturn(100);
+    mlx90632_get_time_us_ExpectAndReturn(110);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+
+    mlx90632_get_time_us_ExpectAndReturn(1500100);
+    mlx90632_get_time_us_ExpectAndReturn(1500100);
+    expect_read(MLX90632_REG_STATUS, &status_done);
+    expect_read(MLX90632_RAM_3(17), (uint16_t *)&ram_mock[0]);
+    expect_read(MLX90632_RAM_3(18), (uint16_t *)&ram_mock[1]);
+    expect_read(MLX90632_RAM_1(17), (uint16_t *)&ram_mock[2]);
+    expect_read(MLX90632_RAM_2(17), (uint16_t *)&ram_mock[3]);
+    expect_read(MLX90632_RAM_1(18), (uint16_t *)&ram_mock[4]);
+    expect_read(MLX90632_RAM_2(18), (uint16_t *)&ram_mock[5]);
+    expect_read(MLX90632_RAM_1(19), (uint16_t *)&ram_mock[6]);
+    expect_read(MLX90632_RAM_2(19), (uint16_t *)&ram_mock[7]);
+    mlx90632_get_time_us_ExpectAndReturn(1500900);
+    mlx90632_get_time_us_ExpectAndReturn(1500910);
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_INT16(22454, ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(23030, ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT16(((150 - 140 - 148 + 142) / 2) + 147 + 143, object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(0, object_old_raw);
+}
+
+/** Errors on trigger and read are returned and sample stays pending */
+void test_burst_sched_run_errors(void)
+{
+    static uint16_t status_done = 0x010B;
+
+    expect_sched_init(0);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_init(&sched, 10000));
+
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, 0x0002 | MLX90632_START_BURST_MEAS, -EPERM);
+    mlx90632_get_time_us_ExpectAndReturn(100);
+    mlx90632_get_time_us_ExpectAndReturn(110);
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                             &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT64(0, wakeup);
+
+    mlx90632_get_time_us_ExpectAndReturn(200);
+    mlx90632_get_time_us_ExpectAndReturn(200);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, 0x0002 | MLX90632_START_BURST_MEAS, 0);
+    mlx90632_get_time_us_ExpectAndReturn(300);
+    mlx90632_get_time_us_ExpectAndReturn(310);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+
+    mlx90632_get_time_us_ExpectAndReturn(1000300);
+    mlx90632_get_time_us_ExpectAndReturn(1000300);
+    expect_read(MLX90632_REG_STATUS, &status_done);
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_RAM_3(1), &status_done, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_get_time_us_ExpectAndReturn(1000400);
+    mlx90632_get_time_us_ExpectAndReturn(1000410);
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                             &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT8(1, sched.pending);
+    TEST_ASSERT_EQUAL_UINT64(1000300 + MLX90632_BURST_SCHED_POLL_TIME, wakeup);
+}
+
+/** Sensor stays busy for one dataset time after ready time, burst is dropped */
+void test_burst_sched_run_timeout(void)
+{
+    static uint16_t status_busy = 0x0400;
+
+    expect_sched_init(0);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_init(&sched, 10000));
+
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, 0x0002 | MLX90632_START_BURST_MEAS, 0);
+    mlx90632_get_time_us_ExpectAndReturn(100);
+    mlx90632_get_time_us_ExpectAndReturn(110);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT64(1000100, wakeup);
+
+    // Last retry before the limit
+    mlx90632_get_time_us_ExpectAndReturn(2000000);
+    mlx90632_get_time_us_ExpectAndReturn(2000000);
+    expect_read(MLX90632_REG_STATUS, &status_busy);
+    mlx90632_get_time_us_ExpectAndReturn(2000100);
+    mlx90632_get_time_us_ExpectAndReturn(2000110);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                        &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT64(2000000 + MLX90632_BURST_SCHED_POLL_TIME, wakeup);
+
+    mlx90632_get_time_us_ExpectAndReturn(2001000);
+    mlx90632_get_time_us_ExpectAndReturn(2001000);
+    expect_read(MLX90632_REG_STATUS, &status_busy);
+    mlx90632_get_time_us_ExpectAndReturn(2001100);
+    mlx90632_get_time_us_ExpectAndReturn(2001110);
+    TEST_ASSERT_EQUAL_INT32(-ETIMEDOUT, mlx90632_burst_sched_run(&sched, &ambient_new_raw, &ambient_old_raw,
+                                                                 &object_new_raw, &object_old_raw, &wakeup));
+    TEST_ASSERT_EQUAL_UINT8(0, sched.pending);
+    TEST_ASSERT_EQUAL_UINT32(0, sched.bus_time_us);
+    TEST_ASSERT_EQUAL_UINT32(0, sched.cpu_time_us);
+    TEST_ASSERT_EQUAL_UINT64(10000000, wakeup);
+}
+
+///@}
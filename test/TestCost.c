@@ -0,0 +1,184 @@
+/**
+ * @file
+ * @brief Unit tests for bus cost model of the acquisition functions with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+
+#include "mock_mlx90632_depends.h"
+
+#include "mlx90632_cost.h"
+
+/** Bus with round transaction times: read 200 us, write 100 us, poll every 10 ms */
+static const mlx90632_cost_bus_t bus = { 200, 100, 10000 };
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_cost_bus_init(void)
+{
+    mlx90632_cost_bus_t b;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_bus_init(&b, 400000, 0));
+    TEST_ASSERT_EQUAL_UINT32(143, b.read_us); // 57 bits of 2.5 us, rounded up
+    TEST_ASSERT_EQUAL_UINT32(118, b.write_us);
+    TEST_ASSERT_EQUAL_UINT32(MLX90632_COST_POLL_US, b.poll_us);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_bus_init(&b, 100000, 50));
+    TEST_ASSERT_EQUAL_UINT32(620, b.read_us);
+    TEST_ASSERT_EQUAL_UINT32(520, b.write_us);
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_cost_bus_init(&b, 0, 0));
+}
+
+static void expect_read(int16_t address, uint16_t *value)
+{
+    mlx90632_i2c_read_ExpectAndReturn(address, value, 0);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_ReturnThruPtr_value(value);
+}
+
+/** Measurement times come from the table the function uses */
+void test_cost_sensor_read(void)
+{
+    uint16_t meas[3] = {
+        0x8045 | MLX90632_REFRESH_RATE_STATUS(MLX90632_MEAS_HZ_8),
+        0x8045 | MLX90632_REFRESH_RATE_STATUS(MLX90632_MEAS_HZ_4),
+        0x8045 | MLX90632_REFRESH_RATE_STATUS(MLX90632_MEAS_HZ_2),
+    };
+    mlx90632_cost_sensor_t sensor;
+
+    expect_read(MLX90632_EE_EXTENDED_MEAS1, &meas[0]);
+    expect_read(MLX90632_EE_EXTENDED_MEAS2, &meas[1]);
+    expect_read(MLX90632_EE_EXTENDED_MEAS3, &meas[2]);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_sensor_read(&sensor, MLX90632_COST_RAW_EXTENDED_BURST));
+    TEST_ASSERT_EQUAL_INT(MLX90632_COST_RAW_EXTENDED_BURST, sensor.api);
+    TEST_ASSERT_EQUAL_UINT8(3, sensor.meas_count);
+    TEST_ASSERT_EQUAL_UINT16(125, sensor.meas_time_ms[0]);
+    TEST_ASSERT_EQUAL_UINT16(250, sensor.meas_time_ms[1]);
+    TEST_ASSERT_EQUAL_UINT16(500, sensor.meas_time_ms[2]);
+
+    expect_read(MLX90632_EE_MEDICAL_MEAS1, &meas[0]);
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_EE_MEDICAL_MEAS2, &meas[1], -EIO);
+    mlx90632_i2c_read_IgnoreArg_value();
+    TEST_ASSERT_EQUAL_INT32(-EIO, mlx90632_cost_sensor_read(&sensor, MLX90632_COST_SINGLE));
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_cost_sensor_read(&sensor, MLX90632_COST_APIS));
+}
+
+/** Burst sleeps for the whole table, so the sample takes table time plus its fixed transactions */
+void test_cost_predict_burst(void)
+{
+    mlx90632_cost_sensor_t sensor;
+    mlx90632_cost_t cost;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_sensor_init(&sensor, MLX90632_COST_RAW_BURST, MLX90632_MEAS_HZ_16));
+    TEST_ASSERT_EQUAL_UINT16(62, sensor.meas_time_ms[0]);
+    TEST_ASSERT_EQUAL_UINT16(0, sensor.meas_time_ms[2]);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_predict(&bus, &sensor, &cost));
+    TEST_ASSERT_EQUAL_DOUBLE(11.0, cost.reads);
+    TEST_ASSERT_EQUAL_DOUBLE(1.0, cost.writes);
+    TEST_ASSERT_EQUAL_DOUBLE(2300.0, cost.bus_us);
+    TEST_ASSERT_EQUAL_DOUBLE(1e6 / (124000.0 + 2300.0), cost.samples_per_s);
+    // control and table reads overlap the measurement, status and RAM reads follow it
+    TEST_ASSERT_EQUAL_DOUBLE(2000.0, cost.latency_us);
+}
+
+/** Continuous functions catch every measurement, time left over from fixed transactions is spent polling */
+void test_cost_predict_raw(void)
+{
+    mlx90632_cost_sensor_t sensor;
+    mlx90632_cost_t cost;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_sensor_init(&sensor, MLX90632_COST_RAW, MLX90632_MEAS_HZ_16));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_predict(&bus, &sensor, &cost));
+
+    // 124 ms table with 14 reads and 2 writes leaves 121 ms, 2 waits of 10.2 ms poll steps
+    TEST_ASSERT_EQUAL_DOUBLE((14.0 + (121000.0 + 20000.0) / 10200.0) / 2, cost.reads);
+    TEST_ASSERT_EQUAL_DOUBLE(1.0, cost.writes);
+    TEST_ASSERT_EQUAL_DOUBLE(1e6 / 62000.0, cost.samples_per_s);
+    TEST_ASSERT_EQUAL_DOUBLE(6 * 200.0 + 10200.0 / 2, cost.latency_us);
+
+    // bus slower than the sensor: every wait is a single status read
+    {
+        const mlx90632_cost_bus_t slow = { 20000, 20000, 10000 };
+
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_predict(&slow, &sensor, &cost));
+        TEST_ASSERT_EQUAL_DOUBLE(8.0, cost.reads);
+        TEST_ASSERT_EQUAL_DOUBLE(1e6 / 180000.0, cost.samples_per_s);
+    }
+
+    sensor.meas_count = 3;
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_cost_predict(&bus, &sensor, &cost));
+}
+
+void test_cost_plan(void)
+{
+    mlx90632_cost_sensor_t sensors[2];
+    mlx90632_cost_t costs[2];
+    mlx90632_cost_plan_t plan;
+    double share;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_sensor_init(&sensors[0], MLX90632_COST_SINGLE, MLX90632_MEAS_HZ_16));
+    sensors[1] = sensors[0];
+
+    // single: 4 reads and 2 writes per 62 ms sample
+    share = 1000.0 / 63000.0;
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_plan(&bus, sensors, 2, costs, &plan));
+    TEST_ASSERT_EQUAL_DOUBLE(2 * share, plan.utilisation);
+    TEST_ASSERT_EQUAL_UINT8(1, plan.feasible);
+    TEST_ASSERT_EQUAL_DOUBLE(2e6 / 63000.0, plan.samples_per_s);
+    // 4 reads after measurement, each may wait for half a transaction of the other sensor
+    TEST_ASSERT_EQUAL_DOUBLE(800.0 + 4 * share * 100.0, costs[0].latency_us);
+    TEST_ASSERT_EQUAL_DOUBLE(costs[0].latency_us, plan.latency_us);
+
+    // bus which cannot keep up shares its time between the sensors
+    {
+        const mlx90632_cost_bus_t slow = { 20000, 20000, 10000 };
+
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_cost_plan(&slow, sensors, 2, costs, &plan));
+        TEST_ASSERT_EQUAL_UINT8(0, plan.feasible);
+        TEST_ASSERT_TRUE(plan.utilisation > 1.0);
+        TEST_ASSERT_EQUAL_DOUBLE(1e6 / 120000.0, plan.samples_per_s);
+    }
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_cost_plan(&bus, sensors, 0, costs, &plan));
+    sensors[1].api = MLX90632_COST_APIS;
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_cost_plan(&bus, sensors, 2, costs, &plan));
+}
+
+///@}
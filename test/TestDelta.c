@@ -0,0 +1,159 @@
+/**
+ * @file
+ * @brief Unit tests for delta and varint encoding of temperature streams
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+
+#include "unity.h"
+#include "mlx90632_delta.h"
+
+static uint8_t buf[256];
+static mlx90632_delta_t encoder, decoder;
+
+void setUp(void)
+{
+    memset(buf, 0, sizeof(buf));
+    mlx90632_delta_init(&encoder, buf, sizeof(buf));
+}
+
+void tearDown(void)
+{
+}
+
+static void expect_sample(uint64_t timestamp_us, double ambient, double object)
+{
+    uint64_t t;
+    double a, o;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_get(&decoder, &t, &a, &o));
+    TEST_ASSERT_EQUAL_UINT64(timestamp_us, t);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, ambient, a);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, object, o);
+}
+
+void test_delta_roundtrip(void)
+{
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 1000000, 24.5004, 36.6996));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 1500000, 24.501, 36.652));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 2000003, 24.499, 36.901));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 2499998, -12.25, 110.0));
+
+    mlx90632_delta_init(&decoder, buf, encoder.pos);
+    expect_sample(1000000, 24.5, 36.7);
+    expect_sample(1500000, 24.501, 36.652);
+    expect_sample(2000003, 24.499, 36.901);
+    expect_sample(2499998, -12.25, 110.0);
+    TEST_ASSERT_EQUAL_INT32(-ENODATA, mlx90632_delta_get(&decoder, NULL, NULL, NULL));
+    TEST_ASSERT_EQUAL_UINT32(encoder.pos, decoder.pos);
+}
+
+/** Fixed rate and slowly changing temperatures take one byte per field */
+void test_delta_steady_stream_size(void)
+{
+    uint32_t i;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 0, 25.0, 36.0));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 500000, 25.0, 36.0));
+    encoder.pos = 0;
+    for (i = 2; i < 50; ++i)
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, i * 500000, 25.0 + 0.001 * (i % 3),
+                                                      36.0 - 0.01 * (i % 5)));
+    TEST_ASSERT_EQUAL_UINT32(48 * 3, encoder.pos);
+}
+
+void test_delta_blocks(void)
+{
+    uint32_t second;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_block(&encoder, 1000));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 1000, 25.0, 36.0));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 2000, 25.1, 36.1));
+    second = encoder.pos;
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_block(&encoder, 3000));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 3000, 25.2, 36.2));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 4000, 25.3, 36.3));
+
+    // whole stream
+    mlx90632_delta_init(&decoder, buf, encoder.pos);
+    expect_sample(1000, 25.0, 36.0);
+    expect_sample(2000, 25.1, 36.1);
+    expect_sample(3000, 25.2, 36.2);
+    expect_sample(4000, 25.3, 36.3);
+
+    // second block alone, as if the first one was lost
+    mlx90632_delta_init(&decoder, buf + second, encoder.pos - second);
+    expect_sample(3000, 25.2, 36.2);
+    expect_sample(4000, 25.3, 36.3);
+    TEST_ASSERT_EQUAL_INT32(-ENODATA, mlx90632_delta_get(&decoder, NULL, NULL, NULL));
+}
+
+void test_delta_extremes(void)
+{
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, UINT64_MAX, -2147483.0, 2147483.0));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 0, 2147483.0, -2147483.0));
+
+    mlx90632_delta_init(&decoder, buf, encoder.pos);
+    expect_sample(UINT64_MAX, -2147483.0, 2147483.0);
+    expect_sample(0, 2147483.0, -2147483.0);
+}
+
+void test_delta_put_errors(void)
+{
+    mlx90632_delta_init(&encoder, buf, 4);
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_delta_put(&encoder, 0, NAN, 36.0));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_delta_put(&encoder, 0, 25.0, 3e6));
+    TEST_ASSERT_EQUAL_INT32(-ENOBUFS, mlx90632_delta_put(&encoder, 0, 25.0, 36.0));
+    TEST_ASSERT_EQUAL_INT32(-ENOBUFS, mlx90632_delta_block(&encoder, 100000000));
+    TEST_ASSERT_EQUAL_UINT32(0, encoder.pos);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 0, 0.0, 0.001));
+    TEST_ASSERT_EQUAL_UINT32(3, encoder.pos);
+}
+
+void test_delta_get_errors(void)
+{
+    static uint8_t overlong[] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x00 };
+    static uint8_t odd_tag[] = { 0x03, 0x00, 0x00 };
+    uint64_t t;
+    double a, o;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_delta_put(&encoder, 1000, 25.0, 36.0));
+
+    // truncated in the middle of the record does not consume it
+    mlx90632_delta_init(&decoder, buf, encoder.pos - 1);
+    TEST_ASSERT_EQUAL_INT32(-EBADMSG, mlx90632_delta_get(&decoder, &t, &a, &o));
+    TEST_ASSERT_EQUAL_UINT32(0, decoder.pos);
+
+    mlx90632_delta_init(&decoder, overlong, sizeof(overlong));
+    TEST_ASSERT_EQUAL_INT32(-EBADMSG, mlx90632_delta_get(&decoder, &t, &a, &o));
+    mlx90632_delta_init(&decoder, odd_tag, sizeof(odd_tag));
+    TEST_ASSERT_EQUAL_INT32(-EBADMSG, mlx90632_delta_get(&decoder, &t, &a, &o));
+}
+
+///@}
@@ -0,0 +1,208 @@
+/**
+ * @file
+ * @brief Unit tests for object temperature under several emissivities
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_emissivity.h"
+#include "calib_fixture.h"
+
+#include "mock_mlx90632_depends.h"
+
+static mlx90632_calib_t calib = CALIB_FIXTURE;
+
+/** Rounding difference of the reordered calculations */
+#define EMISSIVITY_TOLERANCE 1e-9
+
+static double reference_object(int16_t ambient_new_raw, int16_t ambient_old_raw,
+                               int16_t object_new_raw, int16_t object_old_raw)
+{
+    double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib.Gb);
+    double pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                        ambient_new_raw, ambient_old_raw, calib.Ka);
+
+    return mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient, calib.Ea, calib.Eb, calib.Ga,
+                                     calib.Fa, calib.Fb, calib.Ha, calib.Hb);
+}
+
+void setUp(void)
+{
+    mlx90632_set_emissivity(1.0);
+}
+
+void tearDown(void)
+{
+}
+
+void test_emissivities_match_reference(void)
+{
+    static const double emissivity[] = { 1.0, 0.95, 0.9, 0.7, 0.5, 0.3, 0.1 };
+    static const int16_t raw[] = { 609, 149, -149, 26901 };
+    double object[sizeof(emissivity) / sizeof(emissivity[0])];
+    uint8_t r, c;
+
+    for (r = 0; r < sizeof(raw) / sizeof(raw[0]); ++r)
+    {
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_calc_temp_object_emissivities(&calib, 22454, 23030, raw[r], raw[r] + 2,
+                                                                          emissivity, object,
+                                                                          sizeof(emissivity) /
+                                                                          sizeof(emissivity[0])));
+        for (c = 0; c < sizeof(emissivity) / sizeof(emissivity[0]); ++c)
+        {
+            mlx90632_set_emissivity(emissivity[c]);
+            TEST_ASSERT_DOUBLE_WITHIN(EMISSIVITY_TOLERANCE, reference_object(22454, 23030, raw[r], raw[r] + 2),
+                                      object[c]);
+        }
+        mlx90632_set_emissivity(1.0);
+    }
+}
+
+void test_emissivities_keep_global(void)
+{
+    static const double emissivity[] = { 0.5, 0.6 };
+    double object[2];
+
+    mlx90632_set_emissivity(0.8);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_calc_temp_object_emissivities(&calib, 22454, 23030, 609, 611,
+                                                                      emissivity, object, 2));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.8, mlx90632_get_emissivity());
+}
+
+void test_emissivities_invalid(void)
+{
+    static const double emissivity[] = { 0.9, 0.0 };
+    double object[2];
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_calc_temp_object_emissivities(&calib, 22454, 23030, 609, 611,
+                                                                            emissivity, object, 2));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_calc_temp_object_emissivities(&calib, 22454, 23030, 609, 611,
+                                                                      emissivity, object, 0));
+}
+
+/** Build dataset of samples and temperatures calculated with emissivity and optional reflected temperature */
+static void fit_dataset(mlx90632_emissivity_fit_t *fit, double emissivity, const double *reflected,
+                        int16_t first, int16_t last, int16_t step)
+{
+    int32_t raw;
+
+    mlx90632_set_emissivity(emissivity);
+    for (raw = first; raw <= last; raw += step)
+    {
+        int16_t ambient_new_raw = (int16_t)(22454 + raw % 7), ambient_old_raw = 23030;
+        double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib.Gb);
+        double pre_object = mlx90632_preprocess_temp_object((int16_t)raw, (int16_t)raw,
+                                                            ambient_new_raw, ambient_old_raw, calib.Ka);
+        double reference;
+
+        if (reflected == NULL)
+            reference = mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient, calib.Ea, calib.Eb,
+                                                  calib.Ga, calib.Fa, calib.Fb, calib.Ha, calib.Hb);
+        else
+            reference = mlx90632_calc_temp_object_reflected((int32_t)pre_object, (int32_t)pre_ambient, *reflected,
+                                                            calib.Ea, calib.Eb, calib.Ga, calib.Fa, calib.Fb,
+                                                            calib.Ha, calib.Hb);
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_emissivity_fit_add(fit, &calib, ambient_new_raw, ambient_old_raw,
+                                                               (int16_t)raw, (int16_t)raw, reference));
+    }
+    mlx90632_set_emissivity(1.0);
+}
+
+void test_emissivity_fit_die(void)
+{
+    mlx90632_emissivity_fit_t fit;
+    double emissivity;
+
+    mlx90632_emissivity_fit_init(&fit);
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_emissivity_fit_solve(&fit, &emissivity));
+
+    fit_dataset(&fit, 0.87, NULL, -2000, 8000, 250);
+    TEST_ASSERT_EQUAL_UINT32(41, fit.samples);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_emissivity_fit_solve(&fit, &emissivity));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, 0.87, emissivity);
+}
+
+void test_emissivity_fit_with_reflected(void)
+{
+    mlx90632_emissivity_fit_t fit;
+    double reflected = 35.0;
+    double emissivity;
+
+    mlx90632_emissivity_fit_init(&fit);
+    fit_dataset(&fit, 0.6, &reflected, -2000, 8000, 250);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_emissivity_fit_solve_with_reflected(&fit, reflected, &emissivity));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, 0.6, emissivity);
+}
+
+void test_emissivity_fit_reflected(void)
+{
+    mlx90632_emissivity_fit_t fit;
+    double reflected = 35.0;
+    double emissivity, fitted_reflected;
+
+    mlx90632_emissivity_fit_init(&fit);
+    fit_dataset(&fit, 0.6, &reflected, -2000, 8000, 250);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_emissivity_fit_solve_reflected(&fit, &emissivity, &fitted_reflected));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 0.6, emissivity);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, 35.0, fitted_reflected);
+}
+
+void test_emissivity_fit_merge(void)
+{
+    mlx90632_emissivity_fit_t fit, part;
+    double reflected = 10.0;
+    double emissivity, fitted_reflected;
+
+    mlx90632_emissivity_fit_init(&fit);
+    mlx90632_emissivity_fit_init(&part);
+    fit_dataset(&fit, 0.75, &reflected, -2000, 3000, 250);
+    fit_dataset(&part, 0.75, &reflected, 3250, 8000, 250);
+    mlx90632_emissivity_fit_merge(&fit, &part);
+    TEST_ASSERT_EQUAL_UINT32(41, fit.samples);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_emissivity_fit_solve_reflected(&fit, &emissivity, &fitted_reflected));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 0.75, emissivity);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, 10.0, fitted_reflected);
+}
+
+void test_emissivity_fit_invalid(void)
+{
+    mlx90632_emissivity_fit_t fit;
+    double emissivity, reflected;
+
+    mlx90632_emissivity_fit_init(&fit);
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_emissivity_fit_add(&fit, &calib, 22454, 23030, 609, 611, -300.0));
+    TEST_ASSERT_EQUAL_UINT32(0, fit.samples);
+
+    // one reference temperature does not determine reflected temperature
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_emissivity_fit_add(&fit, &calib, 22454, 23030, 609, 611, 55.0));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_emissivity_fit_solve_reflected(&fit, &emissivity, &reflected));
+}
+
+///@}
@@ -0,0 +1,221 @@
+/**
+ * @file
+ * @brief Unit tests for timerfd and epoll integration with fake i2c-dev transfer function
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+
+#include "unity.h"
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_i2c_dev.h"
+#include "mlx90632_epoll.h"
+#include "calib_fixture.h"
+
+#define FAKE_FD 42
+
+static const mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static mlx90632_i2c_dev_t dev;
+static mlx90632_epoll_sensor_t sensor;
+static int epoll_fd;
+static uint16_t fake_status;
+static uint16_t fake_status_written;
+static uint32_t callbacks;
+static int32_t callback_status;
+static double callback_ambient, callback_object;
+
+/* Only used by blocking library functions, which are not called here */
+void msleep(int msecs)
+{
+    (void)msecs;
+}
+
+/** Fake sensor registers with both medical measurements at 64Hz - 15ms */
+static uint16_t fake_register(uint16_t address)
+{
+    switch (address)
+    {
+        case MLX90632_EE_MEDICAL_MEAS1: return 0x870D;
+        case MLX90632_EE_MEDICAL_MEAS2: return 0x871D;
+        case MLX90632_REG_STATUS: return fake_status;
+        case MLX90632_RAM_1(1): return 609;
+        case MLX90632_RAM_2(1): return 609;
+        case MLX90632_RAM_3(1): return 22454;
+        case MLX90632_RAM_1(2): return 611;
+        case MLX90632_RAM_2(2): return 611;
+        case MLX90632_RAM_3(2): return 23030;
+        default: return 0;
+    }
+}
+
+/** Transfer function which answers single register reads and records status writes */
+static int32_t fake_transfer(int fd, struct i2c_rdwr_ioctl_data *data)
+{
+    uint16_t address = (uint16_t)((data->msgs[0].buf[0] << 8) | data->msgs[0].buf[1]);
+    uint16_t value;
+
+    TEST_ASSERT_EQUAL_INT(FAKE_FD, fd);
+
+    if (data->nmsgs == 1)
+    {
+        TEST_ASSERT_EQUAL_HEX16(MLX90632_REG_STATUS, address);
+        fake_status_written = (uint16_t)((data->msgs[0].buf[2] << 8) | data->msgs[0].buf[3]);
+        return 0;
+    }
+
+    value = fake_register(address);
+    data->msgs[1].buf[0] = (uint8_t)(value >> 8);
+    data->msgs[1].buf[1] = (uint8_t)value;
+    return 0;
+}
+
+static void callback(mlx90632_epoll_sensor_t *s, int32_t status, double ambient, double object)
+{
+    TEST_ASSERT_EQUAL_PTR(&sensor, s);
+    callbacks++;
+    callback_status = status;
+    callback_ambient = ambient;
+    callback_object = object;
+}
+
+/** Remaining time until the sensor timer expires in microseconds */
+static uint64_t timer_remaining(void)
+{
+    struct itimerspec its;
+
+    TEST_ASSERT_EQUAL_INT(0, timerfd_gettime(sensor.timer_fd, &its));
+    return (uint64_t)its.it_value.tv_sec * 1000000 + (uint64_t)its.it_value.tv_nsec / 1000;
+}
+
+void setUp(void)
+{
+    mlx90632_i2c_dev_init(&dev, FAKE_FD, MLX90632_I2C_DEV_ADDR);
+    dev.transfer = fake_transfer;
+    epoll_fd = epoll_create1(0);
+    fake_status = 0x0009;
+    fake_status_written = 0xFFFF;
+    callbacks = 0;
+}
+
+void tearDown(void)
+{
+    mlx90632_epoll_remove(epoll_fd, &sensor);
+    close(epoll_fd);
+    mlx90632_i2c_dev_select(NULL);
+}
+
+/** Adding reads measurement times, clears data ready and arms the timer */
+void test_epoll_add(void)
+{
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_epoll_add(epoll_fd, &sensor, &dev, &calib, callback, NULL));
+    TEST_ASSERT_EQUAL_UINT32(15000, sensor.period_us[0]);
+    TEST_ASSERT_EQUAL_UINT32(15000, sensor.period_us[1]);
+    TEST_ASSERT_EQUAL_HEX16(0x0008, fake_status_written);
+    TEST_ASSERT_EQUAL_UINT32(4, dev.transfers);
+    TEST_ASSERT_TRUE(sensor.timer_fd >= 0);
+    TEST_ASSERT_UINT64_WITHIN(15000, 0, timer_remaining());
+}
+
+/** Ready data is read once, passed to callback and schedule moves by one period */
+void test_epoll_dispatch_ready(void)
+{
+    uint64_t deadline;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_epoll_add(epoll_fd, &sensor, &dev, &calib, callback, NULL));
+    deadline = sensor.deadline_us;
+    dev.transfers = 0;
+
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_epoll_dispatch(&sensor));
+    TEST_ASSERT_EQUAL_UINT32(1, callbacks);
+    TEST_ASSERT_EQUAL_INT32(0, callback_status);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 48.724, callback_ambient);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 55.507, callback_object);
+    TEST_ASSERT_EQUAL_UINT8(2, sensor.cycle_pos);
+    TEST_ASSERT_EQUAL_HEX16(0x0008, fake_status_written);
+    // status read, status write and six RAM reads
+    TEST_ASSERT_EQUAL_UINT32(8, dev.transfers);
+    TEST_ASSERT_EQUAL_UINT64(deadline + 15000 - MLX90632_EPOLL_ADVANCE, sensor.deadline_us);
+    TEST_ASSERT_EQUAL_UINT32(0, sensor.late);
+}
+
+/** Data which is not ready yet costs one status read and a short retry */
+void test_epoll_dispatch_not_ready(void)
+{
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_epoll_add(epoll_fd, &sensor, &dev, &calib, callback, NULL));
+    dev.transfers = 0;
+    fake_status = 0x0008;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_epoll_dispatch(&sensor));
+    TEST_ASSERT_EQUAL_UINT32(0, callbacks);
+    TEST_ASSERT_EQUAL_UINT32(1, dev.transfers);
+    TEST_ASSERT_EQUAL_UINT32(1, sensor.late);
+    TEST_ASSERT_UINT64_WITHIN(MLX90632_EPOLL_RETRY_TIME, 0, timer_remaining());
+
+    // second retry is not counted as late again
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_epoll_dispatch(&sensor));
+    TEST_ASSERT_EQUAL_UINT32(1, sensor.late);
+    TEST_ASSERT_EQUAL_UINT32(2, sensor.retries);
+}
+
+/** Callback receives timeout after two measurement cycles without data */
+void test_epoll_dispatch_timeout(void)
+{
+    int i;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_epoll_add(epoll_fd, &sensor, &dev, &calib, callback, NULL));
+    fake_status = 0x0008;
+
+    for (i = 0; i < 30000 / MLX90632_EPOLL_RETRY_TIME; ++i)
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_epoll_dispatch(&sensor));
+
+    TEST_ASSERT_EQUAL_INT32(-ETIMEDOUT, mlx90632_epoll_dispatch(&sensor));
+    TEST_ASSERT_EQUAL_UINT32(1, callbacks);
+    TEST_ASSERT_EQUAL_INT32(-ETIMEDOUT, callback_status);
+    TEST_ASSERT_EQUAL_UINT32(0, sensor.retries);
+}
+
+/** Timer wakes up the epoll loop at the expected data ready time */
+void test_epoll_run(void)
+{
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_epoll_add(epoll_fd, &sensor, &dev, &calib, callback, NULL));
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_epoll_run(epoll_fd, 0));
+    TEST_ASSERT_EQUAL_UINT32(0, callbacks);
+
+    TEST_ASSERT_EQUAL_INT32(1, mlx90632_epoll_run(epoll_fd, 1000));
+    TEST_ASSERT_EQUAL_UINT32(1, callbacks);
+    TEST_ASSERT_EQUAL_INT32(0, callback_status);
+}
+
+///@}
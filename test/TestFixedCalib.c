@@ -0,0 +1,117 @@
+/**
+ * @file
+ * @brief Unit tests for calculations with compile-time calibration parameters
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "calib_fixture.h"
+
+#include "mock_mlx90632_depends.h"
+
+#include "mlx90632_fixed_calib.h"
+
+/** Allowed difference to the runtime-calibration functions in degrees Celsius */
+#define FIXED_TOLERANCE 1e-9
+
+static double runtime_object(int16_t object_new_raw, int16_t object_old_raw,
+                             int16_t ambient_new_raw, int16_t ambient_old_raw)
+{
+    double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, MLX90632_FIXED_Gb);
+    double pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                        ambient_new_raw, ambient_old_raw, MLX90632_FIXED_Ka);
+
+    return mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient, MLX90632_FIXED_Ea,
+                                     MLX90632_FIXED_Eb, MLX90632_FIXED_Ga, MLX90632_FIXED_Fa, MLX90632_FIXED_Fb,
+                                     MLX90632_FIXED_Ha, MLX90632_FIXED_Hb);
+}
+
+void setUp(void)
+{
+    mlx90632_set_emissivity(1.0);
+}
+
+void tearDown(void)
+{
+}
+
+void test_fixed_ambient(void)
+{
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 48.724, mlx90632_fixed_calc_temp_ambient(22454, 23030));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, -18.734, mlx90632_fixed_calc_temp_ambient(100, 150));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 53.350, mlx90632_fixed_calc_temp_ambient(32767, 32766));
+}
+
+void test_fixed_object(void)
+{
+    double ambient, object;
+
+    mlx90632_fixed_calc_temp(22454, 23030, 609, 611, &ambient, &object);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 48.724, ambient);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 55.507, object);
+
+    mlx90632_fixed_calc_temp(22454, 23030, 32767, 32767, &ambient, &object);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 212.844, object);
+
+    mlx90632_fixed_calc_temp(22454, 23030, -5000, -5000, &ambient, &object);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, -16.653, object);
+}
+
+/** Fixed and runtime calibration paths agree over the ambient and object raw range */
+void test_fixed_matches_runtime(void)
+{
+    int32_t ambient_raw, object_raw;
+
+    for (ambient_raw = 18000; ambient_raw <= 32000; ambient_raw += 1000)
+    {
+        int16_t ambient_new_raw = (int16_t)ambient_raw;
+        int16_t ambient_old_raw = (int16_t)(ambient_raw + 600);
+        double ambient;
+
+        ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw, MLX90632_FIXED_P_T,
+                                             MLX90632_FIXED_P_R, MLX90632_FIXED_P_G, MLX90632_FIXED_P_O,
+                                             MLX90632_FIXED_Gb);
+        TEST_ASSERT_DOUBLE_WITHIN(FIXED_TOLERANCE, ambient,
+                                  mlx90632_fixed_calc_temp_ambient(ambient_new_raw, ambient_old_raw));
+
+        for (object_raw = -5000; object_raw <= 32000; object_raw += 1500)
+        {
+            double fixed_ambient, fixed_object;
+
+            mlx90632_fixed_calc_temp(ambient_new_raw, ambient_old_raw, (int16_t)object_raw, (int16_t)object_raw,
+                                     &fixed_ambient, &fixed_object);
+            TEST_ASSERT_DOUBLE_WITHIN(FIXED_TOLERANCE,
+                                      runtime_object((int16_t)object_raw, (int16_t)object_raw,
+                                                     ambient_new_raw, ambient_old_raw),
+                                      fixed_object);
+        }
+    }
+}
+
+///@}
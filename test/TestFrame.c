@@ -0,0 +1,294 @@
+/**
+ * @file
+ * @brief Unit tests for synchronized frame acquisition on several buses with fake i2c transfers
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "unity.h"
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_i2c_dev.h"
+#include "mlx90632_frame.h"
+
+#define FAKE_FD_A 42
+#define FAKE_FD_B 43
+#define FAKE_ADDR_FAIL 0x3B /**< Address of the sensors which fail when fake_fail is set */
+#define WAIT_MS 2000 /**< Longest wait for frames before the test fails */
+#define SLOW_US 10000 /**< Duration of each transfer of bus B when fake_slow is set */
+
+static mlx90632_i2c_dev_t dev[4];
+static mlx90632_frame_engine_t engine;
+static uint16_t fake_ctrl;
+static int fake_fail;
+static int fake_slow;
+static uint32_t frames;
+static mlx90632_frame_t last_frame;
+static uint32_t unordered;
+static mlx90632_frame_engine_t *callback_engine;
+static void *callback_user;
+
+/* Only used by blocking library functions, which are not called here */
+void msleep(int msecs)
+{
+    (void)msecs;
+}
+
+/** Fake sensor registers with both medical measurements at 64Hz - 15ms, data ready at position 2 and never busy */
+static uint16_t fake_register(uint16_t address)
+{
+    switch (address)
+    {
+        case MLX90632_EE_MEDICAL_MEAS1: return 0x870D;
+        case MLX90632_EE_MEDICAL_MEAS2: return 0x871D;
+        case MLX90632_REG_CTRL: return fake_ctrl;
+        case MLX90632_REG_STATUS: return 0x0009;
+        case MLX90632_RAM_1(1): return 609;
+        case MLX90632_RAM_2(1): return 609;
+        case MLX90632_RAM_3(1): return 22454;
+        case MLX90632_RAM_1(2): return 611;
+        case MLX90632_RAM_2(2): return 611;
+        case MLX90632_RAM_3(2): return 23030;
+        default: return 0;
+    }
+}
+
+/** Transfer function shared by both buses, called from their worker threads */
+static int32_t fake_transfer(int fd, struct i2c_rdwr_ioctl_data *data)
+{
+    uint16_t address = (uint16_t)((data->msgs[0].buf[0] << 8) | data->msgs[0].buf[1]);
+    uint16_t value;
+
+    if ((fd != FAKE_FD_A) && (fd != FAKE_FD_B))
+        return -EBADF;
+    if (__atomic_load_n(&fake_fail, __ATOMIC_RELAXED) && (data->msgs[0].addr == FAKE_ADDR_FAIL))
+        return -EIO;
+    if (__atomic_load_n(&fake_slow, __ATOMIC_RELAXED) && (fd == FAKE_FD_B))
+    {
+        const struct timespec slow = { 0, SLOW_US * 1000 };
+
+        nanosleep(&slow, NULL);
+    }
+    if (data->nmsgs == 1)
+        return 0;
+
+    value = fake_register(address);
+    data->msgs[1].buf[0] = (uint8_t)(value >> 8);
+    data->msgs[1].buf[1] = (uint8_t)value;
+    return 0;
+}
+
+static void callback(mlx90632_frame_engine_t *e, const mlx90632_frame_t *frame, void *user)
+{
+    // compute thread only records, assertions are done by the test after the engine stopped
+    callback_engine = e;
+    callback_user = user;
+    if ((frames > 0) && (frame->seq <= last_frame.seq))
+        unordered++;
+    memcpy(&last_frame, frame, sizeof(last_frame));
+    __atomic_add_fetch(&frames, 1, __ATOMIC_RELEASE);
+}
+
+/** Wait until the compute thread passed count frames to the callback */
+static void wait_frames(uint32_t count)
+{
+    const struct timespec ms = { 0, 1000000 };
+    int i;
+
+    for (i = 0; (i < WAIT_MS) && (__atomic_load_n(&frames, __ATOMIC_ACQUIRE) < count); ++i)
+        nanosleep(&ms, NULL);
+    TEST_ASSERT_TRUE(__atomic_load_n(&frames, __ATOMIC_ACQUIRE) >= count);
+}
+
+/** Add bus A with sensors 0 and 1 and bus B with sensors 2 and 3 */
+static void add_buses(void)
+{
+    mlx90632_i2c_dev_t *bus_a[2] = { &dev[0], &dev[1] };
+    mlx90632_i2c_dev_t *bus_b[2] = { &dev[2], &dev[3] };
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_frame_add_bus(&engine, bus_a, 2));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_frame_add_bus(&engine, bus_b, 2));
+}
+
+void setUp(void)
+{
+    mlx90632_i2c_dev_init(&dev[0], FAKE_FD_A, MLX90632_I2C_DEV_ADDR);
+    mlx90632_i2c_dev_init(&dev[1], FAKE_FD_A, FAKE_ADDR_FAIL);
+    mlx90632_i2c_dev_init(&dev[2], FAKE_FD_B, MLX90632_I2C_DEV_ADDR);
+    mlx90632_i2c_dev_init(&dev[3], FAKE_FD_B, FAKE_ADDR_FAIL);
+    dev[0].transfer = dev[1].transfer = dev[2].transfer = dev[3].transfer = fake_transfer;
+    fake_ctrl = MLX90632_PWR_STATUS_CONTINUOUS | MLX90632_MTYP_STATUS_MEDICAL;
+    fake_fail = 0;
+    fake_slow = 0;
+    frames = 0;
+    unordered = 0;
+    memset(&last_frame, 0, sizeof(last_frame));
+    callback_engine = NULL;
+    callback_user = NULL;
+    mlx90632_frame_init(&engine);
+}
+
+void tearDown(void)
+{
+    mlx90632_frame_stop(&engine);
+    mlx90632_i2c_dev_select(NULL);
+}
+
+/** Every sensor of both buses lands in the same frame with the raw values the library reads */
+void test_frame_continuous(void)
+{
+    mlx90632_frame_stats_t stats;
+    int16_t ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw;
+    uint16_t i;
+
+    add_buses();
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_frame_start(&engine, MLX90632_FRAME_CONTINUOUS, 20000, callback, &frames));
+    TEST_ASSERT_EQUAL_INT32(-EBUSY, mlx90632_frame_start(&engine, MLX90632_FRAME_CONTINUOUS, 20000, callback, &frames));
+    wait_frames(3);
+    mlx90632_frame_stop(&engine);
+
+    TEST_ASSERT_EQUAL_PTR(&engine, callback_engine);
+    TEST_ASSERT_EQUAL_PTR(&frames, callback_user);
+
+    mlx90632_i2c_dev_select(&dev[0]);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_wo_wait(2, &ambient_new_raw, &ambient_old_raw,
+                                                              &object_new_raw, &object_old_raw));
+
+    TEST_ASSERT_EQUAL_UINT16(4, last_frame.count);
+    TEST_ASSERT_EQUAL_UINT16(4, last_frame.good);
+    TEST_ASSERT_EQUAL_UINT64(engine.start_us + (uint64_t)last_frame.seq * 20000, last_frame.start_us);
+    TEST_ASSERT_TRUE(last_frame.complete_us >= last_frame.start_us);
+    for (i = 0; i < 4; ++i)
+    {
+        TEST_ASSERT_EQUAL_INT32(0, last_frame.sample[i].status);
+        TEST_ASSERT_TRUE(last_frame.sample[i].timestamp_us >= last_frame.start_us);
+        TEST_ASSERT_EQUAL_INT16(ambient_new_raw, last_frame.sample[i].ambient_new_raw);
+        TEST_ASSERT_EQUAL_INT16(ambient_old_raw, last_frame.sample[i].ambient_old_raw);
+        TEST_ASSERT_EQUAL_INT16(object_new_raw, last_frame.sample[i].object_new_raw);
+        TEST_ASSERT_EQUAL_INT16(object_old_raw, last_frame.sample[i].object_old_raw);
+    }
+
+    mlx90632_frame_get_stats(&engine, &stats);
+    TEST_ASSERT_EQUAL_UINT32(frames, stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.incomplete);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.overruns);
+    TEST_ASSERT_EQUAL_UINT16(2, stats.buses);
+    TEST_ASSERT_TRUE(stats.latency_max_us >= stats.latency_mean_us);
+    TEST_ASSERT_TRUE(stats.skew_max_us >= stats.skew_mean_us);
+    TEST_ASSERT_TRUE((stats.utilisation[0] > 0.0) && (stats.utilisation[0] < 1.0));
+    TEST_ASSERT_TRUE((stats.utilisation[1] > 0.0) && (stats.utilisation[1] < 1.0));
+}
+
+/** Burst sensors are triggered at the start of the window and read after the dataset time of 30 ms */
+void test_frame_burst(void)
+{
+    mlx90632_frame_stats_t stats;
+
+    fake_ctrl = MLX90632_PWR_STATUS_SLEEP_STEP | MLX90632_MTYP_STATUS_MEDICAL;
+    add_buses();
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_frame_start(&engine, MLX90632_FRAME_BURST, 40000, callback, &frames));
+    TEST_ASSERT_EQUAL_UINT32(30000, engine.bus[0].dataset_us);
+    wait_frames(2);
+    mlx90632_frame_stop(&engine);
+
+    TEST_ASSERT_EQUAL_UINT16(4, last_frame.good);
+    TEST_ASSERT_TRUE(last_frame.complete_us - last_frame.start_us >= 30000);
+    TEST_ASSERT_TRUE(last_frame.sample[0].timestamp_us >= last_frame.start_us + 30000);
+
+    mlx90632_frame_get_stats(&engine, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.incomplete);
+    TEST_ASSERT_TRUE(stats.latency_mean_us >= 30000.0);
+}
+
+/** Failing sensors are marked in every frame, the others are still delivered */
+void test_frame_sensor_fails(void)
+{
+    mlx90632_frame_stats_t stats;
+
+    add_buses();
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_frame_start(&engine, MLX90632_FRAME_CONTINUOUS, 20000, callback, &frames));
+    __atomic_store_n(&fake_fail, 1, __ATOMIC_RELAXED);
+    wait_frames(3);
+    mlx90632_frame_stop(&engine);
+
+    TEST_ASSERT_EQUAL_UINT16(2, last_frame.good);
+    TEST_ASSERT_EQUAL_INT32(0, last_frame.sample[0].status);
+    TEST_ASSERT_EQUAL_INT32(-EIO, last_frame.sample[1].status);
+    TEST_ASSERT_EQUAL_INT32(0, last_frame.sample[2].status);
+    TEST_ASSERT_EQUAL_INT32(-EIO, last_frame.sample[3].status);
+
+    mlx90632_frame_get_stats(&engine, &stats);
+    TEST_ASSERT_TRUE(stats.incomplete >= 2);
+}
+
+/** Frames which the slow bus did not reach before the stop are still delivered, in window order */
+void test_frame_stop_flushes(void)
+{
+    mlx90632_frame_stats_t stats;
+    uint32_t windows_a, windows_b;
+
+    add_buses();
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_frame_start(&engine, MLX90632_FRAME_CONTINUOUS, 20000, callback, &frames));
+    wait_frames(2);
+    // bus B now takes longer than a window, so bus A is already some windows ahead of it when the engine stops
+    __atomic_store_n(&fake_slow, 1, __ATOMIC_RELAXED);
+    wait_frames(6);
+    mlx90632_frame_stop(&engine);
+
+    // every window either bus reached ends up in exactly one frame
+    windows_a = engine.bus[0].windows + engine.bus[0].missed;
+    windows_b = engine.bus[1].windows + engine.bus[1].missed;
+    mlx90632_frame_get_stats(&engine, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.overruns);
+    TEST_ASSERT_EQUAL_UINT32(windows_a > windows_b ? windows_a : windows_b, frames);
+    TEST_ASSERT_EQUAL_UINT32(frames, stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, unordered);
+    TEST_ASSERT_TRUE(stats.incomplete >= 1);
+    TEST_ASSERT_TRUE(last_frame.good < last_frame.count);
+}
+
+void test_frame_start_errors(void)
+{
+    mlx90632_i2c_dev_t *many[MLX90632_FRAME_BUS_SENSORS + 1] = { &dev[0] };
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_frame_start(&engine, MLX90632_FRAME_CONTINUOUS, 20000, callback, NULL));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_frame_add_bus(&engine, many, 0));
+    TEST_ASSERT_EQUAL_INT32(-ENOBUFS, mlx90632_frame_add_bus(&engine, many, MLX90632_FRAME_BUS_SENSORS + 1));
+
+    add_buses();
+    // window not longer than the 15 ms measurement time
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_frame_start(&engine, MLX90632_FRAME_CONTINUOUS, 15000, callback, NULL));
+    // sensors measure continuously
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_frame_start(&engine, MLX90632_FRAME_BURST, 40000, callback, NULL));
+    TEST_ASSERT_EQUAL_INT32(0, engine.running);
+}
+
+///@}
@@ -0,0 +1,197 @@
+/**
+ * @file
+ * @brief Unit tests for Linux i2c-dev backend with fake transfer function
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "unity.h"
+#include "mlx90632_i2c_dev.h"
+
+#define FAKE_FD 42
+
+/* mlx90632_depends.h is not included, because mlx90632_i2c_dev.c implements it */
+int32_t mlx90632_i2c_read(int16_t register_address, uint16_t *value);
+int32_t mlx90632_i2c_read_block(int16_t register_address, uint16_t *value, uint16_t words);
+int32_t mlx90632_i2c_write(int16_t register_address, uint16_t value);
+
+static mlx90632_i2c_dev_t dev;
+static struct i2c_msg fake_msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+static uint8_t fake_write_bytes[I2C_RDWR_IOCTL_MAX_MSGS][4];
+static uint32_t fake_nmsgs;
+static int32_t fake_ret;
+
+/** Fake sensor memory: every register holds its own address with high byte inverted */
+static uint16_t fake_register(uint16_t address)
+{
+    return (uint16_t)(address ^ 0xFF00);
+}
+
+/** Transfer function which records messages and answers reads from fake sensor memory */
+static int32_t fake_transfer(int fd, struct i2c_rdwr_ioctl_data *data)
+{
+    uint16_t address = 0;
+    uint32_t i, j;
+
+    TEST_ASSERT_EQUAL_INT(FAKE_FD, fd);
+    TEST_ASSERT_TRUE(data->nmsgs <= I2C_RDWR_IOCTL_MAX_MSGS);
+
+    fake_nmsgs = data->nmsgs;
+    for (i = 0; i < data->nmsgs; ++i)
+    {
+        fake_msgs[i] = data->msgs[i];
+        if (data->msgs[i].flags & I2C_M_RD)
+        {
+            for (j = 0; j < data->msgs[i].len / 2u; ++j)
+            {
+                data->msgs[i].buf[2 * j] = (uint8_t)(fake_register(address + j) >> 8);
+                data->msgs[i].buf[2 * j + 1] = (uint8_t)fake_register(address + j);
+            }
+        }
+        else
+        {
+            memcpy(fake_write_bytes[i], data->msgs[i].buf, data->msgs[i].len > 4 ? 4 : data->msgs[i].len);
+            address = (uint16_t)((data->msgs[i].buf[0] << 8) | data->msgs[i].buf[1]);
+        }
+    }
+
+    return fake_ret;
+}
+
+void setUp(void)
+{
+    mlx90632_i2c_dev_init(&dev, FAKE_FD, MLX90632_I2C_DEV_ADDR);
+    dev.transfer = fake_transfer;
+    mlx90632_i2c_dev_select(&dev);
+    fake_nmsgs = 0;
+    fake_ret = 0;
+}
+
+void tearDown(void)
+{
+    mlx90632_i2c_dev_select(NULL);
+}
+
+/** Register read is one transfer with address write and repeated start read */
+void test_i2c_dev_read(void)
+{
+    uint16_t value = 0;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_dev_read(&dev, 0x3FFF, &value));
+    TEST_ASSERT_EQUAL_HEX16(0xC0FF, value);
+    TEST_ASSERT_EQUAL_UINT32(1, dev.transfers);
+    TEST_ASSERT_EQUAL_UINT32(2, fake_nmsgs);
+
+    TEST_ASSERT_EQUAL_HEX16(MLX90632_I2C_DEV_ADDR, fake_msgs[0].addr);
+    TEST_ASSERT_EQUAL_HEX16(0, fake_msgs[0].flags);
+    TEST_ASSERT_EQUAL_UINT16(2, fake_msgs[0].len);
+    TEST_ASSERT_EQUAL_HEX8(0x3F, fake_write_bytes[0][0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, fake_write_bytes[0][1]);
+    TEST_ASSERT_EQUAL_HEX16(MLX90632_I2C_DEV_ADDR, fake_msgs[1].addr);
+    TEST_ASSERT_EQUAL_HEX16(I2C_M_RD, fake_msgs[1].flags);
+    TEST_ASSERT_EQUAL_UINT16(2, fake_msgs[1].len);
+}
+
+/** RAM table is read with one read message */
+void test_i2c_dev_read_block(void)
+{
+    uint16_t value[6];
+    int i;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_dev_read_block(&dev, 0x4000, value, 6));
+    TEST_ASSERT_EQUAL_UINT32(1, dev.transfers);
+    TEST_ASSERT_EQUAL_UINT32(2, fake_nmsgs);
+    TEST_ASSERT_EQUAL_UINT16(12, fake_msgs[1].len);
+    for (i = 0; i < 6; ++i)
+        TEST_ASSERT_EQUAL_HEX16(fake_register(0x4000 + i), value[i]);
+
+    // Nothing to read costs no transfer
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_dev_read_block(&dev, 0x4000, value, 0));
+    TEST_ASSERT_EQUAL_UINT32(1, dev.transfers);
+}
+
+/** Scattered reads are batched up to the ioctl message limit */
+void test_i2c_dev_read_multi(void)
+{
+    int16_t address[MLX90632_I2C_DEV_MAX_READS + 3];
+    uint16_t value[MLX90632_I2C_DEV_MAX_READS + 3];
+    int i;
+
+    for (i = 0; i < MLX90632_I2C_DEV_MAX_READS + 3; ++i)
+        address[i] = (int16_t)(0x4000 + 3 * i);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_dev_read_multi(&dev, address, value, MLX90632_I2C_DEV_MAX_READS + 3));
+    TEST_ASSERT_EQUAL_UINT32(2, dev.transfers);
+    TEST_ASSERT_EQUAL_UINT32(6, fake_nmsgs);
+    for (i = 0; i < MLX90632_I2C_DEV_MAX_READS + 3; ++i)
+        TEST_ASSERT_EQUAL_HEX16(fake_register((uint16_t)address[i]), value[i]);
+}
+
+/** Register write is one message with big-endian address and value */
+void test_i2c_dev_write(void)
+{
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_dev_write(&dev, 0x3001, 0x1234));
+    TEST_ASSERT_EQUAL_UINT32(1, dev.transfers);
+    TEST_ASSERT_EQUAL_UINT32(1, fake_nmsgs);
+    TEST_ASSERT_EQUAL_UINT16(4, fake_msgs[0].len);
+    TEST_ASSERT_EQUAL_HEX8(0x30, fake_write_bytes[0][0]);
+    TEST_ASSERT_EQUAL_HEX8(0x01, fake_write_bytes[0][1]);
+    TEST_ASSERT_EQUAL_HEX8(0x12, fake_write_bytes[0][2]);
+    TEST_ASSERT_EQUAL_HEX8(0x34, fake_write_bytes[0][3]);
+}
+
+/** Depends functions operate on the selected device */
+void test_i2c_dev_depends(void)
+{
+    uint16_t value[2];
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_read(0x2409, &value[0]));
+    TEST_ASSERT_EQUAL_HEX16(fake_register(0x2409), value[0]);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_read_block(0x2409, value, 2));
+    TEST_ASSERT_EQUAL_HEX16(fake_register(0x240A), value[1]);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_write(0x3FFF, 0));
+    TEST_ASSERT_EQUAL_UINT32(3, dev.transfers);
+
+    mlx90632_i2c_dev_select(NULL);
+    TEST_ASSERT_EQUAL_INT32(-ENODEV, mlx90632_i2c_read(0x2409, &value[0]));
+    TEST_ASSERT_EQUAL_INT32(-ENODEV, mlx90632_i2c_read_block(0x2409, value, 2));
+    TEST_ASSERT_EQUAL_INT32(-ENODEV, mlx90632_i2c_write(0x3FFF, 0));
+}
+
+/** Transfer errors are returned */
+void test_i2c_dev_errors(void)
+{
+    uint16_t value;
+
+    fake_ret = -EREMOTEIO;
+    TEST_ASSERT_EQUAL_INT32(-EREMOTEIO, mlx90632_i2c_dev_read(&dev, 0x3FFF, &value));
+    TEST_ASSERT_EQUAL_INT32(-EREMOTEIO, mlx90632_i2c_dev_write(&dev, 0x3FFF, 0));
+    TEST_ASSERT_EQUAL_INT32(-ENOENT, mlx90632_i2c_dev_open(&dev, "/nonexistent/i2c-0", MLX90632_I2C_DEV_ADDR));
+}
+
+///@}
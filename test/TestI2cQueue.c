@@ -0,0 +1,241 @@
+/**
+ * @file
+ * @brief Unit tests for queue coalescing transfers of several sensors with a fake I2C_RDWR transfer
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "unity.h"
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_depends.h"
+#include "mlx90632_i2c_dev.h"
+#include "mlx90632_i2c_queue.h"
+#include "mlx90632_async.h"
+
+#define FAKE_FD 42
+#define SENSORS 16
+
+static mlx90632_i2c_queue_t queue;
+static mlx90632_i2c_dev_t dev[SENSORS];
+static uint32_t fake_nmsgs;
+static uint16_t fake_written[SENSORS];
+static int32_t fake_ret;
+static int completed;
+
+/* Only used by blocking library functions, which are not called here */
+void msleep(int msecs)
+{
+    (void)msecs;
+}
+
+/** Fake sensor memory: every register holds its own address with slave address in the high byte */
+static uint16_t fake_register(uint16_t slave, uint16_t address)
+{
+    return (uint16_t)(address ^ (slave << 8));
+}
+
+/** Transfer function which answers reads of every slave from fake sensor memory and records writes */
+static int32_t fake_transfer(int fd, struct i2c_rdwr_ioctl_data *data)
+{
+    uint16_t address = 0;
+    uint32_t i, j;
+
+    TEST_ASSERT_EQUAL_INT(FAKE_FD, fd);
+    TEST_ASSERT_TRUE(data->nmsgs <= I2C_RDWR_IOCTL_MAX_MSGS);
+
+    fake_nmsgs = data->nmsgs;
+    for (i = 0; i < data->nmsgs; ++i)
+    {
+        struct i2c_msg *msg = &data->msgs[i];
+
+        if (msg->flags & I2C_M_RD)
+        {
+            for (j = 0; j < msg->len / 2u; ++j)
+            {
+                msg->buf[2 * j] = (uint8_t)(fake_register(msg->addr, address + j) >> 8);
+                msg->buf[2 * j + 1] = (uint8_t)fake_register(msg->addr, address + j);
+            }
+        }
+        else
+        {
+            address = (uint16_t)((msg->buf[0] << 8) | msg->buf[1]);
+            if (msg->len == 4)
+                fake_written[msg->addr - 0x30] = (uint16_t)((msg->buf[2] << 8) | msg->buf[3]);
+        }
+    }
+
+    return fake_ret;
+}
+
+static void complete(mlx90632_i2c_xfer_t *xfer)
+{
+    (void)xfer;
+    completed++;
+}
+
+void setUp(void)
+{
+    int i;
+
+    mlx90632_i2c_queue_init(&queue);
+    for (i = 0; i < SENSORS; ++i)
+    {
+        mlx90632_i2c_dev_init(&dev[i], FAKE_FD, (uint16_t)(0x30 + i));
+        dev[i].transfer = fake_transfer;
+    }
+    memset(fake_written, 0, sizeof(fake_written));
+    fake_nmsgs = 0;
+    fake_ret = 0;
+    completed = 0;
+}
+
+void tearDown(void)
+{
+    mlx90632_i2c_queue_select(NULL, NULL);
+}
+
+/** Reads and writes of two devices are one transfer, results go back to each of them */
+void test_i2c_queue_flush(void)
+{
+    uint16_t ram[2][6];
+    uint16_t status = 0x0008;
+    mlx90632_i2c_xfer_t xfer[3] = {
+        { 0x4003, ram[0], 6, 0, 1, complete },
+        { 0x4003, ram[1], 6, 0, 1, complete },
+        { 0x3FFF, &status, 1, 1, 1, complete },
+    };
+    int i;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_queue_add(&queue, &dev[0], &xfer[0]));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_queue_add(&queue, &dev[1], &xfer[1]));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_queue_add(&queue, &dev[1], &xfer[2]));
+    TEST_ASSERT_EQUAL_UINT32(0, queue.transfers);
+    TEST_ASSERT_EQUAL_INT(0, completed);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_queue_flush(&queue));
+    TEST_ASSERT_EQUAL_UINT32(1, queue.transfers);
+    TEST_ASSERT_EQUAL_UINT32(5, fake_nmsgs);
+    TEST_ASSERT_EQUAL_INT(3, completed);
+
+    for (i = 0; i < 6; ++i)
+    {
+        TEST_ASSERT_EQUAL_HEX16(fake_register(0x30, 0x4003 + i), ram[0][i]);
+        TEST_ASSERT_EQUAL_HEX16(fake_register(0x31, 0x4003 + i), ram[1][i]);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, xfer[0].status);
+    TEST_ASSERT_EQUAL_INT32(0, xfer[2].status);
+    TEST_ASSERT_EQUAL_HEX16(0x0008, fake_written[1]);
+    TEST_ASSERT_EQUAL_HEX16(0x0008, status);
+
+    // empty queue costs no transfer
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_queue_flush(&queue));
+    TEST_ASSERT_EQUAL_UINT32(1, queue.transfers);
+}
+
+static void done(mlx90632_async_t *async, int32_t status)
+{
+    TEST_ASSERT_EQUAL_INT32(0, status);
+    completed++;
+    (void)async;
+}
+
+/** Raw reads of 16 sensors cost one ioctl */
+void test_i2c_queue_async_frame(void)
+{
+    static mlx90632_async_t reads[SENSORS];
+    int i;
+
+    for (i = 0; i < SENSORS; ++i)
+    {
+        mlx90632_i2c_queue_select(&queue, &dev[i]);
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_wo_wait_async(&reads[i], 1 + (i & 1), done, &dev[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(0, completed);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_queue_flush(&queue));
+    TEST_ASSERT_EQUAL_UINT32(1, queue.transfers);
+    TEST_ASSERT_EQUAL_UINT32(2 * SENSORS, fake_nmsgs);
+    TEST_ASSERT_EQUAL_INT(SENSORS, completed);
+
+    for (i = 0; i < SENSORS; ++i)
+    {
+        TEST_ASSERT_EQUAL_INT16((int16_t)fake_register(0x30 + i, MLX90632_RAM_3(1)), reads[i].ambient_new_raw);
+        TEST_ASSERT_EQUAL_INT16((int16_t)fake_register(0x30 + i, MLX90632_RAM_3(2)), reads[i].ambient_old_raw);
+        TEST_ASSERT_EQUAL_UINT32(0, dev[i].transfers);
+    }
+}
+
+void test_i2c_queue_errors(void)
+{
+    uint16_t value[MLX90632_I2C_DEV_MAX_READS + 1];
+    mlx90632_i2c_xfer_t xfer[MLX90632_I2C_DEV_MAX_READS + 1];
+    mlx90632_i2c_dev_t other;
+    int i;
+
+    for (i = 0; i <= MLX90632_I2C_DEV_MAX_READS; ++i)
+    {
+        xfer[i].register_address = 0x3FFF;
+        xfer[i].value = &value[i];
+        xfer[i].words = 1;
+        xfer[i].write = 0;
+        xfer[i].complete = complete;
+    }
+
+    // submit needs a selected queue
+    TEST_ASSERT_EQUAL_INT32(-ENODEV, mlx90632_i2c_submit(&xfer[0]));
+
+    xfer[0].words = 0;
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_i2c_queue_add(&queue, &dev[0], &xfer[0]));
+    xfer[0].words = 2;
+    xfer[0].write = 1;
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_i2c_queue_add(&queue, &dev[0], &xfer[0]));
+    xfer[0].words = 1;
+    xfer[0].write = 0;
+
+    mlx90632_i2c_queue_select(&queue, &dev[0]);
+    for (i = 0; i < MLX90632_I2C_DEV_MAX_READS; ++i)
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_submit(&xfer[i]));
+    TEST_ASSERT_EQUAL_INT32(-ENOBUFS, mlx90632_i2c_submit(&xfer[MLX90632_I2C_DEV_MAX_READS]));
+
+    // device on another adapter cannot join the ioctl
+    mlx90632_i2c_dev_init(&other, FAKE_FD + 1, 0x3A);
+    TEST_ASSERT_EQUAL_INT32(-EXDEV, mlx90632_i2c_queue_add(&queue, &other, &xfer[MLX90632_I2C_DEV_MAX_READS]));
+
+    // failed ioctl completes every transfer with its error and empties the queue
+    fake_ret = -EREMOTEIO;
+    TEST_ASSERT_EQUAL_INT32(-EREMOTEIO, mlx90632_i2c_queue_flush(&queue));
+    TEST_ASSERT_EQUAL_INT(MLX90632_I2C_DEV_MAX_READS, completed);
+    TEST_ASSERT_EQUAL_INT32(-EREMOTEIO, xfer[0].status);
+    TEST_ASSERT_EQUAL_INT32(-EREMOTEIO, xfer[MLX90632_I2C_DEV_MAX_READS - 1].status);
+    TEST_ASSERT_EQUAL_UINT16(0, queue.count);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_i2c_queue_add(&queue, &other, &xfer[MLX90632_I2C_DEV_MAX_READS]));
+}
+
+///@}
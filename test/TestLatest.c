@@ -0,0 +1,174 @@
+/**
+ * @file
+ * @brief Unit tests for latest sample cell
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "unity.h"
+#include "mlx90632_latest.h"
+
+#define STRESS_SAMPLES 200000
+#define STRESS_READERS 3
+
+static mlx90632_latest_t cell;
+
+/** Value whose fields are all derived from n, so a torn read is detected */
+static void make_value(mlx90632_latest_value_t *value, uint32_t n)
+{
+    value->timestamp_us = n;
+    value->ambient_new_raw = (int16_t)n;
+    value->ambient_old_raw = (int16_t)(n + 1);
+    value->object_new_raw = (int16_t)(n + 2);
+    value->object_old_raw = (int16_t)(n + 3);
+    value->ambient = n * 0.5;
+    value->object = n * 0.25;
+}
+
+static int consistent(const mlx90632_latest_value_t *value)
+{
+    mlx90632_latest_value_t expected;
+
+    make_value(&expected, (uint32_t)value->timestamp_us);
+    return (value->ambient_new_raw == expected.ambient_new_raw) &&
+           (value->ambient_old_raw == expected.ambient_old_raw) &&
+           (value->object_new_raw == expected.object_new_raw) &&
+           (value->object_old_raw == expected.object_old_raw) &&
+           (value->ambient == expected.ambient) && (value->object == expected.object);
+}
+
+void setUp(void)
+{
+    mlx90632_latest_init(&cell);
+}
+
+void tearDown(void)
+{
+}
+
+void test_latest_alignment(void)
+{
+    static mlx90632_latest_t cells[2];
+
+    TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)&cells[1] % MLX90632_LATEST_CACHE_LINE);
+    TEST_ASSERT_EQUAL_UINT32(MLX90632_LATEST_CACHE_LINE, (uintptr_t)&cells[1] - (uintptr_t)&cells[0]);
+}
+
+void test_latest_empty(void)
+{
+    mlx90632_latest_value_t value;
+
+    TEST_ASSERT_EQUAL_INT32(-ENODATA, mlx90632_latest_read(&cell, &value));
+}
+
+void test_latest_publish_read(void)
+{
+    mlx90632_latest_value_t value, read;
+
+    make_value(&value, 7);
+    mlx90632_latest_publish(&cell, &value);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_latest_read(&cell, &read));
+    TEST_ASSERT_EQUAL_UINT64(7, read.timestamp_us);
+    TEST_ASSERT_TRUE(consistent(&read));
+
+    make_value(&value, 8);
+    mlx90632_latest_publish(&cell, &value);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_latest_read(&cell, &read));
+    TEST_ASSERT_EQUAL_UINT64(8, read.timestamp_us);
+    TEST_ASSERT_EQUAL_UINT32(4, cell.sequence);
+}
+
+void test_latest_writer_busy(void)
+{
+    mlx90632_latest_value_t value, read;
+
+    make_value(&value, 1);
+    mlx90632_latest_publish(&cell, &value);
+    // writer preempted in the middle of the publication
+    cell.sequence++;
+    TEST_ASSERT_EQUAL_INT32(-EAGAIN, mlx90632_latest_read(&cell, &read));
+}
+
+void test_latest_sequence_wrap(void)
+{
+    mlx90632_latest_value_t value, read;
+
+    make_value(&value, 3);
+    cell.sequence = UINT32_MAX - 1;
+    mlx90632_latest_publish(&cell, &value);
+    TEST_ASSERT_EQUAL_UINT32(2, cell.sequence);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_latest_read(&cell, &read));
+    TEST_ASSERT_EQUAL_UINT64(3, read.timestamp_us);
+}
+
+static void *stress_reader(void *arg)
+{
+    mlx90632_latest_value_t value;
+    uint64_t last = 0;
+    uintptr_t torn = 0;
+
+    (void)arg;
+    do
+    {
+        if (mlx90632_latest_read(&cell, &value) < 0)
+            continue;
+        if (!consistent(&value) || (value.timestamp_us < last))
+            torn++;
+        last = value.timestamp_us;
+    } while (last < STRESS_SAMPLES);
+
+    return (void *)torn;
+}
+
+void test_latest_concurrent_readers(void)
+{
+    pthread_t readers[STRESS_READERS];
+    mlx90632_latest_value_t value;
+    uint32_t n, r;
+    void *torn;
+
+    for (r = 0; r < STRESS_READERS; ++r)
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&readers[r], NULL, stress_reader, NULL));
+
+    for (n = 1; n <= STRESS_SAMPLES; ++n)
+    {
+        make_value(&value, n);
+        mlx90632_latest_publish(&cell, &value);
+    }
+
+    for (r = 0; r < STRESS_READERS; ++r)
+    {
+        TEST_ASSERT_EQUAL_INT(0, pthread_join(readers[r], &torn));
+        TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)torn);
+    }
+}
+
+///@}
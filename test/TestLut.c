@@ -0,0 +1,145 @@
+/**
+ * @file
+ * @brief Unit tests for interpolated lookup table of object temperature
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_lut.h"
+#include "calib_fixture.h"
+
+#include "mock_mlx90632_depends.h"
+
+static mlx90632_calib_t calib = CALIB_FIXTURE;
+
+#define AMBIENT_POINTS 17
+#define OBJECT_POINTS 129
+#define LUT_TOLERANCE 0.1 /**< Interpolation error of 17 by 129 grid in degrees Celsius */
+
+static int16_t table[MLX90632_LUT_SIZE(AMBIENT_POINTS, OBJECT_POINTS)];
+static mlx90632_lut_t lut;
+
+static double reference_object(int16_t ambient_new_raw, int16_t ambient_old_raw, int16_t object_raw)
+{
+    double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib.Gb);
+    double pre_object = mlx90632_preprocess_temp_object(object_raw, object_raw, ambient_new_raw, ambient_old_raw,
+                                                        calib.Ka);
+
+    return mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient,
+                                     calib.Ea, calib.Eb, calib.Ga, calib.Fa, calib.Fb, calib.Ha, calib.Hb);
+}
+
+void setUp(void)
+{
+    mlx90632_set_emissivity(1.0);
+}
+
+void tearDown(void)
+{
+}
+
+void test_lut_init_invalid(void)
+{
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_lut_init(&lut, table, 1, OBJECT_POINTS, &calib, 10, 60, -20, 200));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_lut_init(&lut, table, AMBIENT_POINTS, 1, &calib, 10, 60, -20, 200));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_lut_init(&lut, table, AMBIENT_POINTS, OBJECT_POINTS, &calib,
+                                                       60, 10, -20, 200));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_lut_init(&lut, table, AMBIENT_POINTS, OBJECT_POINTS, &calib,
+                                                       10, 60, 200, 200));
+    TEST_ASSERT_EQUAL_INT32(-ERANGE, mlx90632_lut_init(&lut, table, AMBIENT_POINTS, OBJECT_POINTS, &calib,
+                                                       10, 60, -20, 380));
+}
+
+void test_lut_nominal(void)
+{
+    int32_t temp;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_lut_init(&lut, table, AMBIENT_POINTS, OBJECT_POINTS, &calib,
+                                                 10, 60, -20, 200));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_lut_calc_temp_object(&lut, 22454, 23030, 609, 611, &temp));
+    TEST_ASSERT_DOUBLE_WITHIN(LUT_TOLERANCE, 55.499, temp / 1000.0);
+}
+
+void test_lut_error_bound(void)
+{
+    int32_t ambient_raw, object_raw, temp;
+    uint32_t points = 0;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_lut_init(&lut, table, AMBIENT_POINTS, OBJECT_POINTS, &calib,
+                                                 10, 60, -20, 200));
+    for (ambient_raw = 16000; ambient_raw <= 32000; ambient_raw += 500)
+    {
+        int16_t ambient_new_raw = (int16_t)ambient_raw, ambient_old_raw = (int16_t)(ambient_raw + 576);
+        double ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw,
+                                                    calib.P_T, calib.P_R, calib.P_G, calib.P_O, calib.Gb);
+
+        if (ambient < 10 || ambient > 60)
+            continue;
+        for (object_raw = -32768; object_raw <= 32767; object_raw += 101)
+        {
+            double ref = reference_object(ambient_new_raw, ambient_old_raw, (int16_t)object_raw);
+
+            if (!(ref >= -20 && ref <= 200))
+                continue;
+            TEST_ASSERT_EQUAL_INT32(0, mlx90632_lut_calc_temp_object(&lut, ambient_new_raw, ambient_old_raw,
+                                                                     (int16_t)object_raw, (int16_t)object_raw,
+                                                                     &temp));
+            TEST_ASSERT_DOUBLE_WITHIN(LUT_TOLERANCE, ref, temp / 1000.0);
+            points++;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(1000, points);
+}
+
+void test_lut_emissivity(void)
+{
+    int32_t temp;
+
+    mlx90632_set_emissivity(0.8);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_lut_init(&lut, table, AMBIENT_POINTS, OBJECT_POINTS, &calib,
+                                                 10, 60, -20, 200));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_lut_calc_temp_object(&lut, 22454, 23030, 609, 611, &temp));
+    TEST_ASSERT_DOUBLE_WITHIN(LUT_TOLERANCE, reference_object(22454, 23030, 610), temp / 1000.0);
+}
+
+void test_lut_outside_grid(void)
+{
+    int32_t temp = 0;
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_lut_init(&lut, table, AMBIENT_POINTS, OBJECT_POINTS, &calib,
+                                                 10, 60, -20, 200));
+    // ambient far above the range
+    TEST_ASSERT_EQUAL_INT32(-ERANGE, mlx90632_lut_calc_temp_object(&lut, 32000, 23030, 609, 611, &temp));
+    // object far above the range
+    TEST_ASSERT_EQUAL_INT32(-ERANGE, mlx90632_lut_calc_temp_object(&lut, 22454, 23030, 32767, 32767, &temp));
+    TEST_ASSERT_EQUAL_INT32(0, temp);
+}
+
+///@}
@@ -0,0 +1,129 @@
+/**
+ * @file
+ * @brief Unit tests for object temperature solver with Newton steps
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_newton.h"
+#include "calib_fixture.h"
+
+#include "mock_mlx90632_depends.h"
+
+static int32_t Ea = CALIB_FIXTURE_Ea;
+static int32_t Eb = CALIB_FIXTURE_Eb;
+static int32_t Fa = CALIB_FIXTURE_Fa;
+static int32_t Fb = CALIB_FIXTURE_Fb;
+static int32_t Ga = CALIB_FIXTURE_Ga;
+static int16_t Ha = CALIB_FIXTURE_Ha;
+static int16_t Hb = CALIB_FIXTURE_Hb;
+static int16_t Gb = CALIB_FIXTURE_Gb;
+static int16_t Ka = CALIB_FIXTURE_Ka;
+
+/** Difference to five fixed-point iterations, which are not converged completely at the top of extended range */
+#define NEWTON_TOLERANCE 1e-5
+
+static void preprocess(int16_t object_new_raw, int16_t object_old_raw, int32_t *object, int32_t *ambient)
+{
+    *ambient = (int32_t)mlx90632_preprocess_temp_ambient(22454, 23030, Gb);
+    *object = (int32_t)mlx90632_preprocess_temp_object(object_new_raw, object_old_raw, 22454, 23030, Ka);
+}
+
+static void preprocess_extended(int16_t object_new_raw, int32_t *object, int32_t *ambient)
+{
+    *ambient = (int32_t)mlx90632_preprocess_temp_ambient_extended(22454, 23030, Gb);
+    *object = (int32_t)mlx90632_preprocess_temp_object_extended(object_new_raw, 22454, 23030, Ka);
+}
+
+void setUp(void)
+{
+    mlx90632_set_emissivity(1.0);
+}
+
+void tearDown(void)
+{
+}
+
+void test_newton_object(void)
+{
+    static const int16_t raw[] = { 609, 149, -149, 32767, -5000, 26901, 27105 };
+    int32_t object, ambient;
+    uint8_t i;
+
+    for (i = 0; i < sizeof(raw) / sizeof(raw[0]); ++i)
+    {
+        preprocess(raw[i], raw[i], &object, &ambient);
+        TEST_ASSERT_DOUBLE_WITHIN(NEWTON_TOLERANCE,
+                                  mlx90632_calc_temp_object(object, ambient, Ea, Eb, Ga, Fa, Fb, Ha, Hb),
+                                  mlx90632_calc_temp_object_newton(object, ambient, Ea, Eb, Ga, Fa, Fb, Ha, Hb));
+    }
+
+    preprocess(609, 611, &object, &ambient);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 55.507, mlx90632_calc_temp_object_newton(object, ambient, Ea, Eb, Ga, Fa, Fb, Ha,
+                                                                             Hb));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 45.495, mlx90632_calc_temp_object_newton(object, ambient, Ea, Eb, Ga, Fa, Fb, Ha,
+                                                                             10240));
+}
+
+void test_newton_object_reflected(void)
+{
+    int32_t object, ambient;
+
+    preprocess(609, 611, &object, &ambient);
+    mlx90632_set_emissivity(0.1);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 98.141, mlx90632_calc_temp_object_reflected_newton(object, ambient, 49.66, Ea, Eb,
+                                                                                       Ga, Fa, Fb, Ha, Hb));
+    TEST_ASSERT_DOUBLE_WITHIN(NEWTON_TOLERANCE,
+                              mlx90632_calc_temp_object_reflected(object, ambient, 40.0, Ea, Eb, Ga, Fa, Fb, Ha, Hb),
+                              mlx90632_calc_temp_object_reflected_newton(object, ambient, 40.0, Ea, Eb, Ga, Fa, Fb,
+                                                                         Ha, Hb));
+}
+
+void test_newton_object_extended(void)
+{
+    static const int16_t raw[] = { 305, 75, -75, 32767, -2500, 13550, 26900, 27100 };
+    int32_t object, ambient;
+    uint8_t i;
+
+    for (i = 0; i < sizeof(raw) / sizeof(raw[0]); ++i)
+    {
+        preprocess_extended(raw[i], &object, &ambient);
+        TEST_ASSERT_DOUBLE_WITHIN(NEWTON_TOLERANCE,
+                                  mlx90632_calc_temp_object_extended(object, ambient, 25.0, Ea, Eb, Ga, Fa, Fb, Ha,
+                                                                     Hb),
+                                  mlx90632_calc_temp_object_extended_newton(object, ambient, 25.0, Ea, Eb, Ga, Fa, Fb,
+                                                                            Ha, Hb));
+    }
+
+    preprocess_extended(32767, &object, &ambient);
+    TEST_ASSERT_DOUBLE_WITHIN(0.02, 292.381, mlx90632_calc_temp_object_extended_newton(object, ambient, 25.0, Ea, Eb,
+                                                                                       Ga, Fa, Fb, Ha, Hb));
+}
+
+///@}
@@ -166,6 +166,31 @@ void test_wait_for_measurement_timeout(void)
     TEST_ASSERT_EQUAL_INT32(-ETIMEDOUT, mlx90632_wait_for_measurement());
 }
 
+/** Test poll for measurement reads status once and does not sleep.
+ */
+void test_poll_measurement(void)
+{
+    uint16_t reg_status_mock = 0x0C86; // cycle position 1 & data not ready
+    uint16_t reg_status_mock1 = 0x008B; // cycle position 2 & data ready
+
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_REG_STATUS, &reg_status_mock, 0);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_ReturnThruPtr_value(&reg_status_mock);
+
+    TEST_ASSERT_EQUAL_INT32(-EAGAIN, mlx90632_poll_measurement());
+
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_REG_STATUS, &reg_status_mock1, 0);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_ReturnThruPtr_value(&reg_status_mock1);
+
+    TEST_ASSERT_EQUAL_INT32(2, mlx90632_poll_measurement());
+
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_REG_STATUS, &reg_status_mock1, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_poll_measurement());
+}
+
 /** Test start measurement with data ready.
  */
 void test_start_measurement_success(void)
@@ -0,0 +1,393 @@
+/**
+ * @file
+ * @brief Unit tests for reading raw samples with metadata with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_sample.h"
+
+#include "mock_mlx90632_depends.h"
+
+static mlx90632_sample_t sample;
+static int16_t ambient_new_mock = 22454;
+static int16_t ambient_old_mock = 23030;
+static int16_t object_new_mock = 150;
+static int16_t object_old_mock = 140;
+
+void setUp(void)
+{
+    memset(&sample, 0, sizeof(sample));
+}
+
+void tearDown(void)
+{
+}
+
+static void expect_read(int16_t address, uint16_t *value)
+{
+    mlx90632_i2c_read_ExpectAndReturn(address, value, 0);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_ReturnThruPtr_value(value);
+}
+
+static void expect_read_medical_ram(int channel_new, int channel_old)
+{
+    expect_read(MLX90632_RAM_3(1), (uint16_t *)&ambient_new_mock);
+    expect_read(MLX90632_RAM_3(2), (uint16_t *)&ambient_old_mock);
+    expect_read(MLX90632_RAM_2(channel_new), (uint16_t *)&object_new_mock);
+    expect_read(MLX90632_RAM_1(channel_new), (uint16_t *)&object_new_mock);
+    expect_read(MLX90632_RAM_2(channel_old), (uint16_t *)&object_old_mock);
+    expect_read(MLX90632_RAM_1(channel_old), (uint16_t *)&object_old_mock);
+}
+
+static void expect_read_extended_ram(void)
+{
+    expect_read(MLX90632_RAM_3(17), (uint16_t *)&ambient_new_mock);
+    expect_read(MLX90632_RAM_3(18), (uint16_t *)&ambient_old_mock);
+    expect_read(MLX90632_RAM_1(17), (uint16_t *)&object_new_mock);
+    expect_read(MLX90632_RAM_2(17), (uint16_t *)&object_old_mock);
+    expect_read(MLX90632_RAM_1(18), (uint16_t *)&object_old_mock);
+    expect_read(MLX90632_RAM_2(18), (uint16_t *)&object_old_mock);
+    expect_read(MLX90632_RAM_1(19), (uint16_t *)&object_new_mock);
+    expect_read(MLX90632_RAM_2(19), (uint16_t *)&object_new_mock);
+}
+
+static void assert_medical_raw(void)
+{
+    TEST_ASSERT_EQUAL_INT16(ambient_new_mock, sample.ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(ambient_old_mock, sample.ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT16(object_new_mock, sample.object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(object_old_mock, sample.object_old_raw);
+}
+
+/** Status read while waiting is reused for metadata, no additional bus access */
+void test_read_temp_raw_sample_success(void)
+{
+    static uint16_t reg_status_trigger = 0x0009;
+    static uint16_t reg_status_not_ready = 0x0008;
+    static uint16_t reg_status_ready = 0x0109; // brown-out & cycle position 2 & data ready
+
+    expect_read(MLX90632_REG_STATUS, &reg_status_trigger);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0008, 0);
+    expect_read(MLX90632_REG_STATUS, &reg_status_not_ready);
+    usleep_Expect(10000, 11000);
+    expect_read(MLX90632_REG_STATUS, &reg_status_ready);
+    mlx90632_get_time_us_ExpectAndReturn(123456789);
+    expect_read_medical_ram(2, 1);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_sample(&sample));
+    assert_medical_raw();
+    TEST_ASSERT_EQUAL_UINT64(123456789, sample.timestamp_us);
+    TEST_ASSERT_EQUAL_HEX16(0x0109, sample.status);
+    TEST_ASSERT_EQUAL_UINT8(2, sample.cycle_pos);
+    TEST_ASSERT_EQUAL_UINT8(MLX90632_MTYP_MEDICAL, sample.meas_type);
+}
+
+void test_read_temp_raw_sample_errors(void)
+{
+    static uint16_t reg_status_trigger = 0x0009;
+    static uint16_t reg_status_ready = 0x0005;
+
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_REG_STATUS, &reg_status_trigger, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_read_temp_raw_sample(&sample));
+
+    expect_read(MLX90632_REG_STATUS, &reg_status_trigger);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0008, 0);
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_REG_STATUS, &reg_status_ready, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_read_temp_raw_sample(&sample));
+
+    expect_read(MLX90632_REG_STATUS, &reg_status_trigger);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0008, 0);
+    expect_read(MLX90632_REG_STATUS, &reg_status_ready);
+    mlx90632_get_time_us_ExpectAndReturn(1);
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_RAM_3(1), (uint16_t *)&ambient_new_mock, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_read_temp_raw_sample(&sample));
+}
+
+void test_read_temp_raw_sample_timeout(void)
+{
+    static uint16_t reg_status_not_ready = 0x0008;
+    int i;
+
+    expect_read(MLX90632_REG_STATUS, &reg_status_not_ready);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0008, 0);
+    for (i = 0; i < MLX90632_MAX_NUMBER_MESUREMENT_READ_TRIES; ++i)
+    {
+        expect_read(MLX90632_REG_STATUS, &reg_status_not_ready);
+        usleep_Expect(10000, 11000);
+    }
+
+    TEST_ASSERT_EQUAL_INT32(-ETIMEDOUT, mlx90632_read_temp_raw_sample(&sample));
+}
+
+void test_read_temp_raw_wo_wait_sample_success(void)
+{
+    mlx90632_get_time_us_ExpectAndReturn(42);
+    expect_read_medical_ram(1, 2);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_wo_wait_sample(1, &sample));
+    assert_medical_raw();
+    TEST_ASSERT_EQUAL_UINT64(42, sample.timestamp_us);
+    TEST_ASSERT_EQUAL_HEX16(0, sample.status);
+    TEST_ASSERT_EQUAL_UINT8(1, sample.cycle_pos);
+    TEST_ASSERT_EQUAL_UINT8(MLX90632_MTYP_MEDICAL, sample.meas_type);
+}
+
+void test_read_temp_raw_burst_sample_success(void)
+{
+    static uint16_t reg_ctrl_mock = 0x0002; // medical sleeping step meas selected
+    static uint16_t reg_status_busy = 0x0409;
+    static uint16_t reg_status_done = 0x0009;
+    static uint16_t meas1_mock = 0x820D;
+    static uint16_t meas2_mock = 0x821D;
+
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, reg_ctrl_mock | MLX90632_START_BURST_MEAS, 0);
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    expect_read(MLX90632_EE_MEDICAL_MEAS1, &meas1_mock);
+    expect_read(MLX90632_EE_MEDICAL_MEAS2, &meas2_mock);
+    msleep_Expect(1000);
+    expect_read(MLX90632_REG_STATUS, &reg_status_busy);
+    usleep_Expect(10000, 11000);
+    expect_read(MLX90632_REG_STATUS, &reg_status_done);
+    mlx90632_get_time_us_ExpectAndReturn(1011000);
+    expect_read_medical_ram(2, 1);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_burst_sample(&sample));
+    assert_medical_raw();
+    TEST_ASSERT_EQUAL_UINT64(1011000, sample.timestamp_us);
+    TEST_ASSERT_EQUAL_HEX16(0x0009, sample.status);
+    TEST_ASSERT_EQUAL_UINT8(2, sample.cycle_pos);
+    TEST_ASSERT_EQUAL_UINT8(MLX90632_MTYP_MEDICAL_BURST, sample.meas_type);
+}
+
+void test_read_temp_raw_burst_sample_errors(void)
+{
+    static uint16_t reg_ctrl_mock = 0x0006; // medical continuous
+
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_REG_CTRL, &reg_ctrl_mock, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_read_temp_raw_burst_sample(&sample));
+
+    // Dataset ready time is not known in continuous mode
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, reg_ctrl_mock | MLX90632_START_BURST_MEAS, 0);
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_read_temp_raw_burst_sample(&sample));
+}
+
+/** Extended range retries until cycle position 19 is reached */
+void test_read_temp_raw_extended_sample_success(void)
+{
+    static uint16_t reg_status_18 = 0x0049;
+    static uint16_t reg_status_19 = 0x004D;
+
+    expect_read(MLX90632_REG_STATUS, &reg_status_18);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0048, 0);
+    expect_read(MLX90632_REG_STATUS, &reg_status_18);
+    mlx90632_get_time_us_ExpectAndReturn(1000);
+    expect_read(MLX90632_REG_STATUS, &reg_status_19);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x004C, 0);
+    expect_read(MLX90632_REG_STATUS, &reg_status_19);
+    mlx90632_get_time_us_ExpectAndReturn(2000);
+    expect_read_extended_ram();
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_extended_sample(&sample));
+    TEST_ASSERT_EQUAL_INT16(ambient_new_mock, sample.ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(ambient_old_mock, sample.ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT16(((150 - 140 - 140 + 140) / 2) + 150 + 150, sample.object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(0, sample.object_old_raw);
+    TEST_ASSERT_EQUAL_UINT64(2000, sample.timestamp_us);
+    TEST_ASSERT_EQUAL_HEX16(0x004D, sample.status);
+    TEST_ASSERT_EQUAL_UINT8(19, sample.cycle_pos);
+    TEST_ASSERT_EQUAL_UINT8(MLX90632_MTYP_EXTENDED, sample.meas_type);
+}
+
+void test_read_temp_raw_extended_sample_wrong_position(void)
+{
+    static uint16_t reg_status_17 = 0x0045;
+    int i;
+
+    for (i = 0; i < 3; ++i)
+    {
+        expect_read(MLX90632_REG_STATUS, &reg_status_17);
+        mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0044, 0);
+        expect_read(MLX90632_REG_STATUS, &reg_status_17);
+        mlx90632_get_time_us_ExpectAndReturn(i);
+    }
+
+    TEST_ASSERT_EQUAL_INT32(-ETIMEDOUT, mlx90632_read_temp_raw_extended_sample(&sample));
+}
+
+void test_read_temp_raw_extended_wo_wait_sample_success(void)
+{
+    sample.object_old_raw = 1234;
+
+    mlx90632_get_time_us_ExpectAndReturn(77);
+    expect_read_extended_ram();
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_extended_wo_wait_sample(&sample));
+    TEST_ASSERT_EQUAL_INT16(0, sample.object_old_raw);
+    TEST_ASSERT_EQUAL_UINT64(77, sample.timestamp_us);
+    TEST_ASSERT_EQUAL_UINT8(19, sample.cycle_pos);
+    TEST_ASSERT_EQUAL_UINT8(MLX90632_MTYP_EXTENDED, sample.meas_type);
+}
+
+void test_read_temp_raw_extended_burst_sample_success(void)
+{
+    static uint16_t reg_ctrl_mock = 0x0112; // extended sleeping step meas selected
+    static uint16_t reg_status_done = 0x004D;
+    static uint16_t meas_mock = 0x820D;
+
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, reg_ctrl_mock | MLX90632_START_BURST_MEAS, 0);
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    expect_read(MLX90632_EE_EXTENDED_MEAS1, &meas_mock);
+    expect_read(MLX90632_EE_EXTENDED_MEAS2, &meas_mock);
+    expect_read(MLX90632_EE_EXTENDED_MEAS3, &meas_mock);
+    msleep_Expect(1500);
+    expect_read(MLX90632_REG_STATUS, &reg_status_done);
+    mlx90632_get_time_us_ExpectAndReturn(1500100);
+    expect_read_extended_ram();
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_read_temp_raw_extended_burst_sample(&sample));
+    TEST_ASSERT_EQUAL_UINT64(1500100, sample.timestamp_us);
+    TEST_ASSERT_EQUAL_UINT8(19, sample.cycle_pos);
+    TEST_ASSERT_EQUAL_UINT8(MLX90632_MTYP_EXTENDED_BURST, sample.meas_type);
+}
+
+/** Expect start of capture with both medical measurements at 64Hz - 15ms */
+static void expect_capture_start(void)
+{
+    static uint16_t reg_meas_mock = 0x870D;
+    static uint16_t reg_status_trigger = 0x0009;
+
+    expect_read(MLX90632_EE_MEDICAL_MEAS1, &reg_meas_mock);
+    expect_read(MLX90632_EE_MEDICAL_MEAS2, &reg_meas_mock);
+    expect_read(MLX90632_REG_STATUS, &reg_status_trigger);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0008, 0);
+}
+
+/** Expect one captured sample which is ready on the first status read */
+static void expect_capture_sample(uint16_t *status, uint64_t timestamp, int channel_new, int channel_old)
+{
+    expect_read(MLX90632_REG_STATUS, status);
+    mlx90632_get_time_us_ExpectAndReturn(timestamp);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, *status & ~MLX90632_STAT_DATA_RDY, 0);
+    expect_read_medical_ram(channel_new, channel_old);
+}
+
+void test_capture_success(void)
+{
+    static uint16_t reg_status_ch1 = 0x0005;
+    static uint16_t reg_status_ch2 = 0x0009;
+    static uint16_t reg_status_not_ready = 0x0004;
+    mlx90632_sample_t buf[4];
+    mlx90632_capture_stats_t stats = { 5, 5 };
+
+    expect_capture_start();
+    expect_capture_sample(&reg_status_ch1, 1000, 1, 2);
+
+    // sleep until 1 ms before expected data ready, then poll finely
+    mlx90632_get_time_us_ExpectAndReturn(2000);
+    usleep_Expect(13000, 13200);
+    expect_read(MLX90632_REG_STATUS, &reg_status_not_ready);
+    usleep_Expect(200, 220);
+    expect_capture_sample(&reg_status_ch2, 16100, 2, 1);
+
+    // same channel after two periods - one cycle missed
+    mlx90632_get_time_us_ExpectAndReturn(17000);
+    usleep_Expect(13100, 13300);
+    expect_capture_sample(&reg_status_ch2, 46100, 2, 1);
+
+    // same channel after one period - same measurement seen twice
+    mlx90632_get_time_us_ExpectAndReturn(47000);
+    usleep_Expect(13100, 13300);
+    expect_capture_sample(&reg_status_ch2, 61000, 2, 1);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_capture(buf, 4, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.missed);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.duplicated);
+
+    TEST_ASSERT_EQUAL_UINT64(1000, buf[0].timestamp_us);
+    TEST_ASSERT_EQUAL_UINT8(1, buf[0].cycle_pos);
+    TEST_ASSERT_EQUAL_UINT64(16100, buf[1].timestamp_us);
+    TEST_ASSERT_EQUAL_UINT8(2, buf[1].cycle_pos);
+    TEST_ASSERT_EQUAL_HEX16(0x0009, buf[3].status);
+    TEST_ASSERT_EQUAL_UINT8(MLX90632_MTYP_MEDICAL, buf[3].meas_type);
+    TEST_ASSERT_EQUAL_INT16(object_new_mock, buf[3].object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(object_old_mock, buf[3].object_old_raw);
+}
+
+void test_capture_errors(void)
+{
+    static uint16_t reg_meas_mock = 0x870D;
+    mlx90632_sample_t buf[1];
+    mlx90632_capture_stats_t stats;
+
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_EE_MEDICAL_MEAS1, &reg_meas_mock, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_capture(buf, 1, &stats));
+
+    expect_read(MLX90632_EE_MEDICAL_MEAS1, &reg_meas_mock);
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_EE_MEDICAL_MEAS2, &reg_meas_mock, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_capture(buf, 1, &stats));
+
+    expect_capture_start();
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_REG_STATUS, &reg_meas_mock, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_capture(buf, 1, &stats));
+}
+
+void test_capture_timeout(void)
+{
+    static uint16_t reg_status_not_ready = 0x0004;
+    mlx90632_sample_t buf[1];
+    mlx90632_capture_stats_t stats;
+    int i;
+
+    expect_capture_start();
+    // polling gives up after two full cycles
+    for (i = 0; i < 151; ++i)
+    {
+        expect_read(MLX90632_REG_STATUS, &reg_status_not_ready);
+        usleep_Expect(200, 220);
+    }
+
+    TEST_ASSERT_EQUAL_INT32(-ETIMEDOUT, mlx90632_capture(buf, 1, &stats));
+}
+
+///@}
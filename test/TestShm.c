@@ -0,0 +1,244 @@
+/**
+ * @file
+ * @brief Unit tests for shared memory sample rings
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "unity.h"
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_shm.h"
+#include "calib_fixture.h"
+
+#include "mock_mlx90632_depends.h"
+
+#define SHM_NAME "/mlx90632_test_shm"
+#define STRESS_SAMPLES 200000
+
+static const mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static mlx90632_shm_t writer, reader;
+
+/** Sample whose fields are all derived from n, so a torn read is detected */
+static void make_sample(mlx90632_shm_sample_t *sample, uint64_t n)
+{
+    sample->timestamp_us = n;
+    sample->ambient_new_raw = (int16_t)n;
+    sample->ambient_old_raw = (int16_t)(n + 1);
+    sample->object_new_raw = (int16_t)(n + 2);
+    sample->object_old_raw = (int16_t)(n + 3);
+    sample->ambient = n * 0.5;
+    sample->object = n * 0.25;
+}
+
+static int consistent(const mlx90632_shm_sample_t *sample)
+{
+    mlx90632_shm_sample_t expected;
+
+    make_sample(&expected, sample->timestamp_us);
+    return (sample->ambient_new_raw == expected.ambient_new_raw) &&
+           (sample->ambient_old_raw == expected.ambient_old_raw) &&
+           (sample->object_new_raw == expected.object_new_raw) &&
+           (sample->object_old_raw == expected.object_old_raw) &&
+           (sample->ambient == expected.ambient) && (sample->object == expected.object);
+}
+
+static void expect_read(int16_t address, uint16_t *value)
+{
+    mlx90632_i2c_read_ExpectAndReturn(address, value, 0);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_ReturnThruPtr_value(value);
+}
+
+void setUp(void)
+{
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_shm_create(&writer, SHM_NAME, 2, 4));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_shm_open(&reader, SHM_NAME));
+}
+
+void tearDown(void)
+{
+    mlx90632_shm_close(&reader);
+    mlx90632_shm_close(&writer);
+    mlx90632_shm_unlink(SHM_NAME);
+}
+
+void test_shm_layout(void)
+{
+    const mlx90632_shm_header_t *header = reader.header;
+
+    TEST_ASSERT_EQUAL_HEX32(MLX90632_SHM_MAGIC, header->magic);
+    TEST_ASSERT_EQUAL_UINT16(MLX90632_SHM_VERSION, header->version);
+    TEST_ASSERT_EQUAL_UINT16(64, header->header_size);
+    TEST_ASSERT_EQUAL_UINT32(64, header->slot_size);
+    TEST_ASSERT_EQUAL_UINT32(64 + 4 * 64, header->ring_size);
+    TEST_ASSERT_EQUAL_UINT32(2, reader.devices);
+    TEST_ASSERT_EQUAL_UINT32(4, reader.slots);
+    TEST_ASSERT_EQUAL_UINT32(64 + 2 * (64 + 4 * 64), reader.size);
+}
+
+void test_shm_create_invalid(void)
+{
+    mlx90632_shm_t shm;
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_shm_create(&shm, SHM_NAME "_x", 0, 4));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_shm_create(&shm, SHM_NAME "_x", 1, 0));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_shm_create(&shm, SHM_NAME "_x", 1, 3));
+    TEST_ASSERT_EQUAL_INT32(-ENOENT, mlx90632_shm_open(&shm, SHM_NAME "_x"));
+}
+
+void test_shm_open_other_version(void)
+{
+    mlx90632_shm_t shm;
+
+    writer.header->version = MLX90632_SHM_VERSION + 1;
+    TEST_ASSERT_EQUAL_INT32(-EPROTO, mlx90632_shm_open(&shm, SHM_NAME));
+    writer.header->version = MLX90632_SHM_VERSION;
+    writer.header->magic = 0;
+    TEST_ASSERT_EQUAL_INT32(-EPROTO, mlx90632_shm_open(&shm, SHM_NAME));
+}
+
+void test_shm_publish_read(void)
+{
+    mlx90632_shm_sample_t sample, read;
+
+    TEST_ASSERT_EQUAL_UINT64(0, mlx90632_shm_head(&reader, 1));
+    TEST_ASSERT_EQUAL_INT32(-ENODATA, mlx90632_shm_read(&reader, 1, 0, &read));
+
+    make_sample(&sample, 7);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_shm_publish(&writer, 1, &sample));
+    TEST_ASSERT_EQUAL_UINT64(1, mlx90632_shm_head(&reader, 1));
+    TEST_ASSERT_EQUAL_UINT64(0, mlx90632_shm_head(&reader, 0));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_shm_read(&reader, 1, 0, &read));
+    TEST_ASSERT_EQUAL_UINT64(7, read.timestamp_us);
+    TEST_ASSERT_TRUE(consistent(&read));
+    TEST_ASSERT_EQUAL_INT32(-ENODATA, mlx90632_shm_read(&reader, 1, 1, &read));
+    TEST_ASSERT_EQUAL_INT32(-ENODATA, mlx90632_shm_read(&reader, 0, 0, &read));
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_shm_publish(&writer, 2, &sample));
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_shm_read(&reader, 2, 0, &read));
+}
+
+void test_shm_overwritten(void)
+{
+    mlx90632_shm_sample_t sample, read;
+    uint64_t n;
+
+    for (n = 0; n < 6; ++n)
+    {
+        make_sample(&sample, n);
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_shm_publish(&writer, 0, &sample));
+    }
+
+    TEST_ASSERT_EQUAL_UINT64(6, mlx90632_shm_head(&reader, 0));
+    TEST_ASSERT_EQUAL_INT32(-EOVERFLOW, mlx90632_shm_read(&reader, 0, 0, &read));
+    TEST_ASSERT_EQUAL_INT32(-EOVERFLOW, mlx90632_shm_read(&reader, 0, 1, &read));
+    for (n = 2; n < 6; ++n)
+    {
+        TEST_ASSERT_EQUAL_INT32(0, mlx90632_shm_read(&reader, 0, n, &read));
+        TEST_ASSERT_EQUAL_UINT64(n, read.timestamp_us);
+    }
+    TEST_ASSERT_EQUAL_INT32(-ENODATA, mlx90632_shm_read(&reader, 0, 6, &read));
+}
+
+void test_shm_acquire(void)
+{
+    static uint16_t ambient_new = 22454, ambient_old = 23030, object_new = 609, object_old = 611;
+    mlx90632_shm_sample_t read;
+
+    expect_read(MLX90632_RAM_3(1), &ambient_new);
+    expect_read(MLX90632_RAM_3(2), &ambient_old);
+    expect_read(MLX90632_RAM_2(1), &object_new);
+    expect_read(MLX90632_RAM_1(1), &object_new);
+    expect_read(MLX90632_RAM_2(2), &object_old);
+    expect_read(MLX90632_RAM_1(2), &object_old);
+
+    mlx90632_set_emissivity(1.0);
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_shm_acquire(&writer, 1, 1, &calib, 1234));
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_shm_read(&reader, 1, 0, &read));
+    TEST_ASSERT_EQUAL_UINT64(1234, read.timestamp_us);
+    TEST_ASSERT_EQUAL_INT16(22454, read.ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT16(23030, read.ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT16(609, read.object_new_raw);
+    TEST_ASSERT_EQUAL_INT16(611, read.object_old_raw);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 48.724, read.ambient);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 55.499, read.object);
+}
+
+static void *stress_reader(void *arg)
+{
+    mlx90632_shm_sample_t sample;
+    uint64_t n = 0;
+    uintptr_t torn = 0;
+    int32_t ret;
+
+    (void)arg;
+    while (n < STRESS_SAMPLES)
+    {
+        ret = mlx90632_shm_read(&reader, 0, n, &sample);
+        if (ret == -ENODATA)
+            continue;
+        if (ret == -EOVERFLOW)
+        {
+            // fell behind, continue from the oldest sample which is still kept
+            n = mlx90632_shm_head(&reader, 0) - reader.slots + 1;
+            continue;
+        }
+        if ((ret < 0) || !consistent(&sample) || (sample.timestamp_us != n))
+            torn++;
+        n++;
+    }
+
+    return (void *)torn;
+}
+
+/** Reader thread uses its own read-only mapping, like another process would */
+void test_shm_concurrent_reader(void)
+{
+    mlx90632_shm_sample_t sample;
+    pthread_t thread;
+    uint64_t n;
+    void *torn;
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread, NULL, stress_reader, NULL));
+
+    for (n = 0; n < STRESS_SAMPLES; ++n)
+    {
+        make_sample(&sample, n);
+        mlx90632_shm_publish(&writer, 0, &sample);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(thread, &torn));
+    TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)torn);
+}
+
+///@}
@@ -0,0 +1,209 @@
+/**
+ * @file
+ * @brief Unit tests for single measurement pipeline with virtual i2c communication
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_single.h"
+#include "calib_fixture.h"
+
+#include "mock_mlx90632_depends.h"
+
+#define REG_CTRL_STEP_MEDICAL 0xF604 /**< Control register mock with MTYP, SOC and SOB cleared and step mode */
+
+static const mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static uint16_t reg_meas1_mock = 0x860D; // 32Hz - 31ms
+static uint16_t reg_meas2_mock = 0x851D; // 16Hz - 62ms
+static uint16_t reg_ctrl_mock = 0xFE1A; // continuous mode with unrelated bits set
+static uint16_t reg_status_mock = 0x0001; // data ready from previous mode
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void expect_read(int16_t address, uint16_t *value)
+{
+    mlx90632_i2c_read_ExpectAndReturn(address, value, 0);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+    mlx90632_i2c_read_ReturnThruPtr_value(value);
+}
+
+static void expect_single_init(void)
+{
+    expect_read(MLX90632_EE_MEDICAL_MEAS1, &reg_meas1_mock);
+    expect_read(MLX90632_EE_MEDICAL_MEAS2, &reg_meas2_mock);
+    expect_read(MLX90632_REG_CTRL, &reg_ctrl_mock);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, REG_CTRL_STEP_MEDICAL, 0);
+    expect_read(MLX90632_REG_STATUS, &reg_status_mock);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0000, 0);
+}
+
+/** Expect one trigger of the pipeline which updates channel with RAM values stored in ram[3] */
+static void expect_single_step(int sleep_ms, uint16_t *status, uint16_t *ram, int channel)
+{
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, REG_CTRL_STEP_MEDICAL | MLX90632_START_SINGLE_MEAS, 0);
+    msleep_Expect(sleep_ms);
+    expect_read(MLX90632_REG_STATUS, status);
+    expect_read(MLX90632_RAM_1(channel), &ram[0]);
+    expect_read(MLX90632_RAM_2(channel), &ram[1]);
+    expect_read(MLX90632_RAM_3(channel), &ram[2]);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, *status & ~MLX90632_STAT_DATA_RDY, 0);
+}
+
+void test_single_init_success(void)
+{
+    expect_single_init();
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_single_init());
+}
+
+void test_single_init_error(void)
+{
+    mlx90632_i2c_read_ExpectAndReturn(MLX90632_EE_MEDICAL_MEAS1, &reg_meas1_mock, -EPERM);
+    mlx90632_i2c_read_IgnoreArg_value(); // Ignore input of mock since we use it as output
+
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_single_init());
+
+    // Pipeline is unusable until initialized
+    double ambient, object;
+    uint32_t latency;
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_single_measurement(&calib, &ambient, &object, &latency));
+}
+
+/** Warm-up triggers two measurements, then the third one is timed and calculated */
+void test_single_measurement_warmup(void)
+{
+    static uint16_t status_ch1 = 0x0005;
+    static uint16_t status_ch2 = 0x0009;
+    static uint16_t ram_ch1_stale[3] = { 0, 0, 0 };
+    static uint16_t ram_ch2[3] = { 611, 611, 23030 };
+    static uint16_t ram_ch1[3] = { 609, 609, 22454 };
+    double ambient, object;
+    uint32_t latency = 0;
+
+    expect_single_init();
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_single_init());
+
+    expect_single_step(62, &status_ch1, ram_ch1_stale, 1);
+    expect_single_step(62, &status_ch2, ram_ch2, 2);
+    mlx90632_get_time_us_ExpectAndReturn(1000);
+    expect_single_step(31, &status_ch1, ram_ch1, 1);
+    mlx90632_get_time_us_ExpectAndReturn(63500);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_single_measurement(&calib, &ambient, &object, &latency));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 48.724, ambient);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 55.507, object);
+    TEST_ASSERT_EQUAL_UINT32(62500, latency);
+
+    // Warmed-up pipeline reads only channel 2, channel 1 comes from cache
+    mlx90632_get_time_us_ExpectAndReturn(100000);
+    expect_single_step(62, &status_ch2, ram_ch2, 2);
+    mlx90632_get_time_us_ExpectAndReturn(225200);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_single_measurement(&calib, &ambient, &object, &latency));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 48.724, ambient);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 55.499, object);
+    TEST_ASSERT_EQUAL_UINT32(125200, latency);
+}
+
+/** Data ready is polled with short interval when measurement takes longer than nominal */
+void test_single_measurement_poll(void)
+{
+    static uint16_t status_not_ready = 0x0404;
+    static uint16_t status_ch1 = 0x0005;
+    static uint16_t status_ch2 = 0x0009;
+    static uint16_t ram_ch1[3] = { 609, 609, 22454 };
+    static uint16_t ram_ch2[3] = { 611, 611, 23030 };
+    double ambient, object;
+    uint32_t latency;
+
+    expect_single_init();
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_single_init());
+
+    expect_single_step(62, &status_ch2, ram_ch2, 2);
+
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, REG_CTRL_STEP_MEDICAL | MLX90632_START_SINGLE_MEAS, 0);
+    msleep_Expect(31);
+    expect_read(MLX90632_REG_STATUS, &status_not_ready);
+    usleep_Expect(500, 600);
+    expect_read(MLX90632_REG_STATUS, &status_ch1);
+    expect_read(MLX90632_RAM_1(1), &ram_ch1[0]);
+    expect_read(MLX90632_RAM_2(1), &ram_ch1[1]);
+    expect_read(MLX90632_RAM_3(1), &ram_ch1[2]);
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_STATUS, 0x0004, 0);
+
+    mlx90632_get_time_us_ExpectAndReturn(0);
+    expect_single_step(62, &status_ch2, ram_ch2, 2);
+    mlx90632_get_time_us_ExpectAndReturn(125000);
+
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_single_measurement(&calib, &ambient, &object, &latency));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 48.724, ambient);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 55.499, object);
+    TEST_ASSERT_EQUAL_UINT32(125000, latency);
+}
+
+/** Cycle position which is not a medical channel is rejected */
+void test_single_measurement_invalid_channel(void)
+{
+    static uint16_t status_bad = 0x0045; // cycle position 17
+    double ambient, object;
+    uint32_t latency;
+
+    expect_single_init();
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_single_init());
+
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, REG_CTRL_STEP_MEDICAL | MLX90632_START_SINGLE_MEAS, 0);
+    msleep_Expect(62);
+    expect_read(MLX90632_REG_STATUS, &status_bad);
+
+    TEST_ASSERT_EQUAL_INT32(-EINVAL, mlx90632_single_measurement(&calib, &ambient, &object, &latency));
+}
+
+/** Errors on trigger are returned */
+void test_single_measurement_trigger_error(void)
+{
+    double ambient, object;
+    uint32_t latency;
+
+    expect_single_init();
+    TEST_ASSERT_EQUAL_INT32(0, mlx90632_single_init());
+
+    mlx90632_i2c_write_ExpectAndReturn(MLX90632_REG_CTRL, REG_CTRL_STEP_MEDICAL | MLX90632_START_SINGLE_MEAS, -EPERM);
+
+    TEST_ASSERT_EQUAL_INT32(-EPERM, mlx90632_single_measurement(&calib, &ambient, &object, &latency));
+}
+
+///@}
@@ -0,0 +1,246 @@
+/**
+ * @file
+ * @brief Unit tests for C++20 coroutine layer on a fake i2c bus
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ * Sensors on one fake bus are read from several executor threads. Fake bus counts overlapping accesses, so a
+ * missing lock of the @link mlx90632::AsyncMutex @endlink shows up as a failure.
+ */
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+#include "mlx90632_coro.hpp"
+
+#include "TestCpp.hpp"
+#include "calib_fixture.h"
+
+static const mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static std::atomic<int> bus_users(0);
+static std::atomic<int> bus_overlaps(0);
+static std::atomic<int> bus_error(0);
+static std::atomic<uint16_t> cycle_pos(1);
+
+// Same prototypes as in mlx90632_depends.h
+extern "C" int32_t mlx90632_i2c_read(int16_t register_address, uint16_t *value)
+{
+    int32_t ret = 0;
+
+    if (bus_users.fetch_add(1) != 0)
+        bus_overlaps++;
+    // Make overlapping accesses likely when the bus is not locked
+    std::this_thread::sleep_for(std::chrono::microseconds(20));
+
+    switch ((uint16_t)register_address)
+    {
+    case MLX90632_EE_MEDICAL_MEAS1:
+        *value = 0x870D; // 128Hz - 15ms
+        break;
+    case MLX90632_EE_MEDICAL_MEAS2:
+        *value = 0x871D; // 128Hz - 15ms
+        break;
+    case MLX90632_REG_STATUS:
+        ret = bus_error.load();
+        *value = MLX90632_STAT_DATA_RDY | (cycle_pos.load() << 2);
+        break;
+    case MLX90632_RAM_3(1):
+        *value = 22454;
+        break;
+    case MLX90632_RAM_3(2):
+        *value = 23030;
+        break;
+    case MLX90632_RAM_1(1):
+    case MLX90632_RAM_2(1):
+        *value = 609;
+        break;
+    default:
+        *value = 611;
+        break;
+    }
+
+    bus_users--;
+    return ret;
+}
+
+extern "C" int32_t mlx90632_i2c_write(int16_t register_address, uint16_t value)
+{
+    (void)value;
+    if (bus_users.fetch_add(1) != 0)
+        bus_overlaps++;
+    std::this_thread::sleep_for(std::chrono::microseconds(20));
+
+    // Each trigger completes the next measurement of the table
+    if (register_address == MLX90632_REG_STATUS)
+        cycle_pos = (cycle_pos.load() == 1) ? 2 : 1;
+
+    bus_users--;
+    return 0;
+}
+
+// mlx90632_depends.h is not included, because its usleep declaration conflicts with the one from unistd.h, which
+// the library then uses like on the Linux host backend
+extern "C" void msleep(int msecs)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(msecs));
+}
+
+/** Wait with timeout until the counter reaches the count */
+static bool wait_for(const std::atomic<int> &counter, int count)
+{
+    auto deadline = mlx90632::Clock::now() + std::chrono::seconds(5);
+
+    while (counter.load() < count)
+    {
+        if (mlx90632::Clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+static mlx90632::Task<mlx90632::Sample> read_twice(mlx90632::Sensor &sensor)
+{
+    mlx90632::Sample sample = co_await sensor.read();
+    if (sample.status < 0)
+        co_return sample;
+
+    co_return co_await sensor.read();
+}
+
+/** Sensors on one bus read from two threads never access the bus at the same time */
+static void test_coro_read_shared_bus(void)
+{
+    const int sensors = 4;
+    std::atomic<int> done(0);
+    std::atomic<int> good(0);
+    double ambient[sensors], object[sensors];
+
+    bus_overlaps = 0;
+    bus_error = 0;
+    {
+        mlx90632::Executor executor(2);
+        mlx90632::AsyncMutex bus(executor);
+        std::vector<std::unique_ptr<mlx90632::Sensor> > sensor;
+
+        for (int i = 0; i < sensors; ++i)
+            sensor.emplace_back(new mlx90632::Sensor(executor, bus, calib));
+
+        for (int i = 0; i < sensors; ++i)
+        {
+            mlx90632::spawn(executor, read_twice(*sensor[i]), [&, i](mlx90632::Sample sample) {
+                if (sample.status == 0)
+                {
+                    ambient[i] = sample.ambient;
+                    object[i] = sample.object;
+                    good++;
+                }
+                done++;
+            });
+        }
+
+        TEST_ASSERT(wait_for(done, sensors));
+    }
+
+    TEST_ASSERT_EQUAL_INT(sensors, good.load());
+    TEST_ASSERT_EQUAL_INT(0, bus_overlaps.load());
+    for (int i = 0; i < sensors; ++i)
+    {
+        TEST_ASSERT_DOUBLE_WITHIN(0.01, 48.724, ambient[i]);
+        TEST_ASSERT_DOUBLE_WITHIN(0.02, 55.5, object[i]);
+    }
+}
+
+/** Bus error is returned in the sample status */
+static void test_coro_read_error(void)
+{
+    std::atomic<int> done(0);
+    int32_t status = 0;
+
+    bus_error = -EPERM;
+    {
+        mlx90632::Executor executor(1);
+        mlx90632::AsyncMutex bus(executor);
+        mlx90632::Sensor sensor(executor, bus, calib);
+
+        mlx90632::spawn(executor, sensor.read(), [&](mlx90632::Sample sample) {
+            status = sample.status;
+            done++;
+        });
+
+        TEST_ASSERT(wait_for(done, 1));
+    }
+    bus_error = 0;
+
+    TEST_ASSERT_EQUAL_INT(-EPERM, status);
+}
+
+/** Local which records that the frame holding it was destroyed */
+struct Tracker {
+    std::atomic<int> &destroyed;
+    ~Tracker() { destroyed++; }
+};
+
+static mlx90632::Task<int> sleep_long(mlx90632::Executor &executor, std::atomic<int> &started,
+                                      std::atomic<int> &destroyed)
+{
+    Tracker tracker{ destroyed };
+
+    started++;
+    co_await executor.sleep_for(std::chrono::hours(1));
+    co_return 0;
+}
+
+/** Executor destroys coroutines which are still waiting, together with the tasks they await */
+static void test_coro_executor_destroys_pending(void)
+{
+    std::atomic<int> started(0);
+    std::atomic<int> destroyed(0);
+    std::atomic<int> done(0);
+
+    {
+        mlx90632::Executor executor(1);
+
+        for (int i = 0; i < 3; ++i)
+            mlx90632::spawn(executor, sleep_long(executor, started, destroyed), [&](int) { done++; });
+
+        TEST_ASSERT(wait_for(started, 3));
+        TEST_ASSERT_EQUAL_INT(0, destroyed.load());
+    }
+
+    TEST_ASSERT_EQUAL_INT(3, destroyed.load());
+    TEST_ASSERT_EQUAL_INT(0, done.load());
+}
+
+int main(void)
+{
+    TEST_RUN(test_coro_read_shared_bus);
+    TEST_RUN(test_coro_read_error);
+    TEST_RUN(test_coro_executor_destroys_pending);
+
+    return TEST_REPORT("TestCoro");
+}
+
+///@}
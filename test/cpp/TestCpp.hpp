@@ -0,0 +1,91 @@
+/**
+ * @file
+ * @brief Assertions of the C++ unit tests, named after the Unity ones used by the C unit tests
+ * @internal
+ *
+ * @copyright (C) 2017 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ * Ceedling builds C only, so C++ headers are tested by small programs built with `make cpptest`. Failed assertion
+ * prints its location and returns from the test function, main returns non-zero when any test failed.
+ */
+#ifndef _MLX90632_TEST_CPP_
+#define _MLX90632_TEST_CPP_
+
+#include <cmath>
+#include <cstdio>
+
+static int test_count = 0;
+static int test_failures = 0;
+static bool test_failed = false;
+
+#define TEST_FAIL_AT(text) \
+    do { \
+        std::printf("%s:%d: FAIL: %s\n", __FILE__, __LINE__, text); \
+        test_failed = true; \
+        return; \
+    } while (0)
+
+#define TEST_ASSERT(condition) \
+    do { \
+        if (!(condition)) \
+            TEST_FAIL_AT(#condition); \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) \
+    do { \
+        long long e_ = (long long)(expected), a_ = (long long)(actual); \
+        if (e_ != a_) \
+        { \
+            std::printf("%s:%d: expected %lld, was %lld\n", __FILE__, __LINE__, e_, a_); \
+            TEST_FAIL_AT(#actual); \
+        } \
+    } while (0)
+
+#define TEST_ASSERT_DOUBLE_WITHIN(delta, expected, actual) \
+    do { \
+        double e_ = (expected), a_ = (actual); \
+        if (!(std::fabs(e_ - a_) <= (delta))) \
+        { \
+            std::printf("%s:%d: expected %f, was %f\n", __FILE__, __LINE__, e_, a_); \
+            TEST_FAIL_AT(#actual); \
+        } \
+    } while (0)
+
+/** Run test function and count it as failed when an assertion failed */
+#define TEST_RUN(test) \
+    do { \
+        test_failed = false; \
+        test(); \
+        test_count++; \
+        if (test_failed) \
+            test_failures++; \
+    } while (0)
+
+/** Print summary and return exit code of the test program */
+static inline int TEST_REPORT(const char *name)
+{
+    std::printf("%s: %d tests, %d failures\n", name, test_count, test_failures);
+    return test_failures ? 1 : 0;
+}
+
+///@}
+#endif
@@ -0,0 +1,626 @@
+/**
+ * @file
+ * @brief Unit tests for C++ driver template with a scripted fake bus
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ * Fake bus and clock policies replay a script of expected register accesses and sleeps, like the CMock expectations
+ * in TestRead.c. Tests below expect the same transaction sequences TestRead.c expects from the C driver.
+ */
+#include <cstdio>
+#include <vector>
+
+#include "mlx90632.hpp"
+
+#include "TestCpp.hpp"
+
+/** Expected register access or sleep */
+struct Step {
+    char op; /**< 'r' read, 'w' write, 'u' usleep or 'm' msleep */
+    int16_t address; /**< Register address, or minimum range of usleep or time of msleep */
+    uint16_t value; /**< Value returned by read or expected by write, or maximum range of usleep */
+    int32_t ret; /**< Return value of read or write */
+};
+
+static std::vector<Step> script;
+static size_t script_pos = 0;
+static bool script_mismatch = false;
+
+static void expect(char op, int16_t address, uint16_t value, int32_t ret)
+{
+    Step step = { op, address, value, ret };
+
+    script.push_back(step);
+}
+
+static void expect_read(int16_t address, uint16_t value, int32_t ret = 0)
+{
+    expect('r', address, value, ret);
+}
+
+static void expect_write(int16_t address, uint16_t value, int32_t ret = 0)
+{
+    expect('w', address, value, ret);
+}
+
+/** Next step of the script, or NULL when it does not match the access */
+static const Step *next_step(char op, int16_t address, uint16_t value)
+{
+    const Step *step;
+
+    if (script_pos >= script.size())
+    {
+        std::printf("unexpected %c 0x%04X 0x%04X after end of script\n", op, (uint16_t)address, value);
+        script_mismatch = true;
+        return NULL;
+    }
+
+    step = &script[script_pos++];
+    if ((step->op != op) || (step->address != address) || ((op != 'r') && (step->value != value)))
+    {
+        std::printf("step %u: expected %c 0x%04X 0x%04X, was %c 0x%04X 0x%04X\n", (unsigned)script_pos - 1,
+                    step->op, (uint16_t)step->address, step->value, op, (uint16_t)address, value);
+        script_mismatch = true;
+        return NULL;
+    }
+
+    return step;
+}
+
+struct FakeBus {
+    static int32_t read(int16_t register_address, uint16_t *value)
+    {
+        const Step *step = next_step('r', register_address, 0);
+
+        if (!step)
+            return -EIO;
+        if (step->ret >= 0)
+            *value = step->value;
+        return step->ret;
+    }
+
+    static int32_t write(int16_t register_address, uint16_t value)
+    {
+        const Step *step = next_step('w', register_address, value);
+
+        return step ? step->ret : -EIO;
+    }
+};
+
+struct FakeClock {
+    static void usleep(int min_range, int max_range)
+    {
+        next_step('u', (int16_t)min_range, (uint16_t)max_range);
+    }
+
+    static void msleep(int msecs)
+    {
+        next_step('m', (int16_t)msecs, 0);
+    }
+};
+
+typedef mlx90632::Mlx90632<FakeBus, FakeClock> Sensor;
+
+/** Whole script was replayed in order */
+#define TEST_ASSERT_SCRIPT_DONE() \
+    do { \
+        TEST_ASSERT(!script_mismatch); \
+        TEST_ASSERT_EQUAL_INT(script.size(), script_pos); \
+    } while (0)
+
+static void setUp(void)
+{
+    script.clear();
+    script_pos = 0;
+    script_mismatch = false;
+}
+
+#define RUN_TEST(test) \
+    do { \
+        setUp(); \
+        TEST_RUN(test); \
+    } while (0)
+
+// Pointers should point here
+static int16_t ambient_new_raw = 0;
+static int16_t ambient_old_raw = 0;
+static int16_t object_new_raw = 0;
+static int16_t object_old_raw = 0;
+
+static void test_trigger_measurement_success(void)
+{
+    uint16_t reg_status_mock = 0x0087; // cycle position 1 & data ready
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock & (~MLX90632_STAT_DATA_RDY));
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::trigger_measurement());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_trigger_measurement_errors(void)
+{
+    uint16_t reg_status_mock = 0x0087; // cycle position 1 & data ready
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::trigger_measurement());
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock & (~MLX90632_STAT_DATA_RDY), -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::trigger_measurement());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_wait_for_measurement_one_wait(void)
+{
+    expect_read(MLX90632_REG_STATUS, 0x0C86); // cycle position 1 & data not ready
+    expect('u', 10000, 11000, 0);
+    expect_read(MLX90632_REG_STATUS, 0x0087); // cycle position 1 & data ready
+
+    TEST_ASSERT_EQUAL_INT(1, Sensor::wait_for_measurement());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_wait_for_measurement_error(void)
+{
+    expect_read(MLX90632_REG_STATUS, 0x0087, -EPERM);
+
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::wait_for_measurement());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_wait_for_measurement_timeout(void)
+{
+    for (int i = 0; i < MLX90632_MAX_NUMBER_MESUREMENT_READ_TRIES; ++i)
+    {
+        expect_read(MLX90632_REG_STATUS, 0x0C86); // cycle position 1 & data not ready
+        expect('u', 10000, 11000, 0);
+    }
+
+    TEST_ASSERT_EQUAL_INT(-ETIMEDOUT, Sensor::wait_for_measurement());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_poll_measurement(void)
+{
+    expect_read(MLX90632_REG_STATUS, 0x0C86); // cycle position 1 & data not ready
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, Sensor::poll_measurement());
+
+    expect_read(MLX90632_REG_STATUS, 0x008B); // cycle position 2 & data ready
+    TEST_ASSERT_EQUAL_INT(2, Sensor::poll_measurement());
+
+    expect_read(MLX90632_REG_STATUS, 0x008B, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::poll_measurement());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_start_measurement_one_wait(void)
+{
+    uint16_t reg_status_mock = 0x0C86; // cycle position 1 & data not ready
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock & (~MLX90632_STAT_DATA_RDY));
+    expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    expect('u', 10000, 11000, 0);
+    expect_read(MLX90632_REG_STATUS, 0x0087); // cycle position 1 & data ready
+
+    TEST_ASSERT_EQUAL_INT(1, Sensor::start_measurement());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_start_measurement_errors(void)
+{
+    uint16_t reg_status_mock = 0x0C86; // cycle position 1 & data not ready
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::start_measurement());
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock & (~MLX90632_STAT_DATA_RDY), -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::start_measurement());
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock & (~MLX90632_STAT_DATA_RDY));
+    expect_read(MLX90632_REG_STATUS, reg_status_mock, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::start_measurement());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+/** Channel 1 values are read as new and channel 2 values as old */
+static void test_read_temp_raw_wo_wait_ch1_success(void)
+{
+    expect_read(MLX90632_RAM_3(1), 22454);
+    expect_read(MLX90632_RAM_3(2), 23030);
+    expect_read(MLX90632_RAM_2(1), 150);
+    expect_read(MLX90632_RAM_1(1), 150);
+    expect_read(MLX90632_RAM_2(2), 140);
+    expect_read(MLX90632_RAM_1(2), 140);
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::read_temp_raw_wo_wait(1, &ambient_new_raw, &ambient_old_raw,
+                                                           &object_new_raw, &object_old_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+    TEST_ASSERT_EQUAL_INT(22454, ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT(23030, ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT(150, object_new_raw);
+    TEST_ASSERT_EQUAL_INT(140, object_old_raw);
+}
+
+/** Channel 2 values are read as new and channel 1 values as old */
+static void test_read_temp_raw_wo_wait_ch2_success(void)
+{
+    expect_read(MLX90632_RAM_3(1), 22454);
+    expect_read(MLX90632_RAM_3(2), 23030);
+    expect_read(MLX90632_RAM_2(2), 150);
+    expect_read(MLX90632_RAM_1(2), 150);
+    expect_read(MLX90632_RAM_2(1), 140);
+    expect_read(MLX90632_RAM_1(1), 140);
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::read_temp_raw_wo_wait(2, &ambient_new_raw, &ambient_old_raw,
+                                                           &object_new_raw, &object_old_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+    TEST_ASSERT_EQUAL_INT(150, object_new_raw);
+    TEST_ASSERT_EQUAL_INT(140, object_old_raw);
+}
+
+static void test_read_temp_raw_wo_wait_error(void)
+{
+    expect_read(MLX90632_RAM_3(1), 22454, -EPERM);
+
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::read_temp_raw_wo_wait(1, &ambient_new_raw, &ambient_old_raw,
+                                                                &object_new_raw, &object_old_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+/** Start measurement returns channel 1, then raw values of channel 1 are read as new */
+static void test_read_temp_raw_ch1_success(void)
+{
+    uint16_t reg_status_mock = 0x0087; // cycle position 1 & data ready
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock & (~MLX90632_STAT_DATA_RDY));
+    expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    expect_read(MLX90632_RAM_3(1), 22454);
+    expect_read(MLX90632_RAM_3(2), 23030);
+    expect_read(MLX90632_RAM_2(1), 150);
+    expect_read(MLX90632_RAM_1(1), 150);
+    expect_read(MLX90632_RAM_2(2), 140);
+    expect_read(MLX90632_RAM_1(2), 140);
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::read_temp_raw(&ambient_new_raw, &ambient_old_raw,
+                                                   &object_new_raw, &object_old_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+    TEST_ASSERT_EQUAL_INT(150, object_new_raw);
+    TEST_ASSERT_EQUAL_INT(140, object_old_raw);
+}
+
+static void expect_read_extended_ram(void)
+{
+    expect_read(MLX90632_RAM_3(17), 22454);
+    expect_read(MLX90632_RAM_3(18), 23030);
+    expect_read(MLX90632_RAM_1(17), 250);
+    expect_read(MLX90632_RAM_2(17), (uint16_t)-25);
+    expect_read(MLX90632_RAM_1(18), (uint16_t)-35);
+    expect_read(MLX90632_RAM_2(18), 260);
+    expect_read(MLX90632_RAM_1(19), 4);
+    expect_read(MLX90632_RAM_2(19), (uint16_t)-2);
+}
+
+static void test_read_temp_raw_extended_wo_wait_success(void)
+{
+    expect_read_extended_ram();
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::read_temp_raw_extended_wo_wait(&ambient_new_raw, &ambient_old_raw,
+                                                                    &object_new_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+    TEST_ASSERT_EQUAL_INT(22454, ambient_new_raw);
+    TEST_ASSERT_EQUAL_INT(23030, ambient_old_raw);
+    TEST_ASSERT_EQUAL_INT(287, object_new_raw);
+}
+
+static void test_read_temp_raw_extended_wo_wait_errors(void)
+{
+    expect_read(MLX90632_RAM_3(17), 22454, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::read_temp_raw_extended_wo_wait(&ambient_new_raw, &ambient_old_raw,
+                                                                         &object_new_raw));
+
+    expect_read(MLX90632_RAM_3(17), 22454);
+    expect_read(MLX90632_RAM_3(18), 23030);
+    expect_read(MLX90632_RAM_1(17), 250, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::read_temp_raw_extended_wo_wait(&ambient_new_raw, &ambient_old_raw,
+                                                                         &object_new_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+/** Measurements are started until position 19 ends the table, then extended RAM is read */
+static void test_read_temp_raw_extended_success(void)
+{
+    uint16_t reg_status_mock2 = 0x00C9; // cycle position 18 & data ready
+    uint16_t reg_status_mock3 = 0x00CF; // cycle position 19 & data ready
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock3);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock3 & (~MLX90632_STAT_DATA_RDY));
+    expect_read(MLX90632_REG_STATUS, reg_status_mock3);
+    expect_read_extended_ram();
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::read_temp_raw_extended(&ambient_new_raw, &ambient_old_raw, &object_new_raw));
+    TEST_ASSERT_EQUAL_INT(287, object_new_raw);
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock2);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock2 & (~MLX90632_STAT_DATA_RDY));
+    expect_read(MLX90632_REG_STATUS, reg_status_mock2);
+    expect_read(MLX90632_REG_STATUS, reg_status_mock3);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock3 & (~MLX90632_STAT_DATA_RDY));
+    expect_read(MLX90632_REG_STATUS, reg_status_mock3);
+    expect_read_extended_ram();
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::read_temp_raw_extended(&ambient_new_raw, &ambient_old_raw, &object_new_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_wait_for_measurement_retries_exhaust(void)
+{
+    uint16_t reg_status_mock = 0x0CC9; // cycle position 18 & data ready
+
+    for (int i = 0; i < 3; ++i)
+    {
+        expect_read(MLX90632_REG_STATUS, reg_status_mock);
+        expect_write(MLX90632_REG_STATUS, reg_status_mock & (~MLX90632_STAT_DATA_RDY));
+        expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    }
+
+    TEST_ASSERT_EQUAL_INT(-ETIMEDOUT, Sensor::read_temp_raw_extended(&ambient_new_raw, &ambient_old_raw,
+                                                                     &object_new_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_trigger_measurement_burst_errors(void)
+{
+    uint16_t reg_ctrl_mock = 0x0002; // medical sleeping step meas selected
+
+    expect_read(MLX90632_REG_CTRL, reg_ctrl_mock, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::trigger_measurement_burst());
+
+    expect_read(MLX90632_REG_CTRL, reg_ctrl_mock);
+    expect_write(MLX90632_REG_CTRL, reg_ctrl_mock | MLX90632_START_BURST_MEAS, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::trigger_measurement_burst());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_wait_for_measurement_burst_timeout(void)
+{
+    for (int i = 0; i < MLX90632_MAX_NUMBER_MESUREMENT_READ_TRIES; ++i)
+    {
+        expect_read(MLX90632_REG_STATUS, 0x0C06); // cycle position 1 & device busy
+        expect('u', 10000, 11000, 0);
+    }
+
+    TEST_ASSERT_EQUAL_INT(-ETIMEDOUT, Sensor::wait_for_measurement_burst());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+/** Burst is triggered, dataset ready time is slept and medical RAM of position 2 is read */
+static void test_read_temp_raw_burst_success(void)
+{
+    uint16_t reg_ctrl_mock = 0x0002; // medical sleeping step meas selected
+
+    expect_read(MLX90632_REG_CTRL, reg_ctrl_mock);
+    expect_write(MLX90632_REG_CTRL, reg_ctrl_mock | MLX90632_START_BURST_MEAS);
+    expect_read(MLX90632_REG_CTRL, reg_ctrl_mock);
+    expect_read(MLX90632_EE_MEDICAL_MEAS1, 0x820D);
+    expect_read(MLX90632_EE_MEDICAL_MEAS2, 0x821D);
+    expect('m', 1000, 0, 0);
+    expect_read(MLX90632_REG_STATUS, 0x010B); // cycle position 2 & data ready & device not busy
+    expect_read(MLX90632_RAM_3(1), 22454);
+    expect_read(MLX90632_RAM_3(2), 23030);
+    expect_read(MLX90632_RAM_2(2), 150);
+    expect_read(MLX90632_RAM_1(2), 150);
+    expect_read(MLX90632_RAM_2(1), 140);
+    expect_read(MLX90632_RAM_1(1), 140);
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::read_temp_raw_burst(&ambient_new_raw, &ambient_old_raw,
+                                                         &object_new_raw, &object_old_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+    TEST_ASSERT_EQUAL_INT(150, object_new_raw);
+    TEST_ASSERT_EQUAL_INT(140, object_old_raw);
+}
+
+static void test_read_temp_raw_extended_burst_success(void)
+{
+    uint16_t reg_ctrl_mock = 0x0112; // extended sleeping step meas selected
+
+    expect_read(MLX90632_REG_CTRL, reg_ctrl_mock);
+    expect_write(MLX90632_REG_CTRL, reg_ctrl_mock | MLX90632_START_BURST_MEAS);
+    expect_read(MLX90632_REG_CTRL, reg_ctrl_mock);
+    expect_read(MLX90632_EE_EXTENDED_MEAS1, 0x8300);
+    expect_read(MLX90632_EE_EXTENDED_MEAS2, 0x8312);
+    expect_read(MLX90632_EE_EXTENDED_MEAS3, 0x830C);
+    expect('m', 750, 0, 0);
+    expect_read(MLX90632_REG_STATUS, 0x01CF); // cycle position 19 & data ready & device not busy
+    expect_read_extended_ram();
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::read_temp_raw_extended_burst(&ambient_new_raw, &ambient_old_raw,
+                                                                  &object_new_raw));
+    TEST_ASSERT_SCRIPT_DONE();
+    TEST_ASSERT_EQUAL_INT(287, object_new_raw);
+}
+
+static void test_trigger_measurement_single_success(void)
+{
+    uint16_t reg_status_mock = 0x0087; // cycle position 1 & data ready
+    uint16_t reg_ctrl_mock = 0x0002; // medical sleeping step meas selected
+
+    expect_read(MLX90632_REG_STATUS, reg_status_mock);
+    expect_write(MLX90632_REG_STATUS, reg_status_mock & (~MLX90632_STAT_DATA_RDY));
+    expect_read(MLX90632_REG_CTRL, reg_ctrl_mock);
+    expect_write(MLX90632_REG_CTRL, reg_ctrl_mock | MLX90632_START_SINGLE_MEAS);
+
+    TEST_ASSERT_EQUAL_INT(0, Sensor::trigger_measurement_single());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_calculate_dataset_ready_time_success(void)
+{
+    static const int med_waiting_time[] = { 4000, 2000, 1000, 500, 250, 124, 62, 30 };
+    static const int ext_waiting_time[] = { 6000, 3000, 1500, 750, 375, 186, 93, 45 };
+
+    for (uint16_t i = 0; i < 8; i++)
+    {
+        expect_read(MLX90632_REG_CTRL, 0x0002); // medical sleeping step meas selected
+        expect_read(MLX90632_EE_MEDICAL_MEAS1, 0x800D | (i << 8));
+        expect_read(MLX90632_EE_MEDICAL_MEAS2, 0x801D | (i << 8));
+        TEST_ASSERT_EQUAL_INT(med_waiting_time[i], Sensor::calculate_dataset_ready_time());
+
+        expect_read(MLX90632_REG_CTRL, 0x0112); // extended sleeping step meas selected
+        expect_read(MLX90632_EE_EXTENDED_MEAS1, 0x8000 | (i << 8));
+        expect_read(MLX90632_EE_EXTENDED_MEAS2, 0x8012 | (i << 8));
+        expect_read(MLX90632_EE_EXTENDED_MEAS3, 0x800C | (i << 8));
+        TEST_ASSERT_EQUAL_INT(ext_waiting_time[i], Sensor::calculate_dataset_ready_time());
+    }
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_get_channel_position(void)
+{
+    expect_read(MLX90632_REG_STATUS, 0x008B); // cycle position 2 & data ready
+    TEST_ASSERT_EQUAL_INT(2, Sensor::get_channel_position());
+
+    expect_read(MLX90632_REG_STATUS, 0x00CF); // cycle position 19 & data ready
+    TEST_ASSERT_EQUAL_INT(19, Sensor::get_channel_position());
+
+    expect_read(MLX90632_REG_STATUS, 0x0087, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::get_channel_position());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+/** Addressed reset followed by halt with the new type and start in the new power mode */
+static void expect_set_meas_type(uint16_t reg_ctrl, uint16_t reg_halt, uint16_t reg_final)
+{
+    expect_read(MLX90632_REG_CTRL, reg_ctrl);
+    expect_write(MLX90632_REG_CTRL, (reg_ctrl & ~MLX90632_CFG_PWR_MASK) | MLX90632_PWR_STATUS_STEP);
+    expect_write(0x3005, MLX90632_RESET_CMD);
+    expect('u', 150, 200, 0);
+    expect_write(MLX90632_REG_CTRL, reg_ctrl);
+    expect_read(MLX90632_REG_CTRL, reg_ctrl);
+    expect_write(MLX90632_REG_CTRL, reg_halt);
+    expect_read(MLX90632_REG_CTRL, reg_halt);
+    expect_write(MLX90632_REG_CTRL, reg_final);
+}
+
+static void test_set_meas_type_success(void)
+{
+    expect_set_meas_type(0xFE0F, 0xFF19, 0xFF1F);
+    TEST_ASSERT_EQUAL_INT(0, Sensor::set_meas_type(MLX90632_MTYP_EXTENDED));
+
+    expect_set_meas_type(0xFF1F, 0xFE09, 0xFE0F);
+    TEST_ASSERT_EQUAL_INT(0, Sensor::set_meas_type(MLX90632_MTYP_MEDICAL));
+
+    expect_set_meas_type(0xFE0F, 0xFE09, 0xFE0B);
+    TEST_ASSERT_EQUAL_INT(0, Sensor::set_meas_type(MLX90632_MTYP_MEDICAL_BURST));
+
+    expect_set_meas_type(0xFE0B, 0xFF19, 0xFF1B);
+    TEST_ASSERT_EQUAL_INT(0, Sensor::set_meas_type(MLX90632_MTYP_EXTENDED_BURST));
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_set_meas_type_errors(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EINVAL, Sensor::set_meas_type(9));
+
+    expect_read(MLX90632_REG_CTRL, 0xFE0F, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::set_meas_type(MLX90632_MTYP_EXTENDED));
+
+    expect_read(MLX90632_REG_CTRL, 0xFE0F);
+    expect_write(MLX90632_REG_CTRL, 0xFE0D);
+    expect_write(0x3005, MLX90632_RESET_CMD, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::set_meas_type(MLX90632_MTYP_EXTENDED));
+
+    expect_read(MLX90632_REG_CTRL, 0xFE0F);
+    expect_write(MLX90632_REG_CTRL, 0xFE0D);
+    expect_write(0x3005, MLX90632_RESET_CMD);
+    expect('u', 150, 200, 0);
+    expect_write(MLX90632_REG_CTRL, 0xFE0F);
+    expect_read(MLX90632_REG_CTRL, 0xFE0F);
+    expect_write(MLX90632_REG_CTRL, 0xFF19);
+    expect_read(MLX90632_REG_CTRL, 0xFF19, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::set_meas_type(MLX90632_MTYP_EXTENDED));
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+static void test_get_meas_type(void)
+{
+    expect_read(MLX90632_REG_CTRL, 0xFE0F);
+    TEST_ASSERT_EQUAL_INT(MLX90632_MTYP_MEDICAL, Sensor::get_meas_type());
+
+    expect_read(MLX90632_REG_CTRL, 0xFF1F);
+    TEST_ASSERT_EQUAL_INT(MLX90632_MTYP_EXTENDED, Sensor::get_meas_type());
+
+    expect_read(MLX90632_REG_CTRL, 0xFE02);
+    TEST_ASSERT_EQUAL_INT(MLX90632_MTYP_MEDICAL_BURST, Sensor::get_meas_type());
+
+    expect_read(MLX90632_REG_CTRL, 0xFF12);
+    TEST_ASSERT_EQUAL_INT(MLX90632_MTYP_EXTENDED_BURST, Sensor::get_meas_type());
+
+    expect_read(MLX90632_REG_CTRL, 0xFE9F, -EPERM);
+    TEST_ASSERT_EQUAL_INT(-EPERM, Sensor::get_meas_type());
+
+    expect_read(MLX90632_REG_CTRL, 0xFE9F); // invalid measurement type
+    TEST_ASSERT_EQUAL_INT(-EINVAL, Sensor::get_meas_type());
+
+    expect_read(MLX90632_REG_CTRL, 0xFE04); // invalid operating mode
+    TEST_ASSERT_EQUAL_INT(-EINVAL, Sensor::get_meas_type());
+    TEST_ASSERT_SCRIPT_DONE();
+}
+
+int main(void)
+{
+    RUN_TEST(test_trigger_measurement_success);
+    RUN_TEST(test_trigger_measurement_errors);
+    RUN_TEST(test_wait_for_measurement_one_wait);
+    RUN_TEST(test_wait_for_measurement_error);
+    RUN_TEST(test_wait_for_measurement_timeout);
+    RUN_TEST(test_poll_measurement);
+    RUN_TEST(test_start_measurement_one_wait);
+    RUN_TEST(test_start_measurement_errors);
+    RUN_TEST(test_read_temp_raw_wo_wait_ch1_success);
+    RUN_TEST(test_read_temp_raw_wo_wait_ch2_success);
+    RUN_TEST(test_read_temp_raw_wo_wait_error);
+    RUN_TEST(test_read_temp_raw_ch1_success);
+    RUN_TEST(test_read_temp_raw_extended_wo_wait_success);
+    RUN_TEST(test_read_temp_raw_extended_wo_wait_errors);
+    RUN_TEST(test_read_temp_raw_extended_success);
+    RUN_TEST(test_wait_for_measurement_retries_exhaust);
+    RUN_TEST(test_trigger_measurement_burst_errors);
+    RUN_TEST(test_wait_for_measurement_burst_timeout);
+    RUN_TEST(test_read_temp_raw_burst_success);
+    RUN_TEST(test_read_temp_raw_extended_burst_success);
+    RUN_TEST(test_trigger_measurement_single_success);
+    RUN_TEST(test_calculate_dataset_ready_time_success);
+    RUN_TEST(test_get_channel_position);
+    RUN_TEST(test_set_meas_type_success);
+    RUN_TEST(test_set_meas_type_errors);
+    RUN_TEST(test_get_meas_type);
+
+    return TEST_REPORT("TestDriver");
+}
+
+///@}
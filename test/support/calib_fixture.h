@@ -0,0 +1,81 @@
+/**
+ * @file calib_fixture.h
+ * @brief Calibration parameters of the sensor used by unit tests, benchmarks and tools
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ * @addtogroup mlx90632_unit_tests
+ * @ingroup mlx90632
+ * @{
+ *
+ * @details
+ * Same parameters as in TestDSP.c, so expected temperatures of those tests apply. Values are available as single
+ * macros, as @link CALIB_FIXTURE @endlink initializer of mlx90632_calib_t, which needs mlx90632.h, and as the
+ * MLX90632_FIXED_ macros which mlx90632_fixed_calib.h expects, so this header needs to be included before it.
+ */
+#ifndef _MLX90632_CALIB_FIXTURE_
+#define _MLX90632_CALIB_FIXTURE_
+
+#define CALIB_FIXTURE_P_R 0x00587f5b
+#define CALIB_FIXTURE_P_G 0x04a10289
+#define CALIB_FIXTURE_P_T ((int32_t)0xfff966f8)
+#define CALIB_FIXTURE_P_O 0x00001e0f
+#define CALIB_FIXTURE_Ea 4859535
+#define CALIB_FIXTURE_Eb 5686508
+#define CALIB_FIXTURE_Fa 53855361
+#define CALIB_FIXTURE_Fb 42874149
+#define CALIB_FIXTURE_Ga (-14556410)
+#define CALIB_FIXTURE_Gb 9728
+#define CALIB_FIXTURE_Ka 10752
+#define CALIB_FIXTURE_Ha 16384
+#define CALIB_FIXTURE_Hb 0
+
+/** Initializer of mlx90632_calib_t with the fixture parameters */
+#define CALIB_FIXTURE { \
+        .P_R = CALIB_FIXTURE_P_R, \
+        .P_G = CALIB_FIXTURE_P_G, \
+        .P_T = CALIB_FIXTURE_P_T, \
+        .P_O = CALIB_FIXTURE_P_O, \
+        .Ea = CALIB_FIXTURE_Ea, \
+        .Eb = CALIB_FIXTURE_Eb, \
+        .Fa = CALIB_FIXTURE_Fa, \
+        .Fb = CALIB_FIXTURE_Fb, \
+        .Ga = CALIB_FIXTURE_Ga, \
+        .Gb = CALIB_FIXTURE_Gb, \
+        .Ka = CALIB_FIXTURE_Ka, \
+        .Ha = CALIB_FIXTURE_Ha, \
+        .Hb = CALIB_FIXTURE_Hb, \
+}
+
+#define MLX90632_FIXED_P_R CALIB_FIXTURE_P_R
+#define MLX90632_FIXED_P_G CALIB_FIXTURE_P_G
+#define MLX90632_FIXED_P_T CALIB_FIXTURE_P_T
+#define MLX90632_FIXED_P_O CALIB_FIXTURE_P_O
+#define MLX90632_FIXED_Ea CALIB_FIXTURE_Ea
+#define MLX90632_FIXED_Eb CALIB_FIXTURE_Eb
+#define MLX90632_FIXED_Fa CALIB_FIXTURE_Fa
+#define MLX90632_FIXED_Fb CALIB_FIXTURE_Fb
+#define MLX90632_FIXED_Ga CALIB_FIXTURE_Ga
+#define MLX90632_FIXED_Gb CALIB_FIXTURE_Gb
+#define MLX90632_FIXED_Ka CALIB_FIXTURE_Ka
+#define MLX90632_FIXED_Ha CALIB_FIXTURE_Ha
+#define MLX90632_FIXED_Hb CALIB_FIXTURE_Hb
+
+///@}
+
+#endif
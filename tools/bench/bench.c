@@ -0,0 +1,90 @@
+/**
+ * @file bench.c
+ * @brief Helpers shared by host benchmarks of MLX90632 driver library
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+
+#include "mlx90632_depends.h"
+#include "bench.h"
+
+volatile double bench_sink;
+
+uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+void bench_report(const char *name, uint64_t elapsed_ns, uint32_t calls)
+{
+    printf("%-32s %10u calls %10.1f ns/call\n", name, calls, (double)elapsed_ns / calls);
+}
+
+int32_t mlx90632_i2c_read(int16_t register_address, uint16_t *value)
+{
+    (void)register_address;
+    (void)value;
+    return -ENODEV;
+}
+
+int32_t mlx90632_i2c_read_block(int16_t register_address, uint16_t *value, uint16_t words)
+{
+    (void)register_address;
+    (void)value;
+    (void)words;
+    return -ENODEV;
+}
+
+int32_t mlx90632_i2c_write(int16_t register_address, uint16_t value)
+{
+    (void)register_address;
+    (void)value;
+    return -ENODEV;
+}
+
+int32_t mlx90632_i2c_submit(mlx90632_i2c_xfer_t *xfer)
+{
+    (void)xfer;
+    return -ENODEV;
+}
+
+void usleep(int min_range, int max_range)
+{
+    (void)min_range;
+    (void)max_range;
+}
+
+void msleep(int msecs)
+{
+    (void)msecs;
+}
+
+uint64_t mlx90632_get_time_us(void)
+{
+    return bench_now_ns() / 1000;
+}
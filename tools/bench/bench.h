@@ -0,0 +1,46 @@
+/**
+ * @file bench.h
+ * @brief Helpers shared by host benchmarks of MLX90632 driver library
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ *
+ * Benchmarks are built on the host with the library sources and optimization enabled, and run with `make bench`.
+ * Register access functions of mlx90632_depends.h are stubs returning -ENODEV, so benchmarks measure only
+ * calculations.
+ */
+#ifndef _MLX90632_BENCH_
+#define _MLX90632_BENCH_
+
+#include <stdint.h>
+
+/** Result of the benchmarked calculations, keeps the compiler from removing them */
+extern volatile double bench_sink;
+
+/** Monotonic host time in nanoseconds */
+uint64_t bench_now_ns(void);
+
+/** Print one benchmark result line
+ *
+ * @param[in] name Name of the benchmarked path
+ * @param[in] elapsed_ns Time spent in all calls
+ * @param[in] calls Number of calls
+ */
+void bench_report(const char *name, uint64_t elapsed_ns, uint32_t calls);
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file bench_ambient_state.c
+ * @brief Benchmark of object temperature calculation with cached ambient terms
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * Steady operation is benchmarked: ambient raw values change once every 64 samples, as ambient temperature follows
+ * object temperature much slower. Both paths calculate ambient and object temperature from raw values.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "mlx90632_ambient_state.h"
+#include "bench.h"
+#include "calib_fixture.h"
+
+#define BENCH_CALLS 1000000
+#define AMBIENT_PERIOD 64 /**< Samples between changes of ambient raw values */
+
+static volatile mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static void runtime_calc_temp(int16_t ambient_new_raw, int16_t ambient_old_raw,
+                              int16_t object_new_raw, int16_t object_old_raw,
+                              double *ambient, double *object)
+{
+    double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib.Gb);
+    double pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                        ambient_new_raw, ambient_old_raw, calib.Ka);
+
+    *ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw,
+                                          calib.P_T, calib.P_R, calib.P_G, calib.P_O, calib.Gb);
+    *object = mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient,
+                                        calib.Ea, calib.Eb, calib.Ga, calib.Fa, calib.Fb, calib.Ha, calib.Hb);
+}
+
+int main(void)
+{
+    mlx90632_ambient_state_t state;
+    const mlx90632_calib_t *c = (const mlx90632_calib_t *)&calib;
+    double ambient, object, max_error = 0.0;
+    uint64_t start;
+    uint32_t i;
+
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+    {
+        runtime_calc_temp((int16_t)(22454 + i / AMBIENT_PERIOD % 64), 23030, (int16_t)(i & 0x3FFF),
+                          (int16_t)(i & 0x3FFF), &ambient, &object);
+        bench_sink = object;
+    }
+    bench_report("ambient recalculated", bench_now_ns() - start, BENCH_CALLS);
+
+    mlx90632_ambient_state_invalidate(&state);
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+    {
+        mlx90632_ambient_state_update(&state, (int16_t)(22454 + i / AMBIENT_PERIOD % 64), 23030, c);
+        bench_sink = state.ambient;
+        bench_sink = mlx90632_calc_temp_object_cached(&state, (int16_t)(i & 0x3FFF), (int16_t)(i & 0x3FFF));
+    }
+    bench_report("ambient state cached", bench_now_ns() - start, BENCH_CALLS);
+
+    for (i = 0; i < 0x4000; i += 16)
+    {
+        runtime_calc_temp(22454, 23030, (int16_t)i, (int16_t)i, &ambient, &object);
+        mlx90632_ambient_state_update(&state, 22454, 23030, c);
+        if (fabs(mlx90632_calc_temp_object_cached(&state, (int16_t)i, (int16_t)i) - object) > max_error)
+            max_error = fabs(mlx90632_calc_temp_object_cached(&state, (int16_t)i, (int16_t)i) - object);
+    }
+    printf("max difference of object temperature %g degC\n", max_error);
+
+    return 0;
+}
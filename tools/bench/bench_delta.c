@@ -0,0 +1,156 @@
+/**
+ * @file bench_delta.c
+ * @brief Benchmark of delta and varint encoding of temperature streams
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ *
+ * @endinternal
+ *
+ * Streams of 2 Hz samples are encoded and decoded with and without blocks. Throughput is given in MB/s of plain
+ * samples (8 byte timestamp, ambient and object temperature as doubles), and compression ratio against the same
+ * 24 bytes per sample. Synthetic stream is a slow random walk of smooth temperatures. Sensor stream goes through
+ * the calculation functions from raw values with a few LSB of noise, as recorded from a sensor looking at skin,
+ * so it includes the quantization and noise of real measurements.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "mlx90632_delta.h"
+#include "bench.h"
+#include "calib_fixture.h"
+
+#define SAMPLES 200000
+#define PERIOD_US 500000 /**< Sample period of the stream */
+#define BLOCK_SAMPLES 64 /**< Samples per block when stream is split into blocks */
+#define PLAIN_SIZE 24 /**< Bytes of a plain sample */
+
+static volatile mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static uint64_t timestamp[SAMPLES];
+static double ambient[SAMPLES], object[SAMPLES];
+static uint8_t stream[SAMPLES * MLX90632_DELTA_RECORD_MAX];
+static uint32_t rng = 12345;
+
+/** Deterministic pseudo random number in -1 to 1 */
+static double noise(void)
+{
+    rng = rng * 1103515245u + 12345u;
+    return ((rng >> 8) & 0xFFFF) / 32768.0 - 1.0;
+}
+
+/** Timestamps at fixed rate with a few microseconds of jitter of the host timer */
+static void make_timestamps(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < SAMPLES; ++i)
+        timestamp[i] = 1000000 + (uint64_t)i * PERIOD_US + (uint64_t)(20.0 + 20.0 * noise());
+}
+
+static void make_synthetic(void)
+{
+    double a = 25.0, o = 36.5;
+    uint32_t i;
+
+    for (i = 0; i < SAMPLES; ++i)
+    {
+        a += 0.0005 * noise();
+        o += 0.002 * noise();
+        ambient[i] = a;
+        object[i] = o;
+    }
+}
+
+static void make_sensor(void)
+{
+    const mlx90632_calib_t *c = (const mlx90632_calib_t *)&calib;
+    double walk = 0.0;
+    uint32_t i;
+
+    for (i = 0; i < SAMPLES; ++i)
+    {
+        int16_t ambient_new_raw = (int16_t)(22454 + lrint(2.0 * noise()));
+        int16_t ambient_old_raw = (int16_t)(23030 + lrint(2.0 * noise()));
+        int16_t object_new_raw, object_old_raw;
+        double pre_ambient, pre_object;
+
+        walk += 0.2 * noise();
+        object_new_raw = (int16_t)(610 + lrint(walk + 3.0 * noise()));
+        object_old_raw = (int16_t)(610 + lrint(walk + 3.0 * noise()));
+
+        ambient[i] = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw, c->P_T, c->P_R, c->P_G, c->P_O,
+                                                c->Gb);
+        pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, c->Gb);
+        pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw, ambient_new_raw,
+                                                     ambient_old_raw, c->Ka);
+        object[i] = mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient, c->Ea, c->Eb, c->Ga,
+                                              c->Fa, c->Fb, c->Ha, c->Hb);
+    }
+}
+
+static void run(const char *name, uint32_t block_samples)
+{
+    mlx90632_delta_t delta;
+    uint64_t start, encode_ns, decode_ns, t;
+    double a, o, max_error = 0.0;
+    uint32_t i;
+
+    start = bench_now_ns();
+    mlx90632_delta_init(&delta, stream, sizeof(stream));
+    for (i = 0; i < SAMPLES; ++i)
+    {
+        if (block_samples && (i % block_samples == 0))
+            mlx90632_delta_block(&delta, timestamp[i]);
+        if (mlx90632_delta_put(&delta, timestamp[i], ambient[i], object[i]) < 0)
+            exit(1);
+    }
+    encode_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    mlx90632_delta_init(&delta, stream, delta.pos);
+    for (i = 0; i < SAMPLES; ++i)
+    {
+        if ((mlx90632_delta_get(&delta, &t, &a, &o) < 0) || (t != timestamp[i]))
+            exit(1);
+        max_error = fmax(max_error, fmax(fabs(a - ambient[i]), fabs(o - object[i])));
+    }
+    decode_ns = bench_now_ns() - start;
+    bench_sink = max_error;
+
+    printf("%-32s %6.2f bytes/sample  ratio %5.1f  encode %7.1f MB/s  decode %7.1f MB/s  max error %.4f degC\n",
+           name, (double)delta.size / SAMPLES, (double)SAMPLES * PLAIN_SIZE / delta.size,
+           SAMPLES * PLAIN_SIZE * 1e3 / encode_ns, SAMPLES * PLAIN_SIZE * 1e3 / decode_ns, max_error);
+}
+
+int main(void)
+{
+    make_timestamps();
+
+    make_synthetic();
+    run("synthetic stream", 0);
+    run("synthetic stream, blocks of 64", BLOCK_SAMPLES);
+
+    make_sensor();
+    run("sensor stream", 0);
+    run("sensor stream, blocks of 64", BLOCK_SAMPLES);
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file bench_emissivity.c
+ * @brief Benchmark of object temperature under several emissivities
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * One sample is evaluated under 8 candidate emissivities, once with emissivity set and object temperature
+ * calculated per candidate and once with the batch function.
+ *
+ * Emissivity of a recorded dataset with reference temperatures is estimated once by sweeping candidate
+ * emissivities, as done during commissioning, and once with the emissivity fit.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "mlx90632_emissivity.h"
+#include "bench.h"
+#include "calib_fixture.h"
+
+#define BENCH_CALLS 200000
+#define CANDIDATES 8
+#define DATASET 100000 /**< Samples in the emissivity estimation dataset */
+#define SWEEP_STEPS 101 /**< Candidates of the emissivity sweep from 0.5 to 1.0 */
+#define DATASET_EMISSIVITY 0.83 /**< Emissivity the dataset is generated with */
+#define DATASET_REFLECTED 30.0 /**< Reflected temperature the dataset is generated with */
+
+static volatile mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static const double emissivity[CANDIDATES] = { 1.0, 0.95, 0.9, 0.85, 0.8, 0.7, 0.6, 0.5 };
+
+static void per_candidate(int16_t object_raw, double *object)
+{
+    uint16_t c;
+
+    for (c = 0; c < CANDIDATES; ++c)
+    {
+        double pre_ambient = mlx90632_preprocess_temp_ambient(22454, 23030, calib.Gb);
+        double pre_object = mlx90632_preprocess_temp_object(object_raw, object_raw, 22454, 23030, calib.Ka);
+
+        mlx90632_set_emissivity(emissivity[c]);
+        object[c] = mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient, calib.Ea, calib.Eb,
+                                              calib.Ga, calib.Fa, calib.Fb, calib.Ha, calib.Hb);
+    }
+    mlx90632_set_emissivity(1.0);
+}
+
+static int16_t dataset_raw[DATASET];
+static double dataset_reference[DATASET];
+
+static double calc_reflected(int16_t object_raw)
+{
+    double pre_ambient = mlx90632_preprocess_temp_ambient(22454, 23030, calib.Gb);
+    double pre_object = mlx90632_preprocess_temp_object(object_raw, object_raw, 22454, 23030, calib.Ka);
+
+    return mlx90632_calc_temp_object_reflected((int32_t)pre_object, (int32_t)pre_ambient, DATASET_REFLECTED,
+                                               calib.Ea, calib.Eb, calib.Ga, calib.Fa, calib.Fb, calib.Ha, calib.Hb);
+}
+
+static void estimation(void)
+{
+    const mlx90632_calib_t *c = (const mlx90632_calib_t *)&calib;
+    mlx90632_emissivity_fit_t fit;
+    double best = 0.0, best_error = INFINITY, fitted;
+    uint64_t start;
+    uint32_t i, k;
+
+    mlx90632_set_emissivity(DATASET_EMISSIVITY);
+    for (i = 0; i < DATASET; ++i)
+    {
+        dataset_raw[i] = (int16_t)(i % 8000);
+        dataset_reference[i] = calc_reflected(dataset_raw[i]) + 0.01 * ((int32_t)(i % 11) - 5);
+    }
+
+    start = bench_now_ns();
+    for (k = 0; k < SWEEP_STEPS; ++k)
+    {
+        double e = 0.5 + 0.5 * k / (SWEEP_STEPS - 1), error = 0.0;
+
+        mlx90632_set_emissivity(e);
+        for (i = 0; i < DATASET; ++i)
+            error += pow(calc_reflected(dataset_raw[i]) - dataset_reference[i], 2);
+        if (error < best_error)
+        {
+            best_error = error;
+            best = e;
+        }
+    }
+    mlx90632_set_emissivity(1.0);
+    printf("%-32s %10u samples %10.1f ms  emissivity %.4f\n", "sweep of emissivity", DATASET,
+           (bench_now_ns() - start) / 1e6, best);
+
+    start = bench_now_ns();
+    mlx90632_emissivity_fit_init(&fit);
+    for (i = 0; i < DATASET; ++i)
+        mlx90632_emissivity_fit_add(&fit, c, 22454, 23030, dataset_raw[i], dataset_raw[i], dataset_reference[i]);
+    mlx90632_emissivity_fit_solve_with_reflected(&fit, DATASET_REFLECTED, &fitted);
+    printf("%-32s %10u samples %10.1f ms  emissivity %.4f\n", "emissivity fit", DATASET,
+           (bench_now_ns() - start) / 1e6, fitted);
+}
+
+int main(void)
+{
+    const mlx90632_calib_t *c = (const mlx90632_calib_t *)&calib;
+    double object[CANDIDATES], batch[CANDIDATES], max_error = 0.0;
+    uint64_t start;
+    uint32_t i, k;
+
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+    {
+        per_candidate((int16_t)(i & 0x3FFF), object);
+        bench_sink = object[CANDIDATES - 1];
+    }
+    bench_report("set emissivity per candidate", bench_now_ns() - start, BENCH_CALLS);
+
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+    {
+        mlx90632_calc_temp_object_emissivities(c, 22454, 23030, (int16_t)(i & 0x3FFF), (int16_t)(i & 0x3FFF),
+                                               emissivity, object, CANDIDATES);
+        bench_sink = object[CANDIDATES - 1];
+    }
+    bench_report("emissivities batch", bench_now_ns() - start, BENCH_CALLS);
+
+    for (i = 0; i < 0x4000; i += 16)
+    {
+        per_candidate((int16_t)i, object);
+        mlx90632_calc_temp_object_emissivities(c, 22454, 23030, (int16_t)i, (int16_t)i, emissivity, batch,
+                                               CANDIDATES);
+        for (k = 0; k < CANDIDATES; ++k)
+            max_error = fmax(max_error, fabs(object[k] - batch[k]));
+    }
+    printf("max difference of object temperature %g degC\n", max_error);
+
+    estimation();
+
+    return 0;
+}
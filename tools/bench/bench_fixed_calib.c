@@ -0,0 +1,88 @@
+/**
+ * @file bench_fixed_calib.c
+ * @brief Benchmark of calculations with compile-time calibration against runtime calibration
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @endinternal
+ *
+ *
+ * Both paths calculate ambient and object temperature from the same raw values. Calibration of the runtime path is
+ * read through volatile storage, like it would be read from EEPROM, so the compiler cannot fold it.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "bench.h"
+#include "calib_fixture.h"
+
+#include "mlx90632_fixed_calib.h"
+
+#define BENCH_CALLS 1000000
+
+static volatile mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static void runtime_calc_temp(int16_t ambient_new_raw, int16_t ambient_old_raw,
+                              int16_t object_new_raw, int16_t object_old_raw,
+                              double *ambient, double *object)
+{
+    double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib.Gb);
+    double pre_object = mlx90632_preprocess_temp_object(object_new_raw, object_old_raw,
+                                                        ambient_new_raw, ambient_old_raw, calib.Ka);
+
+    *ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw,
+                                          calib.P_T, calib.P_R, calib.P_G, calib.P_O, calib.Gb);
+    *object = mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient,
+                                        calib.Ea, calib.Eb, calib.Ga, calib.Fa, calib.Fb, calib.Ha, calib.Hb);
+}
+
+int main(void)
+{
+    double ambient, object, max_error = 0.0;
+    uint64_t start;
+    uint32_t i;
+
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+    {
+        runtime_calc_temp(22454, 23030, (int16_t)(i & 0x3FFF), (int16_t)(i & 0x3FFF), &ambient, &object);
+        bench_sink = object;
+    }
+    bench_report("runtime calibration", bench_now_ns() - start, BENCH_CALLS);
+
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+    {
+        mlx90632_fixed_calc_temp(22454, 23030, (int16_t)(i & 0x3FFF), (int16_t)(i & 0x3FFF), &ambient, &object);
+        bench_sink = object;
+    }
+    bench_report("fixed calibration", bench_now_ns() - start, BENCH_CALLS);
+
+    for (i = 0; i < 0x4000; i += 16)
+    {
+        double runtime_ambient, runtime_object;
+
+        runtime_calc_temp(22454, 23030, (int16_t)i, (int16_t)i, &runtime_ambient, &runtime_object);
+        mlx90632_fixed_calc_temp(22454, 23030, (int16_t)i, (int16_t)i, &ambient, &object);
+        if (fabs(runtime_object - object) > max_error)
+            max_error = fabs(runtime_object - object);
+    }
+    printf("max difference of object temperature %g degC\n", max_error);
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file bench_lut.c
+ * @brief Benchmark and accuracy of interpolated lookup table against object temperature calculation
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * Maximum error against @link mlx90632_calc_temp_object @endlink is reported for several grid sizes over
+ * 10 to 60 degrees Celsius ambient and -20 to 200 degrees Celsius object temperature, which helps to pick grid size
+ * for the RAM available.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "mlx90632_lut.h"
+#include "bench.h"
+#include "calib_fixture.h"
+
+#define BENCH_CALLS 1000000
+#define MAX_POINTS 129
+#define AMBIENT_MIN 10.0 /**< Lowest ambient temperature of the table */
+#define AMBIENT_MAX 60.0 /**< Highest ambient temperature of the table */
+#define OBJECT_MIN -20.0 /**< Lowest object temperature of the table */
+#define OBJECT_MAX 200.0 /**< Highest object temperature of the table */
+
+static const mlx90632_calib_t calib = CALIB_FIXTURE;
+
+static int16_t table[MLX90632_LUT_SIZE(MAX_POINTS, MAX_POINTS)];
+
+static double reference(int16_t ambient_new_raw, int16_t ambient_old_raw, int16_t object_raw)
+{
+    double pre_ambient = mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, calib.Gb);
+    double pre_object = mlx90632_preprocess_temp_object(object_raw, object_raw, ambient_new_raw, ambient_old_raw,
+                                                        calib.Ka);
+
+    return mlx90632_calc_temp_object((int32_t)pre_object, (int32_t)pre_ambient,
+                                     calib.Ea, calib.Eb, calib.Ga, calib.Fa, calib.Fb, calib.Ha, calib.Hb);
+}
+
+/** Maximum error of table over raw values inside of ambient and object temperature range */
+static double max_error(const mlx90632_lut_t *lut)
+{
+    double max = 0.0;
+    int32_t ambient_raw, object_raw, temp;
+
+    for (ambient_raw = 16000; ambient_raw <= 32000; ambient_raw += 250)
+    {
+        int16_t ambient_new_raw = (int16_t)ambient_raw, ambient_old_raw = (int16_t)(ambient_raw + 576);
+        double ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw,
+                                                    calib.P_T, calib.P_R, calib.P_G, calib.P_O, calib.Gb);
+
+        if (ambient < AMBIENT_MIN || ambient > AMBIENT_MAX)
+            continue;
+        for (object_raw = -32768; object_raw <= 32767; object_raw += 37)
+        {
+            double ref = reference(ambient_new_raw, ambient_old_raw, (int16_t)object_raw);
+
+            if (!(ref >= OBJECT_MIN && ref <= OBJECT_MAX))
+                continue;
+            if (mlx90632_lut_calc_temp_object(lut, ambient_new_raw, ambient_old_raw,
+                                              (int16_t)object_raw, (int16_t)object_raw, &temp) < 0)
+                return INFINITY;
+            max = fmax(max, fabs(temp / 1000.0 - ref));
+        }
+    }
+
+    return max;
+}
+
+int main(void)
+{
+    static const uint16_t sizes[][2] = { { 5, 17 }, { 9, 33 }, { 9, 65 }, { 17, 65 }, { 17, 129 }, { 33, 129 } };
+    mlx90632_lut_t lut;
+    uint64_t start;
+    uint32_t i;
+    int32_t temp;
+
+    mlx90632_lut_init(&lut, table, 9, 33, &calib, AMBIENT_MIN, AMBIENT_MAX, OBJECT_MIN, OBJECT_MAX);
+
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+        bench_sink = reference(22454, 23030, (int16_t)(i & 0x3FFF));
+    bench_report("calc_temp_object", bench_now_ns() - start, BENCH_CALLS);
+
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+    {
+        mlx90632_lut_calc_temp_object(&lut, 22454, 23030, (int16_t)(i & 0x3FFF), (int16_t)(i & 0x3FFF), &temp);
+        bench_sink = temp;
+    }
+    bench_report("lookup table", bench_now_ns() - start, BENCH_CALLS);
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        if (mlx90632_lut_init(&lut, table, sizes[i][0], sizes[i][1], &calib, AMBIENT_MIN, AMBIENT_MAX, OBJECT_MIN, OBJECT_MAX) < 0)
+            return 1;
+        printf("grid %3u x %3u %6u bytes  max error %8.4f degC\n", sizes[i][0], sizes[i][1],
+               (unsigned)(MLX90632_LUT_SIZE(sizes[i][0], sizes[i][1]) * sizeof(table[0])), max_error(&lut));
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file bench_newton.c
+ * @brief Benchmark and accuracy report of Newton object temperature solver against fixed-point iteration
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * Accuracy of both solvers is reported against the solution of the same DSPv5 equation converged in long double,
+ * over the medical and extended object range, several emissivities and Ga values. Inputs whose solution is outside
+ * of the object temperature range of the sensor are skipped.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "mlx90632.h"
+#include "mlx90632_newton.h"
+#include "calib_fixture.h"
+#include "bench.h"
+
+#define BENCH_CALLS 1000000
+#define MIN_OBJECT_TEMP -70.0 /**< Lower end of object temperature range of the sensor */
+#define MAX_OBJECT_TEMP 380.0 /**< Upper end of object temperature range of the sensor */
+
+static const int32_t Ea = CALIB_FIXTURE_Ea;
+static const int32_t Eb = CALIB_FIXTURE_Eb;
+static const int32_t Fa = CALIB_FIXTURE_Fa;
+static const int32_t Fb = CALIB_FIXTURE_Fb;
+static const int32_t Ga = CALIB_FIXTURE_Ga;
+static const int16_t Ha = CALIB_FIXTURE_Ha;
+static const int16_t Hb = CALIB_FIXTURE_Hb;
+static const int16_t Gb = CALIB_FIXTURE_Gb;
+static const int16_t Ka = CALIB_FIXTURE_Ka;
+
+/** Converged solution of object temperature equation with reflected temperature compensation */
+static double reference(int32_t object, int32_t ambient, double reflected, int32_t ga, int32_t fa)
+{
+    long double emissivity = mlx90632_get_emissivity();
+    long double TAdut = ((long double)ambient - Eb / 256.0L) / (Ea / 65536.0L) + 25;
+    long double Gbl = 1 + Fb * (TAdut - 25) / 68719476736.0L;
+    long double Alpha = fa * (Ha / 16384.0L) / 70368744177664.0L;
+    long double TaTr4 = powl(reflected + 273.15L, 4);
+    long double temp = 25.0L;
+    int i;
+
+    TaTr4 = TaTr4 - (TaTr4 - powl(TAdut + 273.15L, 4)) / emissivity;
+    for (i = 0; i < 200; ++i)
+    {
+        long double D = Gbl + ga / 68719476736.0L * (temp - 25);
+
+        temp = sqrtl(sqrtl(object / (emissivity * Alpha * D) + TaTr4)) - 273.15L - Hb / 1024.0L;
+    }
+
+    return (double)temp;
+}
+
+static void accuracy(void)
+{
+    static const double emissivities[] = { 1.0, 0.7, 0.4, 0.1 };
+    static const int32_t ga_scale[] = { 1, 3, -1 };
+    double max_iteration = 0.0, max_newton = 0.0, max_iteration_ext = 0.0, max_newton_ext = 0.0;
+    int32_t object, ambient, raw;
+    uint32_t e, g;
+
+    for (e = 0; e < sizeof(emissivities) / sizeof(emissivities[0]); ++e)
+    {
+        mlx90632_set_emissivity(emissivities[e]);
+        for (g = 0; g < sizeof(ga_scale) / sizeof(ga_scale[0]); ++g)
+        {
+            int32_t ga = Ga * ga_scale[g];
+
+            for (raw = 18000; raw <= 32000; raw += 2000)
+            {
+                int16_t ambient_new_raw = (int16_t)raw, ambient_old_raw = (int16_t)(raw + 576);
+                int16_t object_raw;
+                double ref, err;
+
+                for (object_raw = -2000; object_raw < 32000; object_raw += 500)
+                {
+                    ambient = (int32_t)mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, Gb);
+                    object = (int32_t)mlx90632_preprocess_temp_object(object_raw, object_raw, ambient_new_raw,
+                                                                      ambient_old_raw, Ka);
+                    ref = reference(object, ambient, 25.0, ga, Fa);
+                    if (!(ref > MIN_OBJECT_TEMP && ref < MAX_OBJECT_TEMP))
+                        continue;
+                    err = fabs(mlx90632_calc_temp_object_reflected(object, ambient, 25.0, Ea, Eb, ga, Fa, Fb,
+                                                                   Ha, Hb) - ref);
+                    max_iteration = err > max_iteration ? err : max_iteration;
+                    err = fabs(mlx90632_calc_temp_object_reflected_newton(object, ambient, 25.0, Ea, Eb, ga, Fa,
+                                                                          Fb, Ha, Hb) - ref);
+                    max_newton = err > max_newton ? err : max_newton;
+
+                    ambient = (int32_t)mlx90632_preprocess_temp_ambient_extended(ambient_new_raw, ambient_old_raw,
+                                                                                 Gb);
+                    object = (int32_t)mlx90632_preprocess_temp_object_extended(object_raw, ambient_new_raw,
+                                                                               ambient_old_raw, Ka);
+                    ref = reference(object, ambient, 25.0, ga, Fa / 2);
+                    if (!(ref > MIN_OBJECT_TEMP && ref < MAX_OBJECT_TEMP))
+                        continue;
+                    err = fabs(mlx90632_calc_temp_object_extended(object, ambient, 25.0, Ea, Eb, ga, Fa, Fb,
+                                                                  Ha, Hb) - ref);
+                    max_iteration_ext = err > max_iteration_ext ? err : max_iteration_ext;
+                    err = fabs(mlx90632_calc_temp_object_extended_newton(object, ambient, 25.0, Ea, Eb, ga, Fa,
+                                                                         Fb, Ha, Hb) - ref);
+                    max_newton_ext = err > max_newton_ext ? err : max_newton_ext;
+                }
+            }
+        }
+    }
+    mlx90632_set_emissivity(1.0);
+
+    printf("max error medical  iteration %9.3g degC  newton %9.3g degC\n", max_iteration, max_newton);
+    printf("max error extended iteration %9.3g degC  newton %9.3g degC\n", max_iteration_ext, max_newton_ext);
+}
+
+int main(void)
+{
+    int32_t ambient = (int32_t)mlx90632_preprocess_temp_ambient(22454, 23030, Gb);
+    uint64_t start;
+    uint32_t i;
+
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+        bench_sink = mlx90632_calc_temp_object((int32_t)(i & 0x7FFF), ambient, Ea, Eb, Ga, Fa, Fb, Ha, Hb);
+    bench_report("fixed-point iteration", bench_now_ns() - start, BENCH_CALLS);
+
+    start = bench_now_ns();
+    for (i = 0; i < BENCH_CALLS; ++i)
+        bench_sink = mlx90632_calc_temp_object_newton((int32_t)(i & 0x7FFF), ambient, Ea, Eb, Ga, Fa, Fb, Ha, Hb);
+    bench_report("newton", bench_now_ns() - start, BENCH_CALLS);
+
+    accuracy();
+
+    return 0;
+}
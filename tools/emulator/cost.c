@@ -0,0 +1,160 @@
+/**
+ * @file cost.c
+ * @brief Cost model of the acquisition functions checked against the emulated sensor
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * Every acquisition function known to mlx90632_cost.h is called in a loop for @link RUN_US @endlink of emulated
+ * time on a healthy sensor, after one call which is not counted. Measurement times are read from the emulated
+ * EEPROM with mlx90632_cost_sensor_read and the bus runs with the transaction times of the emulator.
+ *
+ * Predicted and emulated reads, writes and samples per sample and second are reported. Program exits with 1 when any
+ * of them differs by more than @link COST_LIMIT @endlink, so `make cost` fails when the driver and the model do not
+ * agree anymore.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_depends.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_single.h"
+#include "mlx90632_cost.h"
+#include "emulator.h"
+#include "calib_fixture.h"
+
+#define RUN_US 60000000ull /**< Emulated time of one run */
+#define SEED 1
+#define COST_LIMIT 0.05 /**< Largest relative difference between model and emulated run */
+
+static const mlx90632_calib_t calib = CALIB_FIXTURE;
+
+typedef struct workload_s {
+    const char *name;
+    mlx90632_cost_api_t api;
+    uint8_t meas_type; /**< Measurement type set at start */
+} workload_t;
+
+static const workload_t workloads[] = {
+    { "raw", MLX90632_COST_RAW, MLX90632_MTYP_MEDICAL },
+    { "raw burst", MLX90632_COST_RAW_BURST, MLX90632_MTYP_MEDICAL_BURST },
+    { "raw extended", MLX90632_COST_RAW_EXTENDED, MLX90632_MTYP_EXTENDED },
+    { "raw extended burst", MLX90632_COST_RAW_EXTENDED_BURST, MLX90632_MTYP_EXTENDED_BURST },
+    { "single", MLX90632_COST_SINGLE, MLX90632_MTYP_MEDICAL },
+};
+
+static int32_t call(mlx90632_cost_api_t api)
+{
+    int16_t ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw;
+    double ambient, object;
+    uint32_t latency_us;
+
+    switch (api)
+    {
+        case MLX90632_COST_RAW:
+            return mlx90632_read_temp_raw(&ambient_new_raw, &ambient_old_raw, &object_new_raw, &object_old_raw);
+
+        case MLX90632_COST_RAW_BURST:
+            return mlx90632_read_temp_raw_burst(&ambient_new_raw, &ambient_old_raw, &object_new_raw, &object_old_raw);
+
+        case MLX90632_COST_RAW_EXTENDED:
+            return mlx90632_read_temp_raw_extended(&ambient_new_raw, &ambient_old_raw, &object_new_raw);
+
+        case MLX90632_COST_RAW_EXTENDED_BURST:
+            return mlx90632_read_temp_raw_extended_burst(&ambient_new_raw, &ambient_old_raw, &object_new_raw);
+
+        case MLX90632_COST_SINGLE:
+            return mlx90632_single_measurement(&calib, &ambient, &object, &latency_us);
+
+        default:
+            return -EINVAL;
+    }
+}
+
+/** Relative difference of emulated value from predicted one, printed next to them */
+static double compare(double predicted, double emulated)
+{
+    double difference = fabs(emulated - predicted) / predicted;
+
+    printf(" %8.2f %8.2f", predicted, emulated);
+    return difference;
+}
+
+int main(void)
+{
+    static const emulator_faults_t healthy;
+    mlx90632_cost_bus_t bus = { EMULATOR_READ_US, EMULATOR_WRITE_US, MLX90632_COST_POLL_US };
+    int failed = 0;
+    uint32_t w;
+
+    printf("%-19s %17s %17s %17s %8s\n", "", "reads/sample", "writes/sample", "samples/s", "");
+    printf("%-19s %8s %8s %8s %8s %8s %8s %8s\n", "function", "model", "emulated", "model", "emulated",
+           "model", "emulated", "worst");
+
+    for (w = 0; w < ARRAY_SIZE(workloads); ++w)
+    {
+        const emulator_stats_t *stats;
+        mlx90632_cost_sensor_t sensor;
+        mlx90632_cost_t cost;
+        uint32_t reads, writes, samples;
+        uint64_t start;
+        double worst, difference;
+
+        emulator_init(&healthy, SEED);
+        if (workloads[w].meas_type != MLX90632_MTYP_MEDICAL)
+            mlx90632_set_meas_type(workloads[w].meas_type);
+        if ((workloads[w].api == MLX90632_COST_SINGLE) && (mlx90632_single_init() < 0))
+            return 1;
+
+        if ((mlx90632_cost_sensor_read(&sensor, workloads[w].api) < 0) ||
+            (mlx90632_cost_predict(&bus, &sensor, &cost) < 0))
+            return 1;
+
+        // first call waits for the sensor to reach the loop, or warms up the single pipeline
+        if (call(workloads[w].api) < 0)
+            return 1;
+
+        stats = emulator_stats();
+        reads = stats->reads;
+        writes = stats->writes;
+        start = mlx90632_get_time_us();
+        for (samples = 0; mlx90632_get_time_us() - start < RUN_US; ++samples)
+        {
+            if (call(workloads[w].api) < 0)
+                return 1;
+        }
+
+        printf("%-19s", workloads[w].name);
+        worst = compare(cost.reads, (double)(stats->reads - reads) / samples);
+        difference = compare(cost.writes, (double)(stats->writes - writes) / samples);
+        if (difference > worst)
+            worst = difference;
+        difference = compare(cost.samples_per_s, samples / ((mlx90632_get_time_us() - start) / 1e6));
+        if (difference > worst)
+            worst = difference;
+        printf(" %7.1f%%\n", 100.0 * worst);
+
+        if (worst > COST_LIMIT)
+            failed = 1;
+    }
+
+    return failed;
+}
@@ -0,0 +1,382 @@
+/**
+ * @file emulator.c
+ * @brief Host emulation of MLX90632 with fault injection
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ */
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_depends.h"
+#include "emulator.h"
+#include "calib_fixture.h"
+
+#define EE_WORDS 0x100 /**< Emulated EEPROM from 0x2400 */
+#define EE_START 0x2400
+#define RAM_WORDS (3 * 20 + 3) /**< RAM up to the last extended channel */
+#define REG_RESET 0x3005 /**< Register of reset command and EEPROM unlock key */
+
+static const uint8_t medical_table[] = { 1, 2 };
+static const uint8_t extended_table[] = { 17, 18, 19 };
+
+static struct emulator_s {
+    emulator_faults_t faults;
+    emulator_stats_t stats;
+    uint32_t rng;
+    uint64_t now_us;
+    uint16_t ee[EE_WORDS];
+    uint16_t ram[RAM_WORDS];
+    uint16_t ctrl;
+    uint16_t status;
+    uint8_t running; /**< Measurement table is being measured */
+    uint8_t single; /**< Only one measurement is done, started with SOC */
+    uint8_t pos; /**< Position of the running measurement in the table */
+    uint64_t next_us; /**< Completion time of the running measurement */
+    uint64_t next_fault_us; /**< Start of the next period of periodic faults */
+    uint64_t ee_busy_until_us;
+    uint8_t ee_unlocked;
+} emu;
+
+/** Deterministic pseudo random percentage */
+static double emulator_percent(void)
+{
+    emu.rng = emu.rng * 1103515245u + 12345u;
+    return ((emu.rng >> 8) & 0xFFFF) * (100.0 / 65536.0);
+}
+
+static void emulator_ee_set32(uint16_t address, int32_t value)
+{
+    emu.ee[address - EE_START] = (uint16_t)value;
+    emu.ee[address - EE_START + 1] = (uint16_t)((uint32_t)value >> 16);
+}
+
+uint16_t emulator_ram_value(uint16_t address)
+{
+    uint16_t channel = (address - MLX90632_ADDR_RAM) / 3;
+    uint16_t index = (address - MLX90632_ADDR_RAM) % 3;
+
+    // ambient in RAM_3, object signal in RAM_1 and RAM_2, with values of the unit tests
+    if (index == 2)
+        return (channel % 2) ? 22454 : 23030;
+
+    return (uint16_t)(channel < 17 ? 609 + channel : 200 + 10 * (channel - 17) + index);
+}
+
+/** Measurement table of the selected measurement type */
+static const uint8_t *emulator_table(uint8_t *length)
+{
+    if (MLX90632_MTYP(emu.ctrl) == MLX90632_MTYP_EXTENDED)
+    {
+        *length = ARRAY_SIZE(extended_table);
+        return extended_table;
+    }
+
+    *length = ARRAY_SIZE(medical_table);
+    return medical_table;
+}
+
+/** Duration of measurement at position pos of the table, from its EEPROM refresh rate */
+static uint64_t emulator_meas_us(uint8_t pos)
+{
+    uint16_t address;
+    uint16_t meas;
+
+    if (MLX90632_MTYP(emu.ctrl) == MLX90632_MTYP_EXTENDED)
+        address = MLX90632_EE_EXTENDED_MEAS1 + pos;
+    else
+        address = MLX90632_EE_MEDICAL_MEAS1 + pos;
+
+    meas = emu.ee[address - EE_START];
+    return (uint64_t)(MLX90632_MEAS_MAX_TIME >> MLX90632_REFRESH_RATE(meas)) * 1000;
+}
+
+static void emulator_start(uint8_t pos, uint8_t single)
+{
+    emu.running = 1;
+    emu.single = single;
+    emu.pos = pos;
+    emu.next_us = emu.now_us + emulator_meas_us(pos);
+}
+
+/** Registers to EEPROM defaults, RAM cleared, measurement restarts as configured in EEPROM */
+static void emulator_reset(void)
+{
+    memset(emu.ram, 0, sizeof(emu.ram));
+    emu.ctrl = emu.ee[MLX90632_EE_CTRL - EE_START];
+    emu.status = 0;
+    emu.running = 0;
+    emu.ee_unlocked = 0;
+    if (MLX90632_CFG_PWR(emu.ctrl) == MLX90632_PWR_STATUS_CONTINUOUS)
+        emulator_start(0, 0);
+}
+
+static void emulator_complete(void)
+{
+    const uint8_t *table;
+    uint8_t length, channel, position;
+    uint32_t stuck_us = emu.faults.stuck_data_rdy_us;
+
+    table = emulator_table(&length);
+    channel = table[emu.pos];
+    position = channel;
+    emu.ram[3 * channel] = emulator_ram_value(MLX90632_RAM_1(channel));
+    emu.ram[3 * channel + 1] = emulator_ram_value(MLX90632_RAM_2(channel));
+    emu.ram[3 * channel + 2] = emulator_ram_value(MLX90632_RAM_3(channel));
+    emu.stats.measurements++;
+    emu.stats.channel = channel;
+
+    if ((length == ARRAY_SIZE(extended_table)) && (emulator_percent() < emu.faults.wrong_cycle_percent))
+        position = table[(emu.pos + 1) % length];
+
+    emu.status = (emu.status & ~MLX90632_STAT_CYCLE_POS) | (position << 2);
+    if ((stuck_us == 0) || ((emu.next_us % emu.faults.stuck_period_us) >= stuck_us))
+        emu.status |= MLX90632_STAT_DATA_RDY;
+
+    emu.pos = (emu.pos + 1) % length;
+    if (emu.single || ((emu.pos == 0) && (MLX90632_CFG_PWR(emu.ctrl) != MLX90632_PWR_STATUS_CONTINUOUS)))
+    {
+        emu.running = 0;
+        emu.ctrl &= ~(MLX90632_START_BURST_MEAS | MLX90632_START_SINGLE_MEAS);
+        return;
+    }
+    emu.next_us += emulator_meas_us(emu.pos);
+}
+
+/** Advance virtual time, completing measurements and injecting periodic faults on the way */
+static void emulator_advance(uint64_t us)
+{
+    uint64_t until = emu.now_us + us;
+
+    for (;;)
+    {
+        uint8_t fault = emu.faults.brownout && (emu.next_fault_us <= until) &&
+                        (!emu.running || (emu.next_fault_us <= emu.next_us));
+
+        if (fault)
+        {
+            emu.now_us = emu.next_fault_us;
+            emu.next_fault_us += emu.faults.stuck_period_us;
+            emulator_reset();
+            emu.status |= MLX90632_STAT_BRST;
+            emu.stats.brownouts++;
+        }
+        else if (emu.running && (emu.next_us <= until))
+        {
+            emu.now_us = emu.next_us;
+            emulator_complete();
+        }
+        else
+        {
+            break;
+        }
+    }
+    emu.now_us = until;
+}
+
+static uint16_t emulator_status(void)
+{
+    uint16_t status = emu.status;
+    uint32_t stuck_us = emu.faults.stuck_ee_busy_us;
+
+    if ((emu.now_us < emu.ee_busy_until_us) || (stuck_us && ((emu.now_us % emu.faults.stuck_period_us) < stuck_us)))
+        status |= MLX90632_STAT_EE_BUSY;
+    if (emu.running && (MLX90632_CFG_PWR(emu.ctrl) == MLX90632_PWR_STATUS_SLEEP_STEP))
+        status |= MLX90632_STAT_BUSY;
+
+    return status;
+}
+
+static uint16_t emulator_read(uint16_t address)
+{
+    if (address == MLX90632_REG_STATUS)
+        return emulator_status();
+    if (address == MLX90632_REG_CTRL)
+        return emu.ctrl;
+    if ((address >= EE_START) && (address < EE_START + EE_WORDS))
+        return emu.ee[address - EE_START];
+    if ((address >= MLX90632_ADDR_RAM) && (address < MLX90632_ADDR_RAM + RAM_WORDS))
+        return emu.ram[address - MLX90632_ADDR_RAM];
+
+    return 0;
+}
+
+static void emulator_write_ctrl(uint16_t value)
+{
+    uint16_t old = emu.ctrl;
+
+    emu.ctrl = value;
+    if ((MLX90632_CFG_PWR(value) != MLX90632_CFG_PWR(old)) || (MLX90632_MTYP(value) != MLX90632_MTYP(old)))
+        emu.running = 0;
+
+    switch (MLX90632_CFG_PWR(value))
+    {
+        case MLX90632_PWR_STATUS_CONTINUOUS:
+            if (!emu.running)
+                emulator_start(0, 0);
+            break;
+        case MLX90632_PWR_STATUS_SLEEP_STEP:
+            if (!emu.running && (value & MLX90632_START_BURST_MEAS))
+                emulator_start(0, 0);
+            break;
+        case MLX90632_PWR_STATUS_STEP:
+            if (!emu.running && (value & MLX90632_START_SINGLE_MEAS))
+                emulator_start(emu.pos, 1);
+            break;
+        default:
+            emu.running = 0;
+            break;
+    }
+}
+
+static void emulator_write(uint16_t address, uint16_t value)
+{
+    if (address == MLX90632_REG_STATUS)
+    {
+        // only data ready and brown-out flags can be cleared
+        emu.status &= ~((MLX90632_STAT_DATA_RDY | MLX90632_STAT_BRST) & ~value);
+    }
+    else if (address == MLX90632_REG_CTRL)
+    {
+        emulator_write_ctrl(value);
+    }
+    else if (address == REG_RESET)
+    {
+        if (value == MLX90632_RESET_CMD)
+            emulator_reset();
+        emu.ee_unlocked = (value == MLX90632_EEPROM_WRITE_KEY);
+    }
+    else if ((address >= EE_START) && (address < EE_START + EE_WORDS) && emu.ee_unlocked &&
+             !(emulator_status() & MLX90632_STAT_EE_BUSY))
+    {
+        emu.ee[address - EE_START] = value;
+        emu.ee_unlocked = 0;
+        emu.ee_busy_until_us = emu.now_us + (emu.faults.eeprom_us ? emu.faults.eeprom_us : EMULATOR_EEPROM_US);
+    }
+}
+
+void emulator_init(const emulator_faults_t *faults, uint32_t seed)
+{
+    memset(&emu, 0, sizeof(emu));
+    emu.faults = *faults;
+    emu.rng = seed;
+    emu.next_fault_us = faults->stuck_period_us;
+
+    emu.ee[MLX90632_EE_VERSION - EE_START] = MLX90632_XTD_RNG_KEY | MLX90632_DSPv5;
+    emulator_ee_set32(MLX90632_EE_P_R, CALIB_FIXTURE_P_R);
+    emulator_ee_set32(MLX90632_EE_P_G, CALIB_FIXTURE_P_G);
+    emulator_ee_set32(MLX90632_EE_P_T, CALIB_FIXTURE_P_T);
+    emulator_ee_set32(MLX90632_EE_P_O, CALIB_FIXTURE_P_O);
+    emulator_ee_set32(MLX90632_EE_Ea, CALIB_FIXTURE_Ea);
+    emulator_ee_set32(MLX90632_EE_Eb, CALIB_FIXTURE_Eb);
+    emulator_ee_set32(MLX90632_EE_Fa, CALIB_FIXTURE_Fa);
+    emulator_ee_set32(MLX90632_EE_Fb, CALIB_FIXTURE_Fb);
+    emulator_ee_set32(MLX90632_EE_Ga, CALIB_FIXTURE_Ga);
+    emu.ee[MLX90632_EE_Gb - EE_START] = CALIB_FIXTURE_Gb;
+    emu.ee[MLX90632_EE_Ka - EE_START] = CALIB_FIXTURE_Ka;
+    emu.ee[MLX90632_EE_Ha - EE_START] = CALIB_FIXTURE_Ha;
+    emu.ee[MLX90632_EE_Hb - EE_START] = CALIB_FIXTURE_Hb;
+    emu.ee[MLX90632_EE_CTRL - EE_START] = MLX90632_PWR_STATUS_CONTINUOUS | MLX90632_MTYP_STATUS_MEDICAL;
+    emu.ee[MLX90632_EE_MEDICAL_MEAS1 - EE_START] = 0x800D | MLX90632_REFRESH_RATE_STATUS(MLX90632_MEAS_HZ_16);
+    emu.ee[MLX90632_EE_MEDICAL_MEAS2 - EE_START] = 0x801D | MLX90632_REFRESH_RATE_STATUS(MLX90632_MEAS_HZ_16);
+    emu.ee[MLX90632_EE_EXTENDED_MEAS1 - EE_START] = 0x8025 | MLX90632_REFRESH_RATE_STATUS(MLX90632_MEAS_HZ_8);
+    emu.ee[MLX90632_EE_EXTENDED_MEAS2 - EE_START] = 0x8035 | MLX90632_REFRESH_RATE_STATUS(MLX90632_MEAS_HZ_8);
+    emu.ee[MLX90632_EE_EXTENDED_MEAS3 - EE_START] = 0x8045 | MLX90632_REFRESH_RATE_STATUS(MLX90632_MEAS_HZ_8);
+
+    emulator_reset();
+}
+
+const emulator_stats_t *emulator_stats(void)
+{
+    return &emu.stats;
+}
+
+int32_t mlx90632_i2c_read(int16_t register_address, uint16_t *value)
+{
+    emulator_advance(EMULATOR_READ_US);
+    emu.stats.reads++;
+    if (emulator_percent() < emu.faults.nak_read_percent)
+    {
+        emu.stats.naks++;
+        return -EIO;
+    }
+
+    *value = emulator_read((uint16_t)register_address);
+    return 0;
+}
+
+int32_t mlx90632_i2c_read_block(int16_t register_address, uint16_t *value, uint16_t words)
+{
+    uint16_t i;
+
+    emulator_advance(EMULATOR_READ_US + (uint64_t)(words ? words - 1 : 0) * EMULATOR_WORD_US);
+    emu.stats.reads++;
+    if (emulator_percent() < emu.faults.nak_read_percent)
+    {
+        emu.stats.naks++;
+        return -EIO;
+    }
+
+    for (i = 0; i < words; ++i)
+        value[i] = emulator_read((uint16_t)(register_address + i));
+    return 0;
+}
+
+int32_t mlx90632_i2c_write(int16_t register_address, uint16_t value)
+{
+    emulator_advance(EMULATOR_WRITE_US);
+    emu.stats.writes++;
+    if (emulator_percent() < emu.faults.nak_write_percent)
+    {
+        emu.stats.naks++;
+        return -EIO;
+    }
+
+    emulator_write((uint16_t)register_address, value);
+    return 0;
+}
+
+int32_t mlx90632_i2c_submit(mlx90632_i2c_xfer_t *xfer)
+{
+    // emulated bus finishes the transfer at once, in virtual time
+    if (xfer->write)
+        xfer->status = mlx90632_i2c_write(xfer->register_address, xfer->value[0]);
+    else
+        xfer->status = mlx90632_i2c_read_block(xfer->register_address, xfer->value, xfer->words);
+
+    xfer->complete(xfer);
+    return 0;
+}
+
+void usleep(int min_range, int max_range)
+{
+    (void)max_range;
+    emulator_advance((uint64_t)min_range);
+}
+
+void msleep(int msecs)
+{
+    emulator_advance((uint64_t)msecs * 1000);
+}
+
+uint64_t mlx90632_get_time_us(void)
+{
+    return emu.now_us;
+}
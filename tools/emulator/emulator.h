@@ -0,0 +1,96 @@
+/**
+ * @file emulator.h
+ * @brief Host emulation of MLX90632 with fault injection
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * Emulator implements the functions of mlx90632_depends.h on a register model of the sensor, so the library runs
+ * on the host unchanged. Time is virtual: every i2c transaction advances it by its duration on a 400 kHz bus and
+ * usleep and msleep advance it without sleeping, so minutes of sensor time run in milliseconds and every run with
+ * the same seed is identical.
+ *
+ * Model covers what the driver uses: EEPROM with calibration and measurement tables, control register with power
+ * modes, measurement type, start of single and burst measurement, status register with data ready, cycle position,
+ * busy, EEPROM busy and brown-out flags, RAM of medical and extended measurements, addressed reset and unlocked
+ * EEPROM erase and write. Block reads increment the register address across all registers, also from the status
+ * register into RAM.
+ *
+ * Faults are injected as configured in @link emulator_faults_s @endlink. Periodic faults start at every multiple of
+ * their period, random ones use a deterministic generator.
+ */
+#ifndef _MLX90632_EMULATOR_
+#define _MLX90632_EMULATOR_
+
+#include <stdint.h>
+
+#define EMULATOR_READ_US 160 /**< Register read on 400 kHz bus: address, register, repeated start, two bytes */
+#define EMULATOR_WRITE_US 115 /**< Register write on 400 kHz bus: address, register and two bytes */
+#define EMULATOR_WORD_US 45 /**< Every additional word of a block read */
+#define EMULATOR_EEPROM_US 10000 /**< Time EEPROM is busy after an erase or a write */
+
+/** Faults to inject, all zero is a healthy sensor */
+typedef struct emulator_faults_s {
+    double nak_read_percent; /**< Percentage of register reads which are not acknowledged */
+    double nak_write_percent; /**< Percentage of register writes which are not acknowledged */
+    double wrong_cycle_percent; /**< Percentage of extended measurements which report a wrong cycle position */
+    uint32_t stuck_period_us; /**< Period of the stuck flag and brown-out faults below */
+    uint32_t stuck_data_rdy_us; /**< Data ready is not raised for this long at the start of every period */
+    uint32_t stuck_ee_busy_us; /**< EEPROM busy stays set for this long at the start of every period */
+    uint8_t brownout; /**< Brown-out reset at the start of every period */
+    uint32_t eeprom_us; /**< Time of EEPROM erase or write, @link EMULATOR_EEPROM_US @endlink when 0 */
+} emulator_faults_t;
+
+/** Counters of the emulated bus and device */
+typedef struct emulator_stats_s {
+    uint32_t reads; /**< Register read transactions */
+    uint32_t writes; /**< Register write transactions */
+    uint32_t naks; /**< Transactions which were not acknowledged */
+    uint32_t brownouts; /**< Brown-out resets */
+    uint32_t measurements; /**< Completed measurements of the measurement table */
+    uint8_t channel; /**< Channel of the last completed measurement, whatever cycle position reported */
+} emulator_stats_t;
+
+/** Power up emulated sensor with faults
+ *
+ * EEPROM holds the calibration used in the unit tests with medical measurements at 16 Hz and extended ones at
+ * 8 Hz, sensor starts in continuous medical mode at time 0.
+ *
+ * @param[in] faults Pointer to faults to inject, copied
+ * @param[in] seed Seed of the generator of random faults
+ */
+void emulator_init(const emulator_faults_t *faults, uint32_t seed);
+
+/** Counters since @link emulator_init @endlink
+ *
+ * @return Pointer to counters
+ */
+const emulator_stats_t *emulator_stats(void);
+
+/** Raw values the emulated sensor writes to RAM of every measurement
+ *
+ * Samples read by the driver can be compared against these to find data which was not measured, for example RAM
+ * cleared by a brown-out.
+ *
+ * @param[in] address RAM address
+ *
+ * @return Value written to the address by a measurement
+ */
+uint16_t emulator_ram_value(uint16_t address);
+
+#endif
@@ -0,0 +1,378 @@
+/**
+ * @file faults.c
+ * @brief Throughput and recovery time of the driver under injected sensor faults
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * Each workload calls one library function in a loop for @link RUN_US @endlink of emulated time, once on a healthy
+ * sensor and once per fault which affects it:
+ *  - medical: mlx90632_read_temp_raw in continuous medical mode,
+ *  - extended: mlx90632_read_temp_raw_extended in continuous extended mode,
+ *  - eeprom: mlx90632_set_refresh_rate alternating between two refresh rates,
+ *  - capture: mlx90632_capture of @link CAPTURE_SAMPLES @endlink samples in continuous medical mode,
+ *  - block: mlx90632_capture_block of @link CAPTURE_SAMPLES @endlink samples, one block read from status register
+ *    through medical RAM per attempt. Emulator increments register address from status register into RAM within a
+ *    block read, which is what it relies on and still needs to be confirmed on a sensor.
+ *
+ * Every run starts after the sensor completed its whole measurement table. After a failed call, or one which
+ * returned data that was never measured, the loop recovers like an application would: it reads the status register
+ * and when the brown-out flag is set, clears it and sets the measurement type again. Reported per run are good
+ * samples per second and their share of the healthy run, failed calls, calls which succeeded with data that was
+ * never measured, mean and maximum time from the first failed or bad call to the next good one, and bus
+ * transactions per good sample.
+ *
+ * Bus transactions of the capture workloads include the wait for the first sample of every call, so their steady
+ * state cost is reported separately, from @link STEADY_SAMPLES @endlink samples captured in one call on a healthy
+ * sensor.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_depends.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_sample.h"
+#include "mlx90632_block.h"
+#include "emulator.h"
+
+#define RUN_US 120000000ull /**< Emulated time of one run */
+#define FAULT_PERIOD_US 5000000 /**< Period of stuck flags and brown-outs */
+#define SEED 1
+#define CAPTURE_SAMPLES 16 /**< Samples captured by one call of the capture workloads */
+#define STEADY_SAMPLES 2000 /**< Samples captured in one call to measure steady state cost of capture */
+#define SETTLE_MS 500 /**< Time before a run, longer than the 375 ms extended table, so that all RAM is measured */
+
+/** Outcome of one call of a workload */
+typedef enum workload_result_e {
+    WORKLOAD_GOOD,
+    WORKLOAD_FAILED,
+    WORKLOAD_BAD_DATA, /**< Call succeeded, but returned data which was not measured */
+} workload_result_t;
+
+typedef struct workload_s {
+    const char *name;
+    uint8_t meas_type; /**< Measurement type set at start and after brown-out */
+    workload_result_t (*call)(uint32_t n);
+    uint32_t samples; /**< Samples returned by one good call */
+} workload_t;
+
+typedef struct fault_s {
+    const char *name;
+    emulator_faults_t faults;
+    uint8_t workloads; /**< Bit mask of workloads the fault affects */
+} fault_t;
+
+typedef struct run_s {
+    uint32_t good;
+    uint32_t failed;
+    uint32_t bad_data;
+    uint32_t recoveries;
+    uint64_t recovery_total_us;
+    uint64_t recovery_max_us;
+    uint64_t elapsed_us; /**< Emulated time of the run, without settling */
+} run_t;
+
+static int measured(int16_t value, const uint16_t *expected, uint8_t count)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; ++i)
+    {
+        if ((uint16_t)value == expected[i])
+            return 1;
+    }
+    return 0;
+}
+
+static int medical_measured(int16_t ambient_new_raw, int16_t ambient_old_raw,
+                            int16_t object_new_raw, int16_t object_old_raw)
+{
+    uint16_t ambient[2], object[2];
+
+    // object values are averages of RAM_1 and RAM_2, which are equal in the emulator
+    ambient[0] = emulator_ram_value(MLX90632_RAM_3(1));
+    ambient[1] = emulator_ram_value(MLX90632_RAM_3(2));
+    object[0] = emulator_ram_value(MLX90632_RAM_1(1));
+    object[1] = emulator_ram_value(MLX90632_RAM_1(2));
+
+    return measured(ambient_new_raw, ambient, 2) && measured(ambient_old_raw, ambient, 2) &&
+           measured(object_new_raw, object, 2) && measured(object_old_raw, object, 2);
+}
+
+static workload_result_t call_medical(uint32_t n)
+{
+    int16_t ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw;
+
+    (void)n;
+    if (mlx90632_read_temp_raw(&ambient_new_raw, &ambient_old_raw, &object_new_raw, &object_old_raw) < 0)
+        return WORKLOAD_FAILED;
+
+    if (!medical_measured(ambient_new_raw, ambient_old_raw, object_new_raw, object_old_raw))
+        return WORKLOAD_BAD_DATA;
+
+    return WORKLOAD_GOOD;
+}
+
+static workload_result_t call_extended(uint32_t n)
+{
+    int16_t ambient_new_raw, ambient_old_raw, object_new_raw;
+
+    (void)n;
+    if (mlx90632_read_temp_raw_extended(&ambient_new_raw, &ambient_old_raw, &object_new_raw) < 0)
+        return WORKLOAD_FAILED;
+
+    if (((uint16_t)ambient_new_raw != emulator_ram_value(MLX90632_RAM_3(17))) ||
+        ((uint16_t)ambient_old_raw != emulator_ram_value(MLX90632_RAM_3(18))))
+        return WORKLOAD_BAD_DATA;
+
+    // wrong cycle position makes the driver read a table which is not complete yet
+    if (emulator_stats()->channel != 19)
+        return WORKLOAD_BAD_DATA;
+
+    return WORKLOAD_GOOD;
+}
+
+/** Refresh rate last read back from EEPROM, MLX90632_MEAS_HZ_ERROR when a failed call left it unknown */
+static mlx90632_meas_t eeprom_rate;
+
+static workload_result_t call_eeprom(uint32_t n)
+{
+    mlx90632_meas_t rate;
+
+    // alternate from what EEPROM holds, so that every call writes it, also after a failed one
+    if ((n == 0) || (eeprom_rate == MLX90632_MEAS_HZ_ERROR))
+    {
+        eeprom_rate = mlx90632_get_refresh_rate();
+        if (eeprom_rate == MLX90632_MEAS_HZ_ERROR)
+            return WORKLOAD_FAILED;
+    }
+    rate = (eeprom_rate == MLX90632_MEAS_HZ_16) ? MLX90632_MEAS_HZ_8 : MLX90632_MEAS_HZ_16;
+
+    if (mlx90632_set_refresh_rate(rate) < 0)
+    {
+        eeprom_rate = MLX90632_MEAS_HZ_ERROR;
+        return WORKLOAD_FAILED;
+    }
+
+    // writes dropped by the sensor are only seen when reading back
+    eeprom_rate = mlx90632_get_refresh_rate();
+    if (eeprom_rate == MLX90632_MEAS_HZ_ERROR)
+        return WORKLOAD_FAILED;
+    if (eeprom_rate != rate)
+        return WORKLOAD_BAD_DATA;
+
+    return WORKLOAD_GOOD;
+}
+
+static workload_result_t check_capture(const mlx90632_sample_t *buf, const mlx90632_capture_stats_t *stats)
+{
+    uint32_t i;
+
+    for (i = 0; i < CAPTURE_SAMPLES; ++i)
+    {
+        if (!medical_measured(buf[i].ambient_new_raw, buf[i].ambient_old_raw,
+                              buf[i].object_new_raw, buf[i].object_old_raw))
+            return WORKLOAD_BAD_DATA;
+    }
+
+    // same measurement returned twice is not a new sample
+    if (stats->duplicated)
+        return WORKLOAD_BAD_DATA;
+
+    return WORKLOAD_GOOD;
+}
+
+static workload_result_t call_capture(uint32_t n)
+{
+    mlx90632_sample_t buf[CAPTURE_SAMPLES];
+    mlx90632_capture_stats_t stats;
+
+    (void)n;
+    if (mlx90632_capture(buf, CAPTURE_SAMPLES, &stats) < 0)
+        return WORKLOAD_FAILED;
+
+    return check_capture(buf, &stats);
+}
+
+static workload_result_t call_block(uint32_t n)
+{
+    mlx90632_sample_t buf[CAPTURE_SAMPLES];
+    mlx90632_capture_stats_t stats;
+
+    (void)n;
+    if (mlx90632_capture_block(buf, CAPTURE_SAMPLES, &stats) < 0)
+        return WORKLOAD_FAILED;
+
+    return check_capture(buf, &stats);
+}
+
+static const workload_t workloads[] = {
+    { "medical", MLX90632_MTYP_MEDICAL, call_medical, 1 },
+    { "extended", MLX90632_MTYP_EXTENDED, call_extended, 1 },
+    { "eeprom", MLX90632_MTYP_MEDICAL, call_eeprom, 1 },
+    { "capture", MLX90632_MTYP_MEDICAL, call_capture, CAPTURE_SAMPLES },
+    { "block", MLX90632_MTYP_MEDICAL, call_block, CAPTURE_SAMPLES },
+};
+
+#define MEDICAL (BIT(0) | BIT(3) | BIT(4))
+#define EXTENDED BIT(1)
+#define EEPROM BIT(2)
+
+static const fault_t faults[] = {
+    { "none", { 0 }, MEDICAL | EXTENDED | EEPROM },
+    { "NAK 1% of reads", { .nak_read_percent = 1.0 }, MEDICAL | EXTENDED | EEPROM },
+    { "NAK 1% of writes", { .nak_write_percent = 1.0 }, MEDICAL | EXTENDED | EEPROM },
+    { "DATA_RDY stuck 300ms/5s", { .stuck_period_us = FAULT_PERIOD_US, .stuck_data_rdy_us = 300000 },
+      MEDICAL | EXTENDED },
+    { "EE_BUSY stuck 200ms/5s", { .stuck_period_us = FAULT_PERIOD_US, .stuck_ee_busy_us = 200000 }, EEPROM },
+    { "brown-out every 5s", { .stuck_period_us = FAULT_PERIOD_US, .brownout = 1 }, MEDICAL | EXTENDED | EEPROM },
+    { "wrong cycle position 20%", { .wrong_cycle_percent = 20.0 }, EXTENDED },
+    { "slow EEPROM 100ms", { .eeprom_us = 100000 }, EEPROM },
+};
+
+/** Recover after a failed call, as an application would */
+static void recover(const workload_t *workload)
+{
+    uint16_t status;
+
+    if (mlx90632_i2c_read(MLX90632_REG_STATUS, &status) < 0)
+        return;
+
+    if (status & MLX90632_STAT_BRST)
+    {
+        if (mlx90632_i2c_write(MLX90632_REG_STATUS, status & ~MLX90632_STAT_BRST) < 0)
+            return;
+        mlx90632_set_meas_type(workload->meas_type);
+    }
+}
+
+static void run(const workload_t *workload, const fault_t *fault, run_t *result)
+{
+    uint64_t failed_since = 0, begin;
+    uint8_t failing = 0;
+    uint32_t n;
+
+    memset(result, 0, sizeof(*result));
+    emulator_init(&fault->faults, SEED);
+
+    /* Setup is not measured, faults start with the first period. Sensor first completes its whole table, like one
+     * which was powered up before the application started, so that a healthy run has no data which was never
+     * measured.
+     */
+    if (workload->meas_type != MLX90632_MTYP_MEDICAL)
+        mlx90632_set_meas_type(workload->meas_type);
+    msleep(SETTLE_MS);
+    begin = mlx90632_get_time_us();
+
+    for (n = 0; mlx90632_get_time_us() - begin < RUN_US; ++n)
+    {
+        uint64_t start = mlx90632_get_time_us();
+        workload_result_t outcome = workload->call(n);
+
+        if (outcome == WORKLOAD_GOOD)
+        {
+            result->good += workload->samples;
+            if (failing)
+            {
+                uint64_t recovery = mlx90632_get_time_us() - failed_since;
+
+                result->recoveries++;
+                result->recovery_total_us += recovery;
+                if (recovery > result->recovery_max_us)
+                    result->recovery_max_us = recovery;
+                failing = 0;
+            }
+            continue;
+        }
+
+        // data which was never measured needs recovery as much as a failed call
+        if (outcome == WORKLOAD_BAD_DATA)
+            result->bad_data++;
+        else
+            result->failed++;
+        if (!failing)
+        {
+            failing = 1;
+            failed_since = start;
+        }
+        recover(workload);
+    }
+    result->elapsed_us = mlx90632_get_time_us() - begin;
+}
+
+int main(void)
+{
+    uint32_t w, f;
+
+    printf("%-9s %-26s %9s %7s %7s %7s %13s %13s %9s\n", "workload", "fault", "good/s", "share", "failed",
+           "bad", "recovery ms", "max rec. ms", "bus/good");
+
+    for (w = 0; w < ARRAY_SIZE(workloads); ++w)
+    {
+        double baseline = 0.0;
+
+        for (f = 0; f < ARRAY_SIZE(faults); ++f)
+        {
+            const emulator_stats_t *stats;
+            double rate;
+            run_t result;
+
+            if (!(faults[f].workloads & BIT(w)))
+                continue;
+
+            run(&workloads[w], &faults[f], &result);
+            stats = emulator_stats();
+            rate = result.good / (result.elapsed_us / 1e6);
+            if (f == 0)
+                baseline = rate;
+
+            printf("%-9s %-26s %9.2f %6.1f%% %7u %7u %13.1f %13.1f %9.1f\n", workloads[w].name, faults[f].name,
+                   rate, 100.0 * rate / baseline, result.failed, result.bad_data,
+                   result.recoveries ? result.recovery_total_us / 1e3 / result.recoveries : 0.0,
+                   result.recovery_max_us / 1e3,
+                   result.good ? (double)(stats->reads + stats->writes) / result.good : 0.0);
+        }
+    }
+
+    printf("\n%-9s %9s %9s %9s\n", "capture", "samples", "missed", "bus/good");
+    for (w = 0; w < 2; ++w)
+    {
+        static mlx90632_sample_t buf[STEADY_SAMPLES];
+        static const emulator_faults_t healthy;
+        mlx90632_capture_stats_t capture_stats;
+        const emulator_stats_t *stats;
+        int32_t ret;
+
+        emulator_init(&healthy, SEED);
+        if (w == 0)
+            ret = mlx90632_capture(buf, STEADY_SAMPLES, &capture_stats);
+        else
+            ret = mlx90632_capture_block(buf, STEADY_SAMPLES, &capture_stats);
+        if (ret < 0)
+            return 1;
+
+        stats = emulator_stats();
+        printf("%-9s %9u %9u %9.2f\n", w ? "block" : "capture", STEADY_SAMPLES, capture_stats.missed,
+               (double)(stats->reads + stats->writes) / STEADY_SAMPLES);
+    }
+
+    return 0;
+}
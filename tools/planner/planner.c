@@ -0,0 +1,260 @@
+/**
+ * @file planner.c
+ * @brief Bus capacity planner for MLX90632 sensors from the cost model
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ * Usage: planner [-c clock_hz] [-o overhead_us] [-p poll_us] function@rate[xcount]...
+ *
+ * Every sensor argument adds count sensors, which call function in a loop with every measurement of the table at
+ * refresh rate rate, in Hz as in mlx90632_meas_t (0.5 to 64). Functions are raw, burst, extended, extended_burst and
+ * single, see mlx90632_cost_api_t. Bus clock is 400 kHz and overhead 0 us by default.
+ *
+ * Report lists predicted cost per sensor of every argument and how many of those sensors fit on the bus alone,
+ * followed by utilisation, samples per second and worst latency of the bus. Program exits with 1 when the bus
+ * cannot keep up with the sensors and with 2 on wrong arguments.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "mlx90632.h"
+#include "mlx90632_depends.h"
+#include "mlx90632_cost.h"
+
+#define MAX_SENSORS 256 /**< Sensors on one bus, far above what the bus carries at any rate */
+#define ADDRESSES 2 /**< Slave addresses of the MLX90632 */
+
+static const char *const api_names[MLX90632_COST_APIS] = {
+    [MLX90632_COST_RAW] = "raw",
+    [MLX90632_COST_RAW_BURST] = "burst",
+    [MLX90632_COST_RAW_EXTENDED] = "extended",
+    [MLX90632_COST_RAW_EXTENDED_BURST] = "extended_burst",
+    [MLX90632_COST_SINGLE] = "single",
+};
+
+static const char *const rate_names[] = {
+    [MLX90632_MEAS_HZ_HALF] = "0.5",
+    [MLX90632_MEAS_HZ_1] = "1",
+    [MLX90632_MEAS_HZ_2] = "2",
+    [MLX90632_MEAS_HZ_4] = "4",
+    [MLX90632_MEAS_HZ_8] = "8",
+    [MLX90632_MEAS_HZ_16] = "16",
+    [MLX90632_MEAS_HZ_32] = "32",
+    [MLX90632_MEAS_HZ_64] = "64",
+};
+
+/** Sensors of one argument */
+typedef struct group_s {
+    const char *arg;
+    uint32_t first; /**< Index of the first sensor of the group */
+    uint32_t count;
+} group_t;
+
+static mlx90632_cost_sensor_t sensors[MAX_SENSORS];
+static mlx90632_cost_t costs[MAX_SENSORS];
+static group_t groups[MAX_SENSORS];
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: planner [-c clock_hz] [-o overhead_us] [-p poll_us] function@rate[xcount]...\n"
+            "  function: raw, burst, extended, extended_burst, single\n"
+            "  rate: 0.5, 1, 2, 4, 8, 16, 32, 64 Hz\n");
+}
+
+/** Parse function@rate[xcount] into sensor and count, returns 0 on success */
+static int parse_sensor(const char *arg, mlx90632_cost_sensor_t *sensor, uint32_t *count)
+{
+    char name[32];
+    const char *at = strchr(arg, '@');
+    const char *x;
+    size_t length, rate_length;
+    int api, rate;
+
+    if ((at == NULL) || ((length = (size_t)(at - arg)) >= sizeof(name)))
+        return -1;
+    memcpy(name, arg, length);
+    name[length] = '\0';
+
+    x = strchr(at + 1, 'x');
+    rate_length = x ? (size_t)(x - at - 1) : strlen(at + 1);
+    *count = 1;
+    if (x != NULL)
+    {
+        char *end;
+        long n = strtol(x + 1, &end, 10);
+
+        if ((*end != '\0') || (n < 1) || (n > MAX_SENSORS))
+            return -1;
+        *count = (uint32_t)n;
+    }
+
+    for (api = 0; api < MLX90632_COST_APIS; ++api)
+    {
+        if (strcmp(name, api_names[api]) == 0)
+            break;
+    }
+
+    for (rate = MLX90632_MEAS_HZ_HALF; rate <= MLX90632_MEAS_HZ_64; ++rate)
+    {
+        if ((strlen(rate_names[rate]) == rate_length) && (strncmp(at + 1, rate_names[rate], rate_length) == 0))
+            break;
+    }
+
+    if ((api == MLX90632_COST_APIS) || (rate > MLX90632_MEAS_HZ_64))
+        return -1;
+
+    return mlx90632_cost_sensor_init(sensor, (mlx90632_cost_api_t)api, (mlx90632_meas_t)rate) < 0 ? -1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    mlx90632_cost_bus_t bus;
+    mlx90632_cost_plan_t plan;
+    unsigned long clock_hz = 400000, overhead_us = 0;
+    long poll_us = -1;
+    uint32_t n = 0, g, i, count;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "c:o:p:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c':
+                clock_hz = strtoul(optarg, NULL, 10);
+                break;
+
+            case 'o':
+                overhead_us = strtoul(optarg, NULL, 10);
+                break;
+
+            case 'p':
+                poll_us = strtol(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                return 2;
+        }
+    }
+
+    if ((optind == argc) || (mlx90632_cost_bus_init(&bus, (uint32_t)clock_hz, (uint32_t)overhead_us) < 0))
+    {
+        usage();
+        return 2;
+    }
+    if (poll_us >= 0)
+        bus.poll_us = (uint32_t)poll_us;
+
+    for (g = 0; optind + (int)g < argc; ++g)
+    {
+        groups[g].arg = argv[optind + g];
+        groups[g].first = n;
+        if ((parse_sensor(groups[g].arg, &sensors[n], &count) < 0) || (n + count > MAX_SENSORS))
+        {
+            fprintf(stderr, "planner: wrong sensor %s\n", groups[g].arg);
+            usage();
+            return 2;
+        }
+        groups[g].count = count;
+        for (i = 1; i < count; ++i)
+            sensors[n + i] = sensors[n];
+        n += count;
+    }
+
+    if (mlx90632_cost_plan(&bus, sensors, n, costs, &plan) < 0)
+        return 2;
+
+    printf("bus %lu Hz, %lu us overhead: read %u us, write %u us, poll every %u us\n\n", clock_hz, overhead_us,
+           bus.read_us, bus.write_us, bus.poll_us);
+    printf("%-22s %6s %7s %7s %8s %10s %11s %7s %6s\n", "sensor", "count", "reads", "writes", "bus ms",
+           "samples/s", "latency ms", "share", "fits");
+
+    for (i = 0; i < g; ++i)
+    {
+        mlx90632_cost_t *cost = &costs[groups[i].first];
+        mlx90632_cost_t alone;
+        double share;
+
+        // share and fits are for sensors which get all the samples they ask for
+        mlx90632_cost_predict(&bus, &sensors[groups[i].first], &alone);
+        share = alone.bus_us * alone.samples_per_s / 1e6;
+
+        printf("%-22s %6u %7.2f %7.2f %8.3f %10.2f %11.2f %6.1f%% %6u\n", groups[i].arg, groups[i].count,
+               cost->reads, cost->writes, cost->bus_us / 1e3, cost->samples_per_s, cost->latency_us / 1e3,
+               100.0 * share * groups[i].count, (uint32_t)(1.0 / share));
+    }
+
+    printf("\nutilisation %.1f%%, %.2f samples/s, worst latency %.2f ms: %s\n", 100.0 * plan.utilisation,
+           plan.samples_per_s, plan.latency_us / 1e3, plan.feasible ? "feasible" : "NOT feasible");
+    if (n > ADDRESSES)
+        printf("%u sensors need a multiplexer, its channel switches are not included\n", n);
+
+    return plan.feasible ? 0 : 1;
+}
+
+/* Cost model does not access the sensor, functions of mlx90632_depends.h are only needed for linking */
+int32_t mlx90632_i2c_read(int16_t register_address, uint16_t *value)
+{
+    (void)register_address;
+    (void)value;
+    return -ENODEV;
+}
+
+int32_t mlx90632_i2c_read_block(int16_t register_address, uint16_t *value, uint16_t words)
+{
+    (void)register_address;
+    (void)value;
+    (void)words;
+    return -ENODEV;
+}
+
+int32_t mlx90632_i2c_write(int16_t register_address, uint16_t value)
+{
+    (void)register_address;
+    (void)value;
+    return -ENODEV;
+}
+
+int32_t mlx90632_i2c_submit(mlx90632_i2c_xfer_t *xfer)
+{
+    (void)xfer;
+    return -ENODEV;
+}
+
+void usleep(int min_range, int max_range)
+{
+    (void)min_range;
+    (void)max_range;
+}
+
+void msleep(int msecs)
+{
+    (void)msecs;
+}
+
+uint64_t mlx90632_get_time_us(void)
+{
+    return 0;
+}
@@ -0,0 +1,77 @@
+# @copyright (C) 2017 Melexis N.V.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Worst-case stack usage from call graphs written by gcc -fcallgraph-info=su
+#
+# Prints the deepest call chain of the library in bytes and the function where
+# it starts. Functions outside of the given files (mlx90632_depends.h and libm)
+# count as 0 bytes, so their own usage needs to be added for the platform. With
+# -v from=file.ci only chains starting in functions of that file are considered,
+# while the other files still provide the functions it calls.
+
+function title(line) {
+    match(line, /title: "[^"]*"/)
+    return substr(line, RSTART + 8, RLENGTH - 9)
+}
+
+function attr(line, name) {
+    match(line, name ": \"[^\"]*\"")
+    return substr(line, RSTART + length(name) + 3, RLENGTH - length(name) - 4)
+}
+
+# Deepest stack usage starting in function n, cycles count only once
+function depth(n,    i, count, callees, best, d) {
+    if (n in memo)
+        return memo[n]
+    memo[n] = frame[n]
+    best = 0
+    count = split(calls[n], callees, SUBSEP)
+    for (i = 2; i <= count; i++) {
+        d = depth(callees[i])
+        if (d > best)
+            best = d
+    }
+    memo[n] = frame[n] + best
+    return memo[n]
+}
+
+/^node:/ {
+    n = title($0)
+    if (match($0, /[0-9]+ bytes/)) {
+        frame[n] = substr($0, RSTART, RLENGTH - 6) + 0
+        file[n] = FILENAME
+    }
+    else if (!(n in frame))
+        frame[n] = 0
+}
+
+/^edge:/ {
+    calls[attr($0, "sourcename")] = calls[attr($0, "sourcename")] SUBSEP attr($0, "targetname")
+}
+
+END {
+    worst = 0
+    start = "-"
+    for (n in frame) {
+        if (from != "" && file[n] != from)
+            continue
+        d = depth(n)
+        if (d > worst) {
+            worst = d
+            start = n
+        }
+    }
+    sub(/.*:/, "", start)
+    print worst, start
+}
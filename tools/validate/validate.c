@@ -0,0 +1,458 @@
+/**
+ * @file validate.c
+ * @brief Accuracy validation of fast calculation paths against reference calculations
+ * @internal
+ *
+ * @copyright (C) 2026 Melexis N.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @endinternal
+ *
+ *
+ * Every fast path is compared against the reference double calculations of mlx90632.c and
+ * mlx90632_extended_meas.c over the domain the sensor can report:
+ *  - ambient raw values for die temperatures from -20 to 85 degrees Celsius,
+ *  - object raw values over the full 16-bit range, for object temperatures from -70 to 380 degrees Celsius,
+ *  - calibration parameters at nominal value and with each of them spread by +-20 percent,
+ *  - emissivity from 1.0 down to 0.1,
+ *  - reflected temperature from -20 to 60 degrees Celsius, for paths which take it.
+ *
+ * Reference substitutions have not converged yet for some inputs at low emissivity. Those points are counted in
+ * the report, but not scored, since the reference itself is off by more than the limit there.
+ *
+ * Newton solver paths converge much closer than the reference, so they are scored at every point against the
+ * converged solution of the equation with @link SOLVER_LIMIT @endlink, which catches a loss of their precision.
+ *
+ * Maximum and mean absolute error is reported per path. Program exits with 1 when any path exceeds its limit,
+ * @link VALIDATE_LIMIT @endlink for exact paths, so `make validate` fails in CI. Lookup table is an approximation
+ * and is checked against its own, documented limit inside of the temperature range its table spans.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <errno.h>
+
+#include "mlx90632.h"
+#include "mlx90632_depends.h"
+#include "mlx90632_extended_meas.h"
+#include "mlx90632_newton.h"
+#include "mlx90632_ambient_state.h"
+#include "mlx90632_lut.h"
+#include "calib_fixture.h"
+
+#include "mlx90632_fixed_calib.h"
+
+#ifndef VALIDATE_LIMIT
+#define VALIDATE_LIMIT 0.01 /**< Maximum allowed error in degrees Celsius, 1/20 of medical accuracy of the sensor */
+#endif
+#define VALIDATE_CONVERGED (VALIDATE_LIMIT / 10) /**< Maximum residual of reference which is still scored */
+#define SOLVER_LIMIT 1e-9 /**< Maximum allowed error of Newton solver against converged solution, see mlx90632_newton.h */
+#define SOLVER_STEPS 1000 /**< Maximum substitutions of the converged solution */
+
+#define MIN_AMBIENT_TEMP -20.0 /**< Lower end of ambient temperature range */
+#define MAX_AMBIENT_TEMP 85.0 /**< Upper end of ambient temperature range */
+#define MIN_OBJECT_TEMP -70.0 /**< Lower end of object temperature range */
+#define MAX_OBJECT_TEMP 380.0 /**< Upper end of object temperature range */
+
+#define AMBIENT_OLD_OFFSET 576 /**< Difference of old and new ambient raw values of nominal sensor */
+#define AMBIENT_RAW_STEP 250 /**< Step of ambient raw sweep */
+#define OBJECT_RAW_STEP 97 /**< Step of object raw sweep, odd to hit both signs of all bit patterns */
+#define CALIB_SPREAD 0.2 /**< Relative spread of calibration parameters */
+
+#define LUT_AMBIENT_POINTS 17 /**< Ambient grid points of the lookup table */
+#define LUT_OBJECT_POINTS 129 /**< Object grid points of the lookup table */
+#define LUT_AMBIENT_MIN 10.0 /**< Lowest ambient temperature of the lookup table */
+#define LUT_AMBIENT_MAX 60.0 /**< Highest ambient temperature of the lookup table */
+#define LUT_OBJECT_MIN -20.0 /**< Lowest object temperature of the lookup table */
+#define LUT_OBJECT_MAX 200.0 /**< Highest object temperature of the lookup table */
+#define LUT_LIMIT 0.2 /**< Maximum allowed error of lookup table with grid size above, see mlx90632_lut.h */
+
+/** Statistics of one fast path */
+typedef struct validate_path_s {
+    const char *name; /**< Name in report */
+    double limit; /**< Maximum allowed error in degrees Celsius */
+    double max_error; /**< Maximum absolute error in degrees Celsius */
+    double sum_error; /**< Sum of absolute errors in degrees Celsius */
+    uint32_t points; /**< Number of scored points */
+    uint32_t unconverged; /**< Number of points skipped because reference has not converged */
+    double worst_emissivity; /**< Emissivity of the maximum error */
+    double worst_reference; /**< Reference temperature of the maximum error */
+    uint32_t worst_calib; /**< Calibration set of the maximum error */
+} validate_path_t;
+
+enum validate_path_e {
+    PATH_FIXED_AMBIENT,
+    PATH_FIXED_OBJECT,
+    PATH_NEWTON_OBJECT,
+    PATH_AMBIENT_STATE_OBJECT,
+    PATH_LUT_OBJECT,
+#if MLX90632_ENABLE_REFLECTED
+    PATH_NEWTON_REFLECTED,
+#endif
+#if MLX90632_ENABLE_EXTENDED
+    PATH_NEWTON_EXTENDED,
+#endif
+    PATH_COUNT
+};
+
+static validate_path_t paths[PATH_COUNT] = {
+    [PATH_FIXED_AMBIENT] = { .name = "fixed calibration ambient", .limit = VALIDATE_LIMIT },
+    [PATH_FIXED_OBJECT] = { .name = "fixed calibration object", .limit = VALIDATE_LIMIT },
+    [PATH_NEWTON_OBJECT] = { .name = "newton object", .limit = SOLVER_LIMIT },
+    [PATH_AMBIENT_STATE_OBJECT] = { .name = "ambient state object", .limit = VALIDATE_LIMIT },
+    [PATH_LUT_OBJECT] = { .name = "lookup table object", .limit = LUT_LIMIT },
+#if MLX90632_ENABLE_REFLECTED
+    [PATH_NEWTON_REFLECTED] = { .name = "newton reflected", .limit = SOLVER_LIMIT },
+#endif
+#if MLX90632_ENABLE_EXTENDED
+    [PATH_NEWTON_EXTENDED] = { .name = "newton extended", .limit = SOLVER_LIMIT },
+#endif
+};
+
+static const mlx90632_calib_t nominal = CALIB_FIXTURE;
+
+static mlx90632_ambient_state_t ambient_state;
+static int16_t lut_table[MLX90632_LUT_SIZE(LUT_AMBIENT_POINTS, LUT_OBJECT_POINTS)];
+static mlx90632_lut_t lut;
+static int lut_valid;
+
+static const double emissivities[] = { 1.0, 0.9, 0.8, 0.7, 0.6, 0.5, 0.4, 0.3, 0.2, 0.1 };
+static const double reflected_temps[] = { -20.0, 25.0, 60.0 };
+
+/** Calibration set number i, 0 is nominal and every next pair spreads one parameter down and up */
+static mlx90632_calib_t calib_set(uint32_t i)
+{
+    mlx90632_calib_t c = nominal;
+    double scale = (i & 1) ? 1.0 - CALIB_SPREAD : 1.0 + CALIB_SPREAD;
+
+    switch ((i + 1) / 2)
+    {
+        case 0: break;
+        case 1: c.Ea = (int32_t)(c.Ea * scale); break;
+        case 2: c.Eb = (int32_t)(c.Eb * scale); break;
+        case 3: c.Fa = (int32_t)(c.Fa * scale); break;
+        case 4: c.Fb = (int32_t)(c.Fb * scale); break;
+        case 5: c.Ga = (int32_t)(c.Ga * scale); break;
+        case 6: c.Gb = (int16_t)(c.Gb * scale); break;
+        case 7: c.Ka = (int16_t)(c.Ka * scale); break;
+        case 8: c.Ha = (int16_t)(c.Ha * scale); break;
+        case 9: c.Hb = (int16_t)((i & 1) ? -512 : 512); break;
+    }
+
+    return c;
+}
+
+#define CALIB_SETS 19 /**< Nominal calibration and two spreads of nine parameters */
+
+/** Residual of DSPv5 object temperature equation at temperature temp
+ *
+ * @param[in] object preprocessed object temperature
+ * @param[in] ambient preprocessed ambient temperature
+ * @param[in] c calibration parameters, Fa already halved for extended range
+ * @param[in] Ta4 Fourth power of ambient or reflected temperature compensation in Kelvin, or 0 to use die
+ * @param[in] temp object temperature to be checked
+ *
+ * @return Difference between right and left side of the equation in degrees Celsius
+ */
+static double residual(int32_t object, int32_t ambient, const mlx90632_calib_t *c, double Ta4, double temp)
+{
+    double TAdut = (((double)ambient) - c->Eb / 256.0) / (c->Ea / 65536.0) + 25;
+    double Alpha = (double)c->Fa * (c->Ha / 16384.0) / 70368744177664.0;
+    double D = 1 + (double)c->Fb * (TAdut - 25) / 68719476736.0 + (double)c->Ga * (temp - 25) / 68719476736.0;
+
+    if (Ta4 == 0.0)
+        Ta4 = pow(TAdut + 273.15, 4);
+
+    return sqrt(sqrt(object / (mlx90632_get_emissivity() * Alpha * D) + Ta4)) - 273.15 - c->Hb / 1024.0 - temp;
+}
+
+/** Converged solution of DSPv5 object temperature equation
+ *
+ * Substitutions of the reference in long double, repeated until they do not change the result anymore.
+ *
+ * @param[in] object preprocessed object temperature
+ * @param[in] ambient preprocessed ambient temperature
+ * @param[in] c calibration parameters, Fa already halved for extended range
+ * @param[in] Ta4 Fourth power of ambient or reflected temperature compensation in Kelvin, or 0 to use die
+ *
+ * @return Object temperature in degrees Celsius
+ */
+static double converged(int32_t object, int32_t ambient, const mlx90632_calib_t *c, double Ta4)
+{
+    long double TAdut = (((long double)ambient) - c->Eb / 256.0L) / (c->Ea / 65536.0L) + 25;
+    long double Alpha = (long double)c->Fa * (c->Ha / 16384.0L) / 70368744177664.0L;
+    long double Gb = 1 + (long double)c->Fb * (TAdut - 25) / 68719476736.0L;
+    long double TaTr4 = (Ta4 == 0.0) ? powl(TAdut + 273.15L, 4) : Ta4;
+    long double temp = 25.0L, prev;
+    int i;
+
+    for (i = 0; i < SOLVER_STEPS; ++i)
+    {
+        prev = temp;
+        temp = sqrtl(sqrtl(object / (mlx90632_get_emissivity() * Alpha * (Gb + c->Ga * (temp - 25) / 68719476736.0L))
+                           + TaTr4)) - 273.15L - c->Hb / 1024.0L;
+        if (fabsl(temp - prev) < 1e-15L)
+            break;
+    }
+
+    return (double)temp;
+}
+
+/** Fourth power of reflected temperature compensation */
+static double reflected_ta4(int32_t ambient, const mlx90632_calib_t *c, double reflected)
+{
+    double TAdut = (((double)ambient) - c->Eb / 256.0) / (c->Ea / 65536.0) + 25;
+    double TaTr4 = pow(reflected + 273.15, 4);
+
+    return TaTr4 - (TaTr4 - pow(TAdut + 273.15, 4)) / mlx90632_get_emissivity();
+}
+
+/** Record error of one result of a fast path */
+static void record(enum validate_path_e path, double reference, double fast, uint32_t calib)
+{
+    validate_path_t *p = &paths[path];
+    double err = fabs(fast - reference);
+
+    if (!(err <= p->max_error))
+    {
+        p->max_error = err;
+        p->worst_emissivity = mlx90632_get_emissivity();
+        p->worst_reference = reference;
+        p->worst_calib = calib;
+    }
+    p->sum_error += err;
+    p->points++;
+}
+
+/** Score one result of a fast path against the reference, when the reference has converged */
+static void score(enum validate_path_e path, double reference, double fast, double reference_residual,
+                  uint32_t calib)
+{
+    if (fabs(reference_residual) > VALIDATE_CONVERGED)
+    {
+        paths[path].unconverged++;
+        return;
+    }
+
+    record(path, reference, fast, calib);
+}
+
+/** Whether object temperature is inside of the range reported by the sensor */
+static int in_object_range(double temp)
+{
+    return temp > MIN_OBJECT_TEMP && temp < MAX_OBJECT_TEMP;
+}
+
+static void validate_medical(const mlx90632_calib_t *c, uint32_t calib, int16_t ambient_new_raw,
+                             int16_t ambient_old_raw, int16_t object_raw)
+{
+    int32_t ambient = (int32_t)mlx90632_preprocess_temp_ambient(ambient_new_raw, ambient_old_raw, c->Gb);
+    int32_t object = (int32_t)mlx90632_preprocess_temp_object(object_raw, object_raw, ambient_new_raw,
+                                                              ambient_old_raw, c->Ka);
+    double ref;
+    uint32_t r;
+
+    ref = mlx90632_calc_temp_object(object, ambient, c->Ea, c->Eb, c->Ga, c->Fa, c->Fb, c->Ha, c->Hb);
+    if (!in_object_range(ref))
+        return;
+
+    record(PATH_NEWTON_OBJECT, converged(object, ambient, c, 0.0),
+           mlx90632_calc_temp_object_newton(object, ambient, c->Ea, c->Eb, c->Ga, c->Fa, c->Fb, c->Ha, c->Hb), calib);
+
+    mlx90632_ambient_state_update(&ambient_state, ambient_new_raw, ambient_old_raw, c);
+    score(PATH_AMBIENT_STATE_OBJECT, ref, mlx90632_calc_temp_object_cached(&ambient_state, object_raw, object_raw),
+          residual(object, ambient, c, 0.0, ref), calib);
+
+    if (lut_valid && (ref >= LUT_OBJECT_MIN) && (ref <= LUT_OBJECT_MAX))
+    {
+        int32_t lut_object;
+
+        if (mlx90632_lut_calc_temp_object(&lut, ambient_new_raw, ambient_old_raw, object_raw, object_raw,
+                                          &lut_object) < 0)
+            lut_object = INT32_MAX;
+        score(PATH_LUT_OBJECT, ref, lut_object / 1000.0, residual(object, ambient, c, 0.0, ref), calib);
+    }
+
+    if ((calib == 0) && (mlx90632_get_emissivity() == MLX90632_FIXED_EMISSIVITY))
+    {
+        double fixed_ambient, fixed_object;
+
+        mlx90632_fixed_calc_temp(ambient_new_raw, ambient_old_raw, object_raw, object_raw,
+                                 &fixed_ambient, &fixed_object);
+        score(PATH_FIXED_OBJECT, ref, fixed_object, residual(object, ambient, c, 0.0, ref), calib);
+    }
+
+#if MLX90632_ENABLE_REFLECTED
+    for (r = 0; r < sizeof(reflected_temps) / sizeof(reflected_temps[0]); ++r)
+    {
+        ref = mlx90632_calc_temp_object_reflected(object, ambient, reflected_temps[r],
+                                                  c->Ea, c->Eb, c->Ga, c->Fa, c->Fb, c->Ha, c->Hb);
+        if (!in_object_range(ref))
+            continue;
+        record(PATH_NEWTON_REFLECTED, converged(object, ambient, c, reflected_ta4(ambient, c, reflected_temps[r])),
+               mlx90632_calc_temp_object_reflected_newton(object, ambient, reflected_temps[r],
+                                                          c->Ea, c->Eb, c->Ga, c->Fa, c->Fb, c->Ha, c->Hb), calib);
+    }
+#else
+    (void)r;
+#endif
+}
+
+#if MLX90632_ENABLE_EXTENDED
+static void validate_extended(const mlx90632_calib_t *c, uint32_t calib, int16_t ambient_new_raw,
+                              int16_t ambient_old_raw, int16_t object_raw)
+{
+    int32_t ambient = (int32_t)mlx90632_preprocess_temp_ambient_extended(ambient_new_raw, ambient_old_raw, c->Gb);
+    int32_t object = (int32_t)mlx90632_preprocess_temp_object_extended(object_raw, ambient_new_raw,
+                                                                       ambient_old_raw, c->Ka);
+    mlx90632_calib_t half = *c;
+    double ref;
+    uint32_t r;
+
+    half.Fa = c->Fa / 2;
+    for (r = 0; r < sizeof(reflected_temps) / sizeof(reflected_temps[0]); ++r)
+    {
+        ref = mlx90632_calc_temp_object_extended(object, ambient, reflected_temps[r],
+                                                 c->Ea, c->Eb, c->Ga, c->Fa, c->Fb, c->Ha, c->Hb);
+        if (!in_object_range(ref))
+            continue;
+        record(PATH_NEWTON_EXTENDED, converged(object, ambient, &half, reflected_ta4(ambient, c, reflected_temps[r])),
+               mlx90632_calc_temp_object_extended_newton(object, ambient, reflected_temps[r],
+                                                         c->Ea, c->Eb, c->Ga, c->Fa, c->Fb, c->Ha, c->Hb), calib);
+    }
+}
+#endif
+
+static void validate_ambient(int16_t ambient_new_raw, int16_t ambient_old_raw, double reference)
+{
+    score(PATH_FIXED_AMBIENT, reference, mlx90632_fixed_calc_temp_ambient(ambient_new_raw, ambient_old_raw), 0.0, 0);
+}
+
+/** Print report and return number of paths which exceed the limit */
+static int report(void)
+{
+    int breaches = 0;
+    uint32_t i;
+
+    printf("%-28s %10s %12s %12s %12s %8s  %s\n", "path", "points", "unconverged", "max degC", "mean degC", "limit",
+           "result");
+    for (i = 0; i < PATH_COUNT; ++i)
+    {
+        validate_path_t *p = &paths[i];
+        int pass = (p->points > 0) && (p->max_error <= p->limit);
+
+        printf("%-28s %10u %12u %12.3g %12.3g %8g  %s\n", p->name, p->points, p->unconverged, p->max_error,
+               p->points ? p->sum_error / p->points : 0.0, p->limit, pass ? "PASS" : "FAIL");
+        if (!pass)
+        {
+            printf("    worst at emissivity %.1f, reference %.3f degC, calibration set %u\n",
+                   p->worst_emissivity, p->worst_reference, p->worst_calib);
+            breaches++;
+        }
+    }
+    printf("calibration spread %g, fixed calibration checked at nominal calibration only\n", CALIB_SPREAD);
+
+    return breaches;
+}
+
+int main(void)
+{
+    uint32_t calib, e;
+    int32_t ambient_raw, object_raw;
+
+    for (calib = 0; calib < CALIB_SETS; ++calib)
+    {
+        mlx90632_calib_t c = calib_set(calib);
+
+        mlx90632_ambient_state_invalidate(&ambient_state);
+
+        for (ambient_raw = 16000; ambient_raw <= 32000; ambient_raw += AMBIENT_RAW_STEP)
+        {
+            int16_t ambient_new_raw = (int16_t)ambient_raw;
+            int16_t ambient_old_raw = (int16_t)(ambient_raw + AMBIENT_OLD_OFFSET);
+            double ambient = mlx90632_calc_temp_ambient(ambient_new_raw, ambient_old_raw,
+                                                        c.P_T, c.P_R, c.P_G, c.P_O, c.Gb);
+
+            if (ambient < MIN_AMBIENT_TEMP || ambient > MAX_AMBIENT_TEMP)
+                continue;
+            if (calib == 0)
+                validate_ambient(ambient_new_raw, ambient_old_raw, ambient);
+
+            for (e = 0; e < sizeof(emissivities) / sizeof(emissivities[0]); ++e)
+            {
+                mlx90632_set_emissivity(emissivities[e]);
+                lut_valid = (ambient >= LUT_AMBIENT_MIN) && (ambient <= LUT_AMBIENT_MAX) &&
+                            (mlx90632_lut_init(&lut, lut_table, LUT_AMBIENT_POINTS, LUT_OBJECT_POINTS, &c,
+                                               LUT_AMBIENT_MIN, LUT_AMBIENT_MAX,
+                                               LUT_OBJECT_MIN, LUT_OBJECT_MAX) == 0);
+                for (object_raw = INT16_MIN; object_raw <= INT16_MAX; object_raw += OBJECT_RAW_STEP)
+                {
+                    validate_medical(&c, calib, ambient_new_raw, ambient_old_raw, (int16_t)object_raw);
+#if MLX90632_ENABLE_EXTENDED
+                    validate_extended(&c, calib, ambient_new_raw, ambient_old_raw, (int16_t)object_raw);
+#endif
+                }
+            }
+        }
+    }
+    mlx90632_set_emissivity(1.0);
+
+    return report() ? 1 : 0;
+}
+
+/* Calculations do not access the sensor, functions of mlx90632_depends.h are only needed for linking */
+int32_t mlx90632_i2c_read(int16_t register_address, uint16_t *value)
+{
+    (void)register_address;
+    (void)value;
+    return -ENODEV;
+}
+
+int32_t mlx90632_i2c_read_block(int16_t register_address, uint16_t *value, uint16_t words)
+{
+    (void)register_address;
+    (void)value;
+    (void)words;
+    return -ENODEV;
+}
+
+int32_t mlx90632_i2c_write(int16_t register_address, uint16_t value)
+{
+    (void)register_address;
+    (void)value;
+    return -ENODEV;
+}
+
+int32_t mlx90632_i2c_submit(mlx90632_i2c_xfer_t *xfer)
+{
+    (void)xfer;
+    return -ENODEV;
+}
+
+void usleep(int min_range, int max_range)
+{
+    (void)min_range;
+    (void)max_range;
+}
+
+void msleep(int msecs)
+{
+    (void)msecs;
+}
+
+uint64_t mlx90632_get_time_us(void)
+{
+    return 0;
+}